@@ -41,9 +41,12 @@
 // |`PHANTASMA_VECTOR`       |                           | `std::vector`       | Must support `push_back` and `size` members            |
 // |`PHANTASMA_JSONVALUE`    | `phantasma::JSONValue`    | `std::string_view`  | See JSON and Adaptors section                          |
 // |`PHANTASMA_JSONARRAY`    | `phantasma::JSONArray`    | `JSONValue`         | See JSON and Adaptors section                          |
+// |`PHANTASMA_JSONARRAYCURSOR`|`phantasma::JSONArrayCursor`| `JSONArrayCursor`*| See JSON and Adaptors section                          |
+// |`PHANTASMA_JSONOBJECTCURSOR`|`phantasma::JSONObjectCursor`| `JSONObjectCursor`*| See JSON and Adaptors section                        |
 // |`PHANTASMA_JSONDOCUMENT` | `phantasma::JSONDocument` | `std::string`       | See JSON and Adaptors section                          |
 // |`PHANTASMA_JSONBUILDER`  | `phantasma::JSONBuilder`  | `std::stringstream`*| See JSON and Adaptors section                          |
 // |`PHANTASMA_HTTPCLIENT`   | `phantasma::HttpClient`   |                     | See HTTP and Adaptors section                          |
+// |`PHANTASMA_ASYNC_HTTPCLIENT`|`phantasma::AsyncHttpClient`|                  | See HTTP and Asynchronous API sections                 |
 //
 // The behavior of this header can further be modified by using the following 
 //  `#defines` (BEFORE including `phantasma.h`)
@@ -55,6 +58,10 @@
 // |`PHANTASMA_LITERAL(x)`                         | See Unicode section     |
 // |`PHANTASMA_FUNCTION`                           | See Integration section |        
 // |`PHANTASMA_IMPLEMENTATION`                     | See Integration section |
+// |`PHANTASMA_SIMD_DISABLE`                       | See JSON section        |
+// |`PHANTASMA_RPC_STRINGVIEW`                     | See String views section|
+// |`PHANTASMA_PMR`                                | See Allocators section  |
+// |`PHANTASMA_INT128_DISABLE`                     | See Extended usage      |
 //
 //------------------------------------------------------------------------------
 // Integration
@@ -125,7 +132,9 @@
 // |----------|--------------|-------------------------------------|-----------------------------------------|
 // |C++ REST  | HTTP + JSON  | `Adapters/PhantasmaAPI_cpprest.h`   | https://github.com/microsoft/cpprestsdk |
 // |libcurl   | HTTP         | `Adapters/PhantasmaAPI_curl.h`      | https://curl.haxx.se/libcurl/           |
+// |epoll     | HTTP         | `Adapters/PhantasmaAPI_epoll.h`     | (built-in, Linux only, no TLS)          |
 // |RapidJSON | JSON         | `Adapters/PhantasmaAPI_rapidjson.h` | http://rapidjson.org/                   |
+// |Tape JSON | JSON         | `Adapters/PhantasmaAPI_tapejson.h`  | (built-in, no external dependency)      |
 // |Sodium    | Cryptography | `Adapters/PhantasmaAPI_sodium.h`    | https://libsodium.org                   |
 //
 //------------------------------------------------------------------------------
@@ -135,14 +144,24 @@
 //  as simple as possible (approx 200 lines of code) and is not high-performance
 //  or highly robust.
 //
+// On x86-64, the built-in parser scans the bodies of strings 16 bytes at a
+//  time (SSE2). Define `PHANTASMA_SIMD_DISABLE` to use the portable
+//  byte-at-a-time scanner instead. The JsonScanBenchmark sample compares it
+//  with the other scanners on block payloads.
+//
 // It is recommended that you supply another JSON-parsing API, by defining the
 //  following macros before including `phantasma.h`:
 //  `#define PHANTASMA_JSONVALUE    Your_Json_Value_Type`
 //  `#define PHANTASMA_JSONARRAY    Your_Json_Array_Type`
+//  `#define PHANTASMA_JSONARRAYCURSOR Your_Json_Array_Iterator_Type` (optional)
+//  `#define PHANTASMA_JSONOBJECTCURSOR Your_Json_Object_Iterator_Type` (optional)
 //  `#define PHANTASMA_JSONDOCUMENT Your_JSON_Document_Type`
 //  `#define PHANTASMA_JSONBUILDER  Your_Json_Serializer_Type`
 //
-// **The CPP REST and RapidJSON adaptors implement these macros.**
+// **The CPP REST, RapidJSON and Tape JSON adaptors implement these macros.**
+//
+// The Tape JSON adaptor tokenizes each response once, making field lookups and
+//  array indexing far cheaper than the built-in parser on large responses.
 //
 // Also, this header uses the following procedural API to interact with these types.
 // If you have supplied your own JSON types, you must implement the following functions:
@@ -171,12 +190,41 @@
 //        int       ArraySize(    const JSONArray&,                    bool& out_error);
 //        JSONValue IndexArray(   const JSONArray&, int index,         bool& out_error);
 //     
+//        JSONArrayCursor ArrayBegin(const JSONArray&,                 bool& out_error);
+//        bool      ArrayValid(   const JSONArrayCursor&,              bool& out_error);
+//        void      ArrayNext(    JSONArrayCursor&,                    bool& out_error);
+//        JSONValue ArrayValue(   const JSONArrayCursor&,              bool& out_error);
+//     
+//        JSONObjectCursor ObjectBegin(const JSONValue&,               bool& out_error);
+//        bool      ObjectValid(  const JSONObjectCursor&,             bool& out_error);
+//        void      ObjectNext(   JSONObjectCursor&,                   bool& out_error);
+//        const Char* ObjectKey(  const JSONObjectCursor&, size_t& out_length, bool& out_error);
+//        JSONValue ObjectValue(  const JSONObjectCursor&,             bool& out_error);
+//     
 //                               void BeginObject(JSONBuilder&);
 //                               void AddString  (JSONBuilder&, const Char* key, const Char* value);
 //       template<class... Args> void AddArray   (JSONBuilder&, const Char* key, Args...);
 //                               void EndObject  (JSONBuilder&);
+//                               void BeginArray (JSONBuilder&);
+//                               void EndArray   (JSONBuilder&);
 //     }}
 //
+// The Array* cursor functions are used to walk arrays from front to back in
+//  linear time. If you don't define `PHANTASMA_JSONARRAYCURSOR`, they are
+//  implemented for you on top of ArraySize/IndexArray.
+//
+// The Object* cursor functions walk the members of an object in document 
+//  order. The RPC structures are deserialized in a single pass over their 
+//  members, which are matched to fields by a hash of the key. If JSONValue is 
+//  a reference type, ObjectValue must return a reference into the document.
+//  If you don't define `PHANTASMA_JSONOBJECTCURSOR`, they are implemented for
+//  you on top of HasField/LookupValue, which look up each field of the RPC
+//  structure by name instead. If you do define it, declare ObjectBegin before
+//  including this header.
+//
+// BeginArray/EndArray wrap a sequence of BeginObject..EndObject calls in a JSON
+//  array, which is used to send batches of requests (see Batches).
+//
 //------------------------------------------------------------------------------
 // HTTP
 //------------------------------------------------------------------------------
@@ -188,7 +236,7 @@
 //  including `phantasma.h`:
 // `#define PHANTASMA_HTTPCLIENT   Your_HTTP_Client_Type`
 //
-// **The CPP REST and libcurl adaptors implement this macro.**
+// **The CPP REST, libcurl and epoll adaptors implement this macro.**
 //
 // Also, this header uses the following procedural API to interact with this type.
 // If you have defined `PHANTASMA_HTTPCLIENT`, you must implement the following,
@@ -198,6 +246,195 @@
 //      JSONDocument HttpPost(HttpClient&, const Char* uri, const JSONBuilder&, PhantasmaError* out_error);
 //     }
 //
+// To stream large responses with `Utils/RpcStream.h`, the client must also
+//  implement the following, which should pass the response body to `write` as
+//  it arrives (a short return from `write` should abort the request):
+//
+//     namespace phantasma {
+//      void HttpPostStream(HttpClient&, const Char* uri, const JSONBuilder&, 
+//                          size_t(*write)(char*, size_t, size_t, void* userp), void* userp, PhantasmaError* out_error);
+//     }
+//
+// **The libcurl adaptor implements this function.**
+//
+// To enable the `AsyncPhantasmaAPI` class, define the following macro before 
+//  including `phantasma.h`:
+// `#define PHANTASMA_ASYNC_HTTPCLIENT   Your_Async_HTTP_Client_Type`
+//
+// and implement the following function, which should start a HTTP POST request
+//  and return without waiting for the response. Once the request completes, it
+//  must call `onComplete` exactly once, with the parsed response, or with a null
+//  response and an error message:
+//
+//     namespace phantasma {
+//      void HttpPostAsync(AsyncHttpClient&, const Char* uri, const JSONBuilder&, 
+//                         std::function<void(const JSONDocument* response, const Char* error)> onComplete);
+//     }
+//
+// **The CPP REST, libcurl (`CurlMultiClient`) and epoll adaptors implement this function.**
+//
+// To spread calls over several nodes, `Utils/NodePool.h` wraps the HttpClients
+//  of several nodes. It routes each call to the fastest healthy node, and can
+//  hedge slow calls by also sending them to a second node.
+//
+// `Utils/ResponseCache.h` provides `CachedPhantasmaAPI`, which keeps the parsed
+//  results of calls that rarely change (chains, tokens, the nexus, contracts)
+//  for a time-to-live, and of blocks permanently, in a size-limited LRU cache.
+//
+// `Utils/BlockRangeFetcher.h` fetches a range of blocks over several
+//  connections at once, optionally as JSON-RPC batches, and delivers them in
+//  height order with a bounded look-ahead window.
+//
+// `Utils/PaginatedFetcher.h` does the same for the pages of paginated calls
+//  (`AddressTransactionsFetcher`, `AuctionsFetcher`), reading the number of
+//  pages from the first response.
+//
+// `Utils/BlockStore.h` keeps raw blocks on disk, in append-only segment files
+//  with an index by height, so that a chain can be re-indexed without fetching
+//  it again. The stored blocks are memory-mapped, and `BlockView` reads them in
+//  place, without copying or allocating.
+//
+//------------------------------------------------------------------------------
+// String views
+//------------------------------------------------------------------------------
+// By default, every string field of the RPC structures (`rpc::Block`, 
+//  `rpc::Transaction`, etc) is a `String` that owns a copy of its text.
+// Read-only consumers can avoid these allocations by defining the following
+//  before including `phantasma.h`:
+//
+// `#define PHANTASMA_RPC_STRINGVIEW`
+//
+// The string fields then become `RpcString` (`std::basic_string_view<Char>`), 
+//  which point into the JSON document that they were parsed from, so that 
+//  document must outlive the RPC structures.
+// The `PhantasmaAPI` methods take a `ResponseArena&` as their first argument, 
+//  which keeps each response document alive until the arena is cleared:
+//
+//     ResponseArena arena;
+//     Block block = phantasmaAPI.GetBlockByHeight(arena, chainInput, height, error);
+//
+// Your JSON library must also implement the following function, which returns
+//  a view that lives as long as the JSON document:
+//
+//     namespace phantasma { namespace json {
+//        StringView AsStringView(const JSONValue&, bool& out_error);
+//     }}
+//
+// **The built-in parser, RapidJSON and Tape JSON adaptors implement this function.**
+//
+// The helpers in `Utils/RpcUtils.h` require owning strings.
+//
+//------------------------------------------------------------------------------
+// Allocators
+//------------------------------------------------------------------------------
+// By default, the RPC structures are deserialized onto the global heap.
+// To allocate them from a C++17 `std::pmr::memory_resource` instead, such as a
+//  `std::pmr::monotonic_buffer_resource`, define the following before including
+//  `phantasma.h`:
+//
+// `#define PHANTASMA_PMR`
+//
+// The array fields then become `RpcVector<T>` (`std::pmr::vector<T>`), and the
+//  string fields become `RpcString` (`std::pmr::basic_string<Char>`, unless 
+//  `PHANTASMA_RPC_STRINGVIEW` is also defined).
+// The memory resource is selected for the calling thread by a `RpcMemoryScope`:
+//
+//     std::pmr::monotonic_buffer_resource arena;
+//     Block block;
+//     {
+//        RpcMemoryScope scope(&arena);
+//        PhantasmaJsonAPI::ParseGetBlockByHeightResponse(json::Parse(doc), block, &err);
+//     }
+//
+// Everything beneath the top-level output object is allocated from the arena,
+//  so the output must be destroyed before the arena is.
+// The RpcArenaBenchmark sample counts the heap allocations of a block of 5000
+//  transactions with and without an arena.
+// Your JSON library must implement `json::AsStringView` (see String views).
+//
+//------------------------------------------------------------------------------
+// Projections
+//------------------------------------------------------------------------------
+// If you only need a few fields of a large response, pass a `RpcProjection` to
+//  the `PhantasmaJsonAPI::Parse*Response` functions. For each type of RPC 
+//  structure, it holds a mask of the fields to deserialize, built from the
+//  constants in the `fields` namespace. All fields are selected by default.
+//
+//     RpcProjection projection;
+//     projection.Select<fields::Transaction>(fields::Transaction::hash | fields::Transaction::events)
+//               .Select<fields::Event>(fields::Event::kind | fields::Event::address | fields::Event::data);
+//     PhantasmaJsonAPI::ParseGetBlockByHeightResponse(json::Parse(doc), block, &err, &projection);
+//
+// Fields that are not selected are never looked up in the JSON document, so 
+//  their values are not decoded, copied or allocated, and are left empty / zero.
+//
+//------------------------------------------------------------------------------
+// Lazy deserialization
+//------------------------------------------------------------------------------
+// `LazyBlock` and `LazyTransaction` mirror `Block` and `Transaction`, except 
+//  that their nested arrays are `LazyArray<T>` values, which keep a reference
+//  to the unparsed JSON array and only deserialize it on first access. This 
+//  lets you skim a response (e.g. check `block.height`) without paying for 
+//  the transactions that it contains:
+//
+//     LazyBlock block;
+//     PhantasmaJsonAPI::ParseLazyResponse(json::Parse(doc), block, &err);
+//     if( block.height > lastHeight )
+//        for( const LazyTransaction& tx : block.txs.Get() )
+//           ...
+//
+// `ParseLazyResponse` accepts the response of any method that returns a Block 
+//  or Transaction. The JSON document must outlive the lazy structures.
+//
+// If an array is malformed, `Get(jsonError)` returns an empty vector and sets
+//  `jsonError`, on that call and every later one, and `Failed()` returns true.
+//
+//------------------------------------------------------------------------------
+// Batches
+//------------------------------------------------------------------------------
+// Each `PhantasmaAPI` method sends one HTTP request. To fetch many items in 
+//  fewer round trips, queue the requests in a `RpcBatch`, which are then sent 
+//  as JSON-RPC 2.0 batches of up to `maxSize` requests per HTTP POST:
+//
+//     RpcBatch batch(100);
+//     Block blocks[1000];
+//     PhantasmaError errors[1000];
+//     for( UInt32 i = 0; i != 1000; ++i )
+//        batch.Add(&PhantasmaJsonAPI::MakeGetBlockByHeightRequest, &PhantasmaJsonAPI::ParseGetBlockByHeightResponse, 
+//                  blocks[i], &errors[i], chainInput, first + i);
+//     phantasmaAPI.Send(batch, &error);
+//
+// Each request is given its position in the batch as its JSON-RPC id, and each
+//  element of the response is passed to its Parse*Response function by id, so
+//  the node may answer out of order. `error` reports the first failure of the
+//  HTTP requests themselves, and each output's error reports its own result.
+//  If a HTTP request fails, the rest are still sent, and only the requests of
+//  the failed one get its error.
+// The arguments, outputs and errors must remain valid until the batch is sent.
+//
+// Without a HTTP client, use `PhantasmaJsonAPI::MakeBatchRequest` and 
+//  `PhantasmaJsonAPI::ParseBatchResponse` for each of `batch.Batches()`.
+//
+//------------------------------------------------------------------------------
+// Asynchronous API
+//------------------------------------------------------------------------------
+// The methods of `AsyncPhantasmaAPI` mirror those of `PhantasmaAPI`, except that
+//  they return as soon as the request has been sent, and pass the result to a
+//  callback when the response arrives. A single thread can therefore keep many
+//  requests in flight at once:
+//
+//     AsyncPhantasmaAPI asyncAPI(asyncHttpClient);
+//     for( UInt32 height = first; height != last; ++height )
+//        asyncAPI.GetBlockByHeight(chainInput, height, [](Block& block, PhantasmaError& error)
+//        {
+//           ...
+//        });
+//
+// The callbacks are invoked by the HTTP client: on one of its worker threads
+//  (CPP REST), or from within its event loop (see `CurlMultiClient`). With 
+//  `PHANTASMA_RPC_STRINGVIEW`, the output's strings are only valid until the 
+//  callback returns.
+//
 //------------------------------------------------------------------------------
 // Extended/Advanced usage
 //------------------------------------------------------------------------------
@@ -213,11 +450,17 @@
 //  |Directory     | Features                                                              |
 //  |--------------|-----------------------------------------------------------------------|
 //  | Adapters     | Configuration for this library to communicate with 3rd party libraries|
-//  | Blockchain   | Transactions                                                          |
+//  | Blockchain   | Transactions, blocks decoded from GetRawBlockByHeight/ByHash          |
 //  | Cryptography | Public/Private keys, Signatures, Random numbers, Encryption           |
-//  | Numerics     | N-bit integer implementation. Base 16/58 ASCII encoding.              |
+//  | Numerics     | N-bit and fixed 256-bit integers. Base 16/58 ASCII encoding.          |
 //  | Security     | Practical memory protection.                                          |
 //
+// On compilers with a 128-bit integer type (GCC and Clang on 64-bit targets),
+//  BigInteger multiplies 64 bits at a time. Define `PHANTASMA_INT128_DISABLE` to
+//  use the portable 32-bit code instead. Large products use Karatsuba's method.
+//  Powers of 10 and 58 up to 79 are computed once and shared, see
+//  `BigInteger::CachedPow<Base>(exponent)`.
+//
 //------------------------------------------------------------------------------
 // - Extended/Advanced usage - Security configuration
 //------------------------------------------------------------------------------
@@ -270,6 +513,18 @@
 # include <string_view>
 #endif
 
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+# include <string_view>
+#endif
+
+#if defined(PHANTASMA_RPC_STRINGVIEW)
+# include <deque>
+#endif
+
+#if defined(PHANTASMA_PMR)
+# include <memory_resource>
+#endif
+
 #if !defined(PHANTASMA_JSONBUILDER) || !defined(PHANTASMA_STRINGBUILDER)
 # include <sstream>
 #endif
@@ -288,10 +543,29 @@
 # include <cstdint>
 #endif
 
+#if !defined(PHANTASMA_STRLEN)
+# ifdef _UNICODE
+#  include <cwchar>
+# else
+#  include <cstring>
+# endif
+#endif
+
+#include <type_traits>
+#include <functional>
+
 #if !defined(PHANTASMA_MAX) || !defined(PHANTASMA_COPY) || !defined(PHANTASMA_EQUAL) || !defined(PHANTASMA_SWAP)
 # include <algorithm>
 #endif
 
+#if !defined(PHANTASMA_JSONVALUE) && !defined(PHANTASMA_SIMD_DISABLE) && (defined(__x86_64__) || defined(_M_X64))
+# define PHANTASMA_SIMD_X64
+# include <immintrin.h>
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+#endif
+
 #if defined(_UNICODE) && !defined(PHANTASMA_EXCEPTION) && defined(PHANTASMA_EXCEPTION_ENABLE)
 # include <locale>
 # include <codecvt>
@@ -433,6 +707,40 @@ typedef std::string String;
 # endif
 #endif
 
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+typedef std::basic_string_view<Char> StringView;
+#endif
+
+#if defined(PHANTASMA_RPC_STRINGVIEW)
+typedef StringView RpcString;
+#elif defined(PHANTASMA_PMR)
+typedef std::pmr::basic_string<Char> RpcString;
+#else
+typedef String RpcString;
+#endif
+
+#ifdef PHANTASMA_PMR
+template<class T> using RpcVector = std::pmr::vector<T>;
+
+inline std::pmr::memory_resource*& RpcMemoryResourceSlot() { static thread_local std::pmr::memory_resource* resource = nullptr; return resource; }
+inline std::pmr::memory_resource*  RpcMemoryResource() { std::pmr::memory_resource* r = RpcMemoryResourceSlot(); return r ? r : std::pmr::get_default_resource(); }
+
+class RpcMemoryScope // RPC structures deserialized on this thread are allocated from `resource` until the scope ends
+{
+public:
+	explicit RpcMemoryScope(std::pmr::memory_resource* resource) : m_previous(RpcMemoryResourceSlot()) { RpcMemoryResourceSlot() = resource; }
+	~RpcMemoryScope() { RpcMemoryResourceSlot() = m_previous; }
+	RpcMemoryScope(const RpcMemoryScope&) = delete;
+	RpcMemoryScope& operator=(const RpcMemoryScope&) = delete;
+private:
+	std::pmr::memory_resource* m_previous;
+};
+# define PHANTASMA_RPC_ALLOC RpcMemoryResource()
+#else
+template<class T> using RpcVector = PHANTASMA_VECTOR<T>;
+# define PHANTASMA_RPC_ALLOC
+#endif
+
 #ifdef PHANTASMA_STRINGBUILDER
 typedef PHANTASMA_STRINGBUILDER StringBuilder;
 #else
@@ -461,6 +769,37 @@ typedef PHANTASMA_JSONARRAY JSONArray;
 typedef JSONValue JSONArray;
 #endif
 
+#ifdef PHANTASMA_JSONARRAYCURSOR
+typedef PHANTASMA_JSONARRAYCURSOR JSONArrayCursor;
+#else
+struct JSONArrayCursor
+{
+	const JSONArray* array;
+	size_t position; // built-in parser: offset of the current element. Otherwise: index of the current element
+	size_t size;     // number of elements (unused by the built-in parser)
+};
+#endif
+
+#ifdef PHANTASMA_JSONOBJECTCURSOR
+typedef PHANTASMA_JSONOBJECTCURSOR JSONObjectCursor;
+#elif !defined(PHANTASMA_JSONVALUE)
+struct JSONObjectCursor // built-in parser
+{
+	const JSONValue* object;
+	size_t keyBegin;   // offset of the current key's text, or npos after the last member
+	size_t keyEnd;
+	size_t valueBegin;
+};
+#else
+struct JSONObjectCursor // JSON libraries that only supply HasField/LookupValue
+{
+	const std::remove_reference<JSONValue>::type* object;
+	const Char* const* keys; // the fields of the RPC structure that is being deserialized
+	int numKeys;
+	int index;               // of the current key, or numKeys after the last one
+};
+#endif
+
 #ifdef PHANTASMA_JSONDOCUMENT
 typedef PHANTASMA_JSONDOCUMENT JSONDocument;
 #else
@@ -482,10 +821,12 @@ struct JSONBuilder // A VERY simple json string builder. Highly recommended that
 	template<class T> void AddValues(T arg) { s << arg; }
 	template<class T, class... Args> void AddValues(T arg0, Args... args) { AddValues(arg0); s << ", "; AddValues(args...); }
 	
-	void BeginObject() { s << "{"; }
+	void BeginObject() { if(!empty) { s << ", "; } empty = true; s << "{"; }
 	void AddString(const Char* key, const Char* value) { AddKey(key); s << '"' << value << '"'; }
 	template<class... Args> void AddArray(const Char* key, Args... args) { AddKey(key); s << '['; AddValues(args...); s << ']'; }
-	void EndObject() { s << "}"; }
+	void EndObject() { s << "}"; empty = false; }
+	void BeginArray() { s << "["; empty = true; }
+	void EndArray() { s << "]"; empty = false; }
 };
 #endif
 
@@ -494,6 +835,32 @@ typedef PHANTASMA_HTTPCLIENT HttpClient;
 //JSONDocument HttpPost(HttpClient&, const Char* uri, const JSONBuilder&, PhantasmaError* out_error);
 #endif
 
+#ifdef PHANTASMA_ASYNC_HTTPCLIENT
+typedef PHANTASMA_ASYNC_HTTPCLIENT AsyncHttpClient;
+typedef std::function<void(const JSONDocument* response, const Char* error)> HttpResponseCallback;
+//void HttpPostAsync(AsyncHttpClient&, const Char* uri, const JSONBuilder&, HttpResponseCallback onComplete);
+#endif
+
+#ifdef PHANTASMA_RPC_STRINGVIEW
+class ResponseArena // Owns the JSON documents that RpcString fields point into
+{
+public:
+	template<class Document> // JSONDocument& or JSONDocument&&, which is left empty
+	const JSONDocument& Keep(Document&& document) { m_documents.emplace_back(); PHANTASMA_SWAP(m_documents.back(), document); return m_documents.back(); }
+	void   Clear()       { m_documents.clear(); }
+	size_t Size() const  { return m_documents.size(); }
+private:
+	std::deque<JSONDocument> m_documents; // a deque never relocates its elements, so views remain valid as documents are added
+};
+# define PHANTASMA_ARENA_PARAM          ResponseArena& arena,
+# define PHANTASMA_ARENA_ARG            arena,
+# define PHANTASMA_ARENA_KEEP(document) arena.Keep(document)
+#else
+# define PHANTASMA_ARENA_PARAM
+# define PHANTASMA_ARENA_ARG
+# define PHANTASMA_ARENA_KEEP(document) document
+#endif
+
 //If providing a JSON library (highly recommended that you do!), then you must provide these functions yourself:
 namespace json
 {
@@ -523,7 +890,65 @@ namespace json
 	template<class... Args>
 	void AddArray(JSONBuilder&, const Char* key, Args... args);
 	void EndObject(JSONBuilder&);
+	void BeginArray(JSONBuilder&);
+	void EndArray(JSONBuilder&);
+# if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+	StringView AsStringView(const JSONValue&, bool& out_error);
+# endif
+#endif
+#ifndef PHANTASMA_JSONARRAYCURSOR
+	JSONArrayCursor ArrayBegin(const JSONArray&, bool& out_error);
+	bool ArrayValid(const JSONArrayCursor&, bool& out_error);
+	void ArrayNext(JSONArrayCursor&, bool& out_error);
+	JSONValue ArrayValue(const JSONArrayCursor&, bool& out_error);
+#endif
+#ifndef PHANTASMA_JSONOBJECTCURSOR
+# ifdef PHANTASMA_JSONVALUE
+	JSONObjectCursor ObjectBegin(const JSONValue&, const Char* const* keys, int numKeys, bool& out_error);
+# else
+	JSONObjectCursor ObjectBegin(const JSONValue&, bool& out_error);
+# endif
+	bool ObjectValid(const JSONObjectCursor&, bool& out_error);
+	void ObjectNext(JSONObjectCursor&, bool& out_error);
+	const Char* ObjectKey(const JSONObjectCursor&, size_t& out_length, bool& out_error);
+	JSONValue ObjectValue(const JSONObjectCursor&, bool& out_error);
 #endif
+#if defined(PHANTASMA_JSONOBJECTCURSOR) || !defined(PHANTASMA_JSONVALUE)
+	// The Deserialize functions pass the keys of the RPC structure, which only the HasField/LookupValue cursor uses
+	inline JSONObjectCursor ObjectBegin(const JSONValue& v, const Char* const*, int, bool& out_error) { return ObjectBegin(v, out_error); }
+#endif
+#if defined(PHANTASMA_RPC_STRINGVIEW)
+	inline RpcString AsRpcString(    const JSONValue& v,                    bool& out_error) { return AsStringView(v, out_error); }
+	inline RpcString LookupRpcString(const JSONValue& v, const Char* field, bool& out_error) { return AsStringView(LookupValue(v, field, out_error), out_error); }
+#elif defined(PHANTASMA_PMR)
+	inline RpcString AsRpcString(    const JSONValue& v,                    bool& out_error) { return RpcString(AsStringView(v, out_error), RpcMemoryResource()); }
+	inline RpcString LookupRpcString(const JSONValue& v, const Char* field, bool& out_error) { return RpcString(AsStringView(LookupValue(v, field, out_error), out_error), RpcMemoryResource()); }
+#else
+	inline RpcString AsRpcString(    const JSONValue& v,                    bool& out_error) { return AsString(v, out_error); }
+	inline RpcString LookupRpcString(const JSONValue& v, const Char* field, bool& out_error) { return LookupString(v, field, out_error); }
+#endif
+
+	// FNV-1a hash of an object key. Field names are hashed at compile time, so a collision between two fields of a structure is a compile error
+	constexpr uint32_t KeyHash(const Char* key, size_t length, uint32_t hash = 2166136261u) { return length ? KeyHash(key+1, length-1, (hash ^ (uint32_t)key[0]) * 16777619u) : hash; }
+	template<size_t N> constexpr uint32_t KeyHash(const Char (&name)[N]) { return KeyHash(name, N-1); }
+	template<size_t N> inline bool KeyEquals(const Char* key, size_t length, const Char (&name)[N]) { return length == N-1 && 0 == std::char_traits<Char>::compare(key, name, N-1); }
+
+	// Stores a JSONValue, which may be a reference into its document, so it can be read after the expression that produced it
+	class JSONSlot
+	{
+		typedef typename std::remove_reference<JSONValue>::type Value;
+		typedef typename std::conditional<std::is_reference<JSONValue>::value, const Value*, Value>::type Stored;
+	public:
+		JSONSlot() {}
+		JSONSlot(const JSONValue& v) : m_value(ToStored(v, std::is_reference<JSONValue>())) {}
+		const Value& Get() const { return FromStored(m_value); }
+	private:
+		static const Value* ToStored(const Value& v, std::true_type)  { return &v; }
+		static const Value& ToStored(const Value& v, std::false_type) { return v; }
+		static const Value& FromStored(const Value* v) { static const Value empty{}; return v ? *v : empty; }
+		static const Value& FromStored(const Value& v) { return v; }
+		Stored m_value{};
+	};
 }
 
 namespace rpc
@@ -541,12 +966,156 @@ struct {{#fix-type Key}}{{#parse-lines false}}{{#new-line}}
 {
 {{#new-line}}
 {{#each Value}}
-	{{#if FieldType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix-type FieldType.Name}}{{#if FieldType.IsArray}}>{{/if}} {{Name}};//{{Key.Description}}
+	{{#if FieldType.Name=='String'}}RpcString{{#else}}{{#if FieldType.IsArray}}RpcVector<{{/if}}{{#if FieldType.Name=='String[]'}}RpcString{{#else}}{{#fix-type FieldType.Name}}{{/if}}{{#if FieldType.IsArray}}>{{/if}}{{/if}} {{Name}};//{{Key.Description}}
 {{#new-line}}
 {{/each}}
 {{#parse-lines true}}};
 {{/each}}
 
+//------------------------------------------------------------------------------
+// Projections:
+//------------------------------------------------------------------------------
+typedef uint64_t FieldMask;
+
+enum class RpcType
+{
+	{{#each types}}{{#fix-type Key}},
+	{{/each}}Count
+};
+
+// Bit masks for the fields of each RPC structure, e.g. fields::Transaction::hash
+namespace fields
+{
+{{#each types}}struct {{#fix-type Key}}
+{
+	enum Index { {{#each Value}}{{Name}}_index, {{/each}}Count };
+	enum : FieldMask { {{#each Value}}{{Name}} = FieldMask(1) << {{Name}}_index, {{/each}}All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::{{#fix-type Key}};
+	static const Char* const* Keys() { static const Char* const keys[] = { {{#each Value}}PHANTASMA_LITERAL("{{Name}}"), {{/each}}}; return keys; }
+};
+{{/each}}
+}
+
+// Selects the fields that are deserialized for each type of RPC structure.
+//  All fields are selected by default. Fields that are not selected are never
+//  looked up in the JSON, and are left empty / zero.
+class RpcProjection
+{
+public:
+	RpcProjection() { for( FieldMask& mask : m_masks ) mask = ~FieldMask(0); }
+
+	template<class Fields> RpcProjection& Select(FieldMask mask) { m_masks[(int)Fields::rpcType] = mask; return *this; }
+	FieldMask Mask(RpcType type) const { return m_masks[(int)type]; }
+private:
+	FieldMask m_masks[(int)RpcType::Count];
+};
+
+//------------------------------------------------------------------------------
+// Lazy RPC structures:
+//------------------------------------------------------------------------------
+// A nested array that is kept as an unparsed JSON value, and only deserialized
+//  when it is first accessed. The JSON document must outlive this object.
+template<class T> class LazyArray
+{
+public:
+	typedef T (*Deserializer)(const JSONValue&, bool& jsonError, const RpcProjection* projection);
+
+	LazyArray() {}
+	LazyArray(const JSONValue& array, Deserializer deserialize, const RpcProjection* projection)
+		: m_json(array)
+		, m_deserialize(deserialize)
+		, m_projection(projection)
+	{}
+
+	bool Loaded() const { return !m_deserialize; }
+	// The JSON array could not be deserialized
+	bool Failed() const { return m_failed; }
+
+	// Number of elements, without deserializing them
+	int Size(bool& jsonError) const
+	{
+		if( Loaded() )
+			return (int)m_items.size();
+		return json::ArraySize(json::AsArray(m_json.Get(), jsonError), jsonError);
+	}
+
+	// Deserializes the elements on the first call. If the JSON is malformed, the
+	//  result is empty and jsonError is set, on this call and every later one.
+	const RpcVector<T>& Get(bool& jsonError) const
+	{
+		if( m_failed )
+			jsonError = true;
+		if( Loaded() || m_failed )
+			return m_items;
+		bool error = false;
+		const JSONArray& array = json::AsArray(m_json.Get(), error);
+		m_items.reserve(json::ArraySize(array, error));
+		for(JSONArrayCursor it = json::ArrayBegin(array, error); json::ArrayValid(it, error); json::ArrayNext(it, error))
+		{
+			m_items.push_back(m_deserialize(json::ArrayValue(it, error), error, m_projection));
+		}
+		if( error )
+		{
+			m_items.clear();
+			m_failed = true;
+			jsonError = true;
+			return m_items;
+		}
+		m_deserialize = nullptr;
+		return m_items;
+	}
+	// As above, but the error is reported with PHANTASMA_EXCEPTION, or by Failed()
+	const RpcVector<T>& Get() const
+	{
+		bool jsonError = false;
+		const RpcVector<T>& items = Get(jsonError);
+		if( jsonError )
+		{
+			PHANTASMA_EXCEPTION("Malformed JSON in a lazy array");
+		}
+		return items;
+	}
+private:
+	json::JSONSlot       m_json;
+	mutable Deserializer m_deserialize = nullptr;
+	const RpcProjection* m_projection = nullptr;
+	mutable RpcVector<T> m_items{PHANTASMA_RPC_ALLOC};
+	mutable bool         m_failed = false;
+};
+
+// As Transaction, but events and signatures are deserialized on first access
+struct LazyTransaction
+{
+	RpcString hash;
+	RpcString chainAddress;
+	UInt32 timestamp;
+	Int32 blockHeight;
+	RpcString blockHash;
+	RpcString script;
+	RpcString payload;
+	LazyArray<Event> events;
+	RpcString result;
+	RpcString fee;
+	LazyArray<Signature> signatures;
+	UInt32 expiration;
+};
+
+// As Block, but txs, events and oracles are deserialized on first access
+struct LazyBlock
+{
+	RpcString hash;
+	RpcString previousHash;
+	UInt32 timestamp;
+	UInt32 height;
+	RpcString chainAddress;
+	UInt32 protocol;
+	LazyArray<LazyTransaction> txs;
+	RpcString validatorAddress;
+	RpcString reward;
+	LazyArray<Event> events;
+	LazyArray<Oracle> oracles;
+};
+
 //------------------------------------------------------------------------------
 // Low level RPC API:
 //------------------------------------------------------------------------------
@@ -566,6 +1135,86 @@ inline void OnHttpError(PhantasmaError& err, const Char* msg)
 	if( msg )
 		err.message = String(msg);
 }
+// True for errors that indicate a problem with the node or the connection to it, rather than a response from it,
+//  so the request may succeed if it is sent again, or to another node
+inline bool IsTransientError(const PhantasmaError& err)
+{
+	return err.code == PhantasmaError::HttpError
+	    || err.code == PhantasmaError::InvalidJSON
+	    || err.code == PhantasmaError::InvalidRpcResponse;
+}
+
+class RpcBatch // Queues requests to be sent as JSON-RPC 2.0 batches, see PhantasmaAPI::Send
+{
+public:
+	RpcBatch(int maxSize = 100, const RpcProjection* projection = 0)
+		: m_maxSize(maxSize > 0 ? maxSize : 1)
+		, m_projection(projection)
+	{}
+
+	// Queues a request that is made by a PhantasmaJsonAPI::Make*Request function and whose response is parsed into
+	//  output by the matching Parse*Response function. The arguments, output and error must outlive the batch.
+	template<class Output, class... Params, class... Args>
+	void Add(void(*make)(JSONBuilder&, Params...), bool(*parse)(const JSONValue&, Output&, PhantasmaError*, const RpcProjection*), 
+	         Output& output, PhantasmaError* out_error, Args... args)
+	{
+		const RpcProjection* projection = m_projection;
+		Request request;
+		request.make  = [=](JSONBuilder& builder, const Char* id) { make(builder, args..., id); };
+		request.parse = [=, &output](const JSONValue& response, PhantasmaError* err) { parse(response, output, err, projection); };
+		request.error = out_error;
+		m_requests.push_back(std::move(request));
+	}
+
+	int  Size()    const { return (int)m_requests.size(); }
+	int  MaxSize() const { return m_maxSize; }
+	int  Batches() const { return (Size() + m_maxSize - 1) / m_maxSize; }
+	int  Begin(int batchIndex) const { return batchIndex * m_maxSize; }
+	int  End(  int batchIndex) const { return PHANTASMA_MIN(Begin(batchIndex) + m_maxSize, Size()); }
+	void Clear()         { m_requests.clear(); }
+
+	// Reports an error to every request within a batch, e.g. when its HTTP request failed
+	void Fail(int batchIndex, const PhantasmaError& error)
+	{
+		for( int i = Begin(batchIndex), end = End(batchIndex); i != end; ++i )
+			if( m_requests[i].error )
+				*m_requests[i].error = error;
+	}
+private:
+	friend class PhantasmaJsonAPI;
+	struct Request
+	{
+		std::function<void(JSONBuilder&, const Char* id)> make;
+		std::function<void(const JSONValue&, PhantasmaError*)> parse;
+		PhantasmaError* error = 0;
+		bool parsed = false;
+	};
+	PHANTASMA_VECTOR<Request> m_requests;
+	int m_maxSize;
+	const RpcProjection* m_projection;
+
+	constexpr static int IdLength = 12;
+	static const Char* FormatId(Char (&buffer)[IdLength], int index)
+	{
+		Char* c = buffer + IdLength - 1;
+		*c = 0;
+		do { *--c = (Char)('0' + index % 10); index /= 10; } while( index );
+		return c;
+	}
+	static int ParseId(const String& id)
+	{
+		if( id.empty() || id.length() >= IdLength )
+			return -1;
+		int index = 0;
+		for( Char c : id )
+		{
+			if( c < '0' || c > '9' )
+				return -1;
+			index = index * 10 + (c - '0');
+		}
+		return index;
+	}
+};
 
 class PhantasmaJsonAPI
 {
@@ -573,18 +1222,31 @@ public:
 	static const Char* Uri() { return PHANTASMA_LITERAL("/rpc"); }
 
 	{{#each methods}}// {{Info.Description}} {{#if Info.IsPaginated==true}}(paginated call){{/if}}
-	static void Make{{Info.Name}}Request(JSONBuilder&{{#each Info.Parameters}}, {{#fix-ref Type.Name}} {{Name}}{{/each}});
-	static bool Parse{{Info.Name}}Response(const JSONValue&, {{#if Info.ReturnType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix-type Info.ReturnType.Name}}{{#if Info.ReturnType.IsArray}}>{{/if}}& out, PhantasmaError* err=0);
+	static void Make{{Info.Name}}Request(JSONBuilder&{{#each Info.Parameters}}, {{#fix-ref Type.Name}} {{Name}}{{/each}}, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool Parse{{Info.Name}}Response(const JSONValue&, {{#if Info.ReturnType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix-type Info.ReturnType.Name}}{{#if Info.ReturnType.IsArray}}>{{/if}}& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	{{/each}}
 
-private:
+	// Lazy variants of the responses that return a Block or Transaction, e.g. GetBlockByHeight or GetTransaction
+	static bool ParseLazyResponse(const JSONValue&, LazyBlock& out, PhantasmaError* err=0, const RpcProjection* projection=0);
+	static bool ParseLazyResponse(const JSONValue&, LazyTransaction& out, PhantasmaError* err=0, const RpcProjection* projection=0);
+
+	// The requests of one JSON-RPC 2.0 batch, in [0, batch.Batches()), and the routing of its response to each request's output
+	static void MakeBatchRequest(JSONBuilder&, const RpcBatch& batch, int batchIndex);
+	static bool ParseBatchResponse(const JSONValue&, RpcBatch& batch, int batchIndex, PhantasmaError* err=0);
+
+	// Reports the RPC error of a response, or returns its result. ParsePageInfo (Utils/PaginatedFetcher.h) uses it.
 	static JSONValue CheckResponse(JSONValue response, PhantasmaError& out_error);
-	{{#each types}}static {{#fix-type Key}} Deserialize{{#fix-type Key}}(const JSONValue& json, bool& jsonError);
+
+private:
+	friend class RpcStreamParser; // deserializes each streamed transaction and event (Utils/RpcStream.h)
+	{{#each types}}static {{#fix-type Key}} Deserialize{{#fix-type Key}}(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
 	{{/each}}
 
-	static TokenSeriesMode DeserializeTokenSeriesMode(const JSONValue& json, bool& jsonError);
-	static Int32 DeserializeInt32(const JSONValue& json, bool& jsonError);
-	static bool Deserializebool(const JSONValue& json, bool& jsonError);
+	static TokenSeriesMode DeserializeTokenSeriesMode(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Int32 DeserializeInt32(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static bool Deserializebool(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static LazyBlock DeserializeLazyBlock(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static LazyTransaction DeserializeLazyTransaction(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
 };
 
 #if defined(PHANTASMA_HTTPCLIENT)
@@ -599,59 +1261,96 @@ public:
 	{}
 
 	{{#each methods}}// {{Info.Description}} {{#if Info.IsPaginated==true}}(paginated call){{/if}}
-	{{#if Info.ReturnType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix-type Info.ReturnType.Name}}{{#if Info.ReturnType.IsArray}}>{{/if}} {{Info.Name}}({{#each Info.Parameters}}{{#fix-ref Type.Name}} {{Name}}, {{/each}}PhantasmaError* out_error = nullptr);
+	{{#if Info.ReturnType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix-type Info.ReturnType.Name}}{{#if Info.ReturnType.IsArray}}>{{/if}} {{Info.Name}}(PHANTASMA_ARENA_PARAM {{#each Info.Parameters}}{{#fix-ref Type.Name}} {{Name}}, {{/each}}PhantasmaError* out_error = nullptr);
 	{{/each}}
+
+	// Sends the requests that are queued in the batch, with one HTTP request per batch.MaxSize() requests
+	//  Every HTTP request is sent, even after one fails, and out_error reports the first failure
+	bool Send(PHANTASMA_ARENA_PARAM RpcBatch& batch, PhantasmaError* out_error = nullptr);
 private:
 	HttpClient& m_httpClient;
 };
 #endif
+
+#if defined(PHANTASMA_ASYNC_HTTPCLIENT)
+//------------------------------------------------------------------------------
+// Asynchronous RPC API:
+//------------------------------------------------------------------------------
+class AsyncPhantasmaAPI
+{
+public:
+	AsyncPhantasmaAPI(AsyncHttpClient& client) // client must have a longer lifetime than this API object
+		: m_httpClient(client)
+	{}
+
+	{{#each methods}}// {{Info.Description}} {{#if Info.IsPaginated==true}}(paginated call){{/if}}
+	void {{Info.Name}}({{#each Info.Parameters}}{{#fix-ref Type.Name}} {{Name}}, {{/each}}std::function<void({{#if Info.ReturnType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix-type Info.ReturnType.Name}}{{#if Info.ReturnType.IsArray}}>{{/if}}& output, PhantasmaError& error)> onComplete);
+	{{/each}}
+private:
+	AsyncHttpClient& m_httpClient;
+};
+#endif
 	
 #if defined(PHANTASMA_IMPLEMENTATION)
 //------------------------------------------------------------------------------
 // RPC API implementation details:
 //------------------------------------------------------------------------------
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::Deserializebool(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::Deserializebool(const JSONValue& value, bool& jsonErr, const RpcProjection*)
 {
 	return json::AsBool(value, jsonErr);
 }
 
-PHANTASMA_FUNCTION TokenSeriesMode PhantasmaJsonAPI::DeserializeTokenSeriesMode(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION TokenSeriesMode PhantasmaJsonAPI::DeserializeTokenSeriesMode(const JSONValue& value, bool& jsonErr, const RpcProjection*)
 {
 	return (TokenSeriesMode)json::AsInt32(value, jsonErr);
 }
 
-PHANTASMA_FUNCTION Int32 PhantasmaJsonAPI::DeserializeInt32(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Int32 PhantasmaJsonAPI::DeserializeInt32(const JSONValue& value, bool& jsonErr, const RpcProjection*)
 {
 	return json::AsInt32(value, jsonErr);
 }
 
 {{#each types}}
-PHANTASMA_FUNCTION {{#fix-type Key}} PhantasmaJsonAPI::Deserialize{{#fix-type Key}}(const JSONValue& value, bool& jsonErr)
-{ {{#parse-lines false}}
+PHANTASMA_FUNCTION {{#fix-type Key}} PhantasmaJsonAPI::Deserialize{{#fix-type Key}}(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ {{#parse-lines false}}{{#new-line}}
+	const FieldMask selected = projection ? projection->Mask(RpcType::{{#fix-type Key}}) : fields::{{#fix-type Key}}::All;{{#new-line}}
+	json::JSONSlot slot[fields::{{#fix-type Key}}::Count];{{#new-line}}
+	FieldMask found = 0;{{#new-line}}
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::{{#fix-type Key}}::Keys(), fields::{{#fix-type Key}}::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr)){{#new-line}}
+	{ {{#new-line}}
+		size_t keyLength = 0;{{#new-line}}
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);{{#new-line}}
+		switch( json::KeyHash(key, keyLength) ){{#new-line}}
+		{ {{#new-line}}
+{{#each Value}}
+		case json::KeyHash(PHANTASMA_LITERAL("{{Name}}")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("{{Name}}")) ) { slot[fields::{{#fix-type Key}}::{{Name}}_index] = json::ObjectValue(it, jsonErr); found |= fields::{{#fix-type Key}}::{{Name}}; } break;{{#new-line}}
+{{/each}}
+		}{{#new-line}}
+	}
 {{#each Value}}
 {{#if FieldType.Name=='String[]'}}{{#parse-lines true}}
-	PHANTASMA_VECTOR<{{#fix-type FieldType.Name}}> {{Name}}Vector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("{{Name}}"), jsonErr))
+	RpcVector<RpcString> {{Name}}Vector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::{{#fix-type Key}}::{{Name}}) && json::IsArray(slot[fields::{{#fix-type Key}}::{{Name}}_index].Get(), jsonErr))
 	{
-		const JSONArray& {{Name}}JsonArray = json::LookupArray(value, PHANTASMA_LITERAL("{{Name}}"), jsonErr);
+		const JSONArray& {{Name}}JsonArray = json::AsArray(slot[fields::{{#fix-type Key}}::{{Name}}_index].Get(), jsonErr);
 		int size = json::ArraySize({{Name}}JsonArray, jsonErr);
 		{{Name}}Vector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin({{Name}}JsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			{{Name}}Vector.push_back(json::AsString(json::IndexArray({{Name}}JsonArray, i, jsonErr), jsonErr));
+			{{Name}}Vector.push_back(json::AsRpcString(json::ArrayValue(it, jsonErr), jsonErr));
 		}
 	}{{#parse-lines false}}
 {{#else}}
 {{#if FieldType.Name contains '[]'}}{{#parse-lines true}}
-	PHANTASMA_VECTOR<{{#fix-type FieldType.Name}}> {{Name}}Vector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("{{Name}}"), jsonErr))
+	RpcVector<{{#fix-type FieldType.Name}}> {{Name}}Vector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::{{#fix-type Key}}::{{Name}}) && json::IsArray(slot[fields::{{#fix-type Key}}::{{Name}}_index].Get(), jsonErr))
 	{
-		const JSONArray& {{Name}}JsonArray = json::LookupArray(value, PHANTASMA_LITERAL("{{Name}}"), jsonErr);
+		const JSONArray& {{Name}}JsonArray = json::AsArray(slot[fields::{{#fix-type Key}}::{{Name}}_index].Get(), jsonErr);
 		int size = json::ArraySize({{Name}}JsonArray, jsonErr);
 		{{Name}}Vector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin({{Name}}JsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			{{Name}}Vector.push_back(Deserialize{{#fix-type FieldType.Name}}(json::IndexArray({{Name}}JsonArray, i, jsonErr), jsonErr));
+			{{Name}}Vector.push_back(Deserialize{{#fix-type FieldType.Name}}(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}{{#parse-lines false}}
 {{/if}}
@@ -661,25 +1360,25 @@ PHANTASMA_FUNCTION {{#fix-type Key}} PhantasmaJsonAPI::Deserialize{{#fix-type Ke
 	return {{#fix-type Key}} { {{#new-line}}
 {{#each Value}}
 {{#if FieldType.Name contains '[]'}}
-		{{Name}}Vector
+		std::move({{Name}}Vector)
 {{#else}}
 {{#if FieldType.Name=='Boolean'}}
-		json::LookupBool(value, PHANTASMA_LITERAL("{{Name}}"), jsonErr)
+		(selected & fields::{{#fix-type Key}}::{{Name}}) ? json::AsBool(slot[fields::{{#fix-type Key}}::{{Name}}_index].Get(), jsonErr) : false
 {{#else}}
 {{#if FieldType.Name=='UInt32'}}
-		json::LookupUInt32(value, PHANTASMA_LITERAL("{{Name}}"), jsonErr)
+		(selected & fields::{{#fix-type Key}}::{{Name}}) ? json::AsUInt32(slot[fields::{{#fix-type Key}}::{{Name}}_index].Get(), jsonErr) : 0
 {{#else}}
 {{#if FieldType.Name=='Int32'}}
-		json::LookupInt32(value, PHANTASMA_LITERAL("{{Name}}"), jsonErr)
+		(selected & fields::{{#fix-type Key}}::{{Name}}) ? json::AsInt32(slot[fields::{{#fix-type Key}}::{{Name}}_index].Get(), jsonErr) : 0
 {{#else}}
 {{#if FieldType.Name=='String'}}
-		json::LookupString(value, PHANTASMA_LITERAL("{{Name}}"), jsonErr)
+		(selected & fields::{{#fix-type Key}}::{{Name}}) ? json::AsRpcString(slot[fields::{{#fix-type Key}}::{{Name}}_index].Get(), jsonErr) : RpcString()
 {{#else}}
 {{#if FieldType.Name=='IAPIResult'}}
-		json::LookupValue(value, PHANTASMA_LITERAL("{{Name}}"), jsonErr)
+		slot[fields::{{#fix-type Key}}::{{Name}}_index].Get()
 {{#else}}
 {{#if FieldType.BaseType != null && FieldType.BaseType.Name=='IAPIResult'}}
-		Deserialize{{#fix-type FieldType.Name}}(json::LookupValue(value, PHANTASMA_LITERAL("{{Name}}"), jsonErr), jsonErr)
+		(selected & fields::{{#fix-type Key}}::{{Name}}) ? Deserialize{{#fix-type FieldType.Name}}(slot[fields::{{#fix-type Key}}::{{Name}}_index].Get(), jsonErr, projection) : {{#fix-type FieldType.Name}}()
 {{#else}}
 		(jsonErr=true, "Variable type {{FieldType.Name}} isnt currently handled by the template system")
 {{/if}}
@@ -695,6 +1394,184 @@ PHANTASMA_FUNCTION {{#fix-type Key}} PhantasmaJsonAPI::Deserialize{{#fix-type Ke
 {{/each}}
 
 
+PHANTASMA_FUNCTION LazyTransaction PhantasmaJsonAPI::DeserializeLazyTransaction(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{
+	const FieldMask selected = projection ? projection->Mask(RpcType::Transaction) : fields::Transaction::All;
+	json::JSONSlot slot[fields::Transaction::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Transaction::Keys(), fields::Transaction::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{
+		case json::KeyHash(PHANTASMA_LITERAL("hash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("hash")) ) { slot[fields::Transaction::hash_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::hash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("chainAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("chainAddress")) ) { slot[fields::Transaction::chainAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::chainAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("timestamp")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("timestamp")) ) { slot[fields::Transaction::timestamp_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::timestamp; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("blockHeight")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("blockHeight")) ) { slot[fields::Transaction::blockHeight_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::blockHeight; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("blockHash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("blockHash")) ) { slot[fields::Transaction::blockHash_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::blockHash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("script")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("script")) ) { slot[fields::Transaction::script_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::script; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("payload")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("payload")) ) { slot[fields::Transaction::payload_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::payload; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("events")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("events")) ) { slot[fields::Transaction::events_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::events; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("result")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("result")) ) { slot[fields::Transaction::result_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::result; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("fee")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("fee")) ) { slot[fields::Transaction::fee_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::fee; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("signatures")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("signatures")) ) { slot[fields::Transaction::signatures_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::signatures; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("expiration")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("expiration")) ) { slot[fields::Transaction::expiration_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::expiration; } break;
+		}
+	}
+	LazyArray<Event> events;
+	if((selected & found & fields::Transaction::events) && json::IsArray(slot[fields::Transaction::events_index].Get(), jsonErr))
+		events = LazyArray<Event>(slot[fields::Transaction::events_index].Get(), &DeserializeEvent, projection);
+	LazyArray<Signature> signatures;
+	if((selected & found & fields::Transaction::signatures) && json::IsArray(slot[fields::Transaction::signatures_index].Get(), jsonErr))
+		signatures = LazyArray<Signature>(slot[fields::Transaction::signatures_index].Get(), &DeserializeSignature, projection);
+	return LazyTransaction { 
+		(selected & fields::Transaction::hash) ? json::AsRpcString(slot[fields::Transaction::hash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::chainAddress) ? json::AsRpcString(slot[fields::Transaction::chainAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::timestamp) ? json::AsUInt32(slot[fields::Transaction::timestamp_index].Get(), jsonErr) : 0, 
+		(selected & fields::Transaction::blockHeight) ? json::AsInt32(slot[fields::Transaction::blockHeight_index].Get(), jsonErr) : 0, 
+		(selected & fields::Transaction::blockHash) ? json::AsRpcString(slot[fields::Transaction::blockHash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::script) ? json::AsRpcString(slot[fields::Transaction::script_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::payload) ? json::AsRpcString(slot[fields::Transaction::payload_index].Get(), jsonErr) : RpcString(), 
+		std::move(events), 
+		(selected & fields::Transaction::result) ? json::AsRpcString(slot[fields::Transaction::result_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::fee) ? json::AsRpcString(slot[fields::Transaction::fee_index].Get(), jsonErr) : RpcString(), 
+		std::move(signatures), 
+		(selected & fields::Transaction::expiration) ? json::AsUInt32(slot[fields::Transaction::expiration_index].Get(), jsonErr) : 0
+	};
+}
+
+PHANTASMA_FUNCTION LazyBlock PhantasmaJsonAPI::DeserializeLazyBlock(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{
+	const FieldMask selected = projection ? projection->Mask(RpcType::Block) : fields::Block::All;
+	json::JSONSlot slot[fields::Block::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Block::Keys(), fields::Block::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{
+		case json::KeyHash(PHANTASMA_LITERAL("hash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("hash")) ) { slot[fields::Block::hash_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::hash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("previousHash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("previousHash")) ) { slot[fields::Block::previousHash_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::previousHash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("timestamp")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("timestamp")) ) { slot[fields::Block::timestamp_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::timestamp; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("height")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("height")) ) { slot[fields::Block::height_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::height; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("chainAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("chainAddress")) ) { slot[fields::Block::chainAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::chainAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("protocol")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("protocol")) ) { slot[fields::Block::protocol_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::protocol; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("txs")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("txs")) ) { slot[fields::Block::txs_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::txs; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("validatorAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("validatorAddress")) ) { slot[fields::Block::validatorAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::validatorAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("reward")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("reward")) ) { slot[fields::Block::reward_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::reward; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("events")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("events")) ) { slot[fields::Block::events_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::events; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("oracles")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("oracles")) ) { slot[fields::Block::oracles_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::oracles; } break;
+		}
+	}
+	LazyArray<LazyTransaction> txs;
+	if((selected & found & fields::Block::txs) && json::IsArray(slot[fields::Block::txs_index].Get(), jsonErr))
+		txs = LazyArray<LazyTransaction>(slot[fields::Block::txs_index].Get(), &DeserializeLazyTransaction, projection);
+	LazyArray<Event> events;
+	if((selected & found & fields::Block::events) && json::IsArray(slot[fields::Block::events_index].Get(), jsonErr))
+		events = LazyArray<Event>(slot[fields::Block::events_index].Get(), &DeserializeEvent, projection);
+	LazyArray<Oracle> oracles;
+	if((selected & found & fields::Block::oracles) && json::IsArray(slot[fields::Block::oracles_index].Get(), jsonErr))
+		oracles = LazyArray<Oracle>(slot[fields::Block::oracles_index].Get(), &DeserializeOracle, projection);
+	return LazyBlock { 
+		(selected & fields::Block::hash) ? json::AsRpcString(slot[fields::Block::hash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Block::previousHash) ? json::AsRpcString(slot[fields::Block::previousHash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Block::timestamp) ? json::AsUInt32(slot[fields::Block::timestamp_index].Get(), jsonErr) : 0, 
+		(selected & fields::Block::height) ? json::AsUInt32(slot[fields::Block::height_index].Get(), jsonErr) : 0, 
+		(selected & fields::Block::chainAddress) ? json::AsRpcString(slot[fields::Block::chainAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Block::protocol) ? json::AsUInt32(slot[fields::Block::protocol_index].Get(), jsonErr) : 0, 
+		std::move(txs), 
+		(selected & fields::Block::validatorAddress) ? json::AsRpcString(slot[fields::Block::validatorAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Block::reward) ? json::AsRpcString(slot[fields::Block::reward_index].Get(), jsonErr) : RpcString(), 
+		std::move(events), 
+		std::move(oracles)
+	};
+}
+
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseLazyResponse(const JSONValue& _jsonResponse, LazyBlock& output, PhantasmaError* pout_err, const RpcProjection* projection)
+{
+	PhantasmaError err_dummy;
+	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
+	JSONValue jsonResponse = PhantasmaJsonAPI::CheckResponse(_jsonResponse, out_error);
+	if( out_error.code )
+		return false;
+	bool jsonErr = false;
+	output = DeserializeLazyBlock(jsonResponse, jsonErr, projection);
+	if( !out_error.code && jsonErr )
+		out_error.code = PhantasmaError::InvalidJSON;
+	return out_error.code == 0;
+}
+
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseLazyResponse(const JSONValue& _jsonResponse, LazyTransaction& output, PhantasmaError* pout_err, const RpcProjection* projection)
+{
+	PhantasmaError err_dummy;
+	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
+	JSONValue jsonResponse = PhantasmaJsonAPI::CheckResponse(_jsonResponse, out_error);
+	if( out_error.code )
+		return false;
+	bool jsonErr = false;
+	output = DeserializeLazyTransaction(jsonResponse, jsonErr, projection);
+	if( !out_error.code && jsonErr )
+		out_error.code = PhantasmaError::InvalidJSON;
+	return out_error.code == 0;
+}
+
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeBatchRequest(JSONBuilder& request, const RpcBatch& batch, int batchIndex)
+{
+	json::BeginArray(request);
+	for( int i = batch.Begin(batchIndex), end = batch.End(batchIndex); i < end; ++i )
+	{
+		Char id[RpcBatch::IdLength];
+		batch.m_requests[i].make(request, RpcBatch::FormatId(id, i));
+	}
+	json::EndArray(request);
+}
+
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseBatchResponse(const JSONValue& response, RpcBatch& batch, int batchIndex, PhantasmaError* pout_err)
+{
+	PhantasmaError err_dummy;
+	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
+	const int begin = batch.Begin(batchIndex), end = batch.End(batchIndex);
+	bool jsonErr = false;
+	if( !json::IsArray(response, jsonErr) || jsonErr )
+	{
+		// Nodes reply to a batch that they can't process with a single error object
+		PhantasmaJsonAPI::CheckResponse(response, out_error);
+		if( !out_error.code )
+			out_error.code = PhantasmaError::InvalidRpcResponse;
+		batch.Fail(batchIndex, out_error);
+		return false;
+	}
+	for( int i = begin; i < end; ++i )
+		batch.m_requests[i].parsed = false;
+	const JSONArray& responses = json::AsArray(response, jsonErr);
+	for(JSONArrayCursor it = json::ArrayBegin(responses, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
+	{
+		const JSONValue& element = json::ArrayValue(it, jsonErr);
+		if( !json::IsObject(element, jsonErr) || !json::HasField(element, PHANTASMA_LITERAL("id"), jsonErr) )
+			continue;
+		int index = RpcBatch::ParseId(json::LookupString(element, PHANTASMA_LITERAL("id"), jsonErr));
+		if( index < begin || index >= end || batch.m_requests[index].parsed )
+			continue;
+		RpcBatch::Request& request = batch.m_requests[index];
+		request.parsed = true;
+		request.parse(element, request.error);
+	}
+	if( !out_error.code && jsonErr )
+		out_error.code = PhantasmaError::InvalidJSON;
+	for( int i = begin; i < end; ++i )
+	{
+		RpcBatch::Request& request = batch.m_requests[i];
+		if( !request.parsed && request.error )
+		{
+			request.error->code = PhantasmaError::InvalidRpcResponse;
+			request.error->message = String(PHANTASMA_LITERAL("Malformed response: No response with a matching id in the batch"));
+		}
+	}
+	return out_error.code == 0;
+}
+
 PHANTASMA_FUNCTION JSONValue PhantasmaJsonAPI::CheckResponse(JSONValue response, PhantasmaError& out_error)
 {
 	bool jsonErr = false;
@@ -757,17 +1634,17 @@ PHANTASMA_FUNCTION JSONValue PhantasmaJsonAPI::CheckResponse(JSONValue response,
 
 {{#each methods}}
 // {{Info.Description}} {{#if Info.IsPaginated}}(Paginated){{/if}}
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::Make{{Info.Name}}Request(JSONBuilder& request{{#each Info.Parameters}}, {{#fix-ref Type.Name}} {{Name}}{{/each}})
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::Make{{Info.Name}}Request(JSONBuilder& request{{#each Info.Parameters}}, {{#fix-ref Type.Name}} {{Name}}{{/each}}, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("{{#camel-case Info.Name}}"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"){{#each Info.Parameters}}, {{Name}}{{/each}});
 	json::EndObject(request);{{#parse-lines true}}
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::Parse{{Info.Name}}Response(const JSONValue& _jsonResponse, {{#if Info.ReturnType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix-type Info.ReturnType.Name}}{{#if Info.ReturnType.IsArray}}>{{/if}}& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::Parse{{Info.Name}}Response(const JSONValue& _jsonResponse, {{#if Info.ReturnType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix-type Info.ReturnType.Name}}{{#if Info.ReturnType.IsArray}}>{{/if}}& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -775,7 +1652,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::Parse{{Info.Name}}Response(const JSONV
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	{{#if Info.IsPaginated}}Paginated pageStruct = DeserializePaginated(jsonResponse, jsonErr);
+	{{#if Info.IsPaginated}}Paginated pageStruct = DeserializePaginated(jsonResponse, jsonErr, projection);
 {{#parse-lines false}}
 {{#if Info.ReturnType.IsArray}}
 	if(!json::IsArray(pageStruct.result, jsonErr)){{#new-line}}
@@ -787,26 +1664,29 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::Parse{{Info.Name}}Response(const JSONV
 	const JSONArray& pages = json::AsArray(pageStruct.result, jsonErr);{{#new-line}}
 	int size = json::ArraySize(pages, jsonErr);{{#new-line}}
 	output.reserve(size);{{#new-line}}
-	for(int i = 0; i < size; ++i){{#new-line}}
+	for(JSONArrayCursor it = json::ArrayBegin(pages, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr)){{#new-line}}
 	{
 {{#new-line}}
 {{#if Info.ReturnType.Name=='UInt32'}}
-		output.push_back(json::AsUInt32(json::IndexArray(pages, i, jsonErr), jsonErr));{{#new-line}}
+		(void)projection;{{#new-line}}
+		output.push_back(json::AsUInt32(json::ArrayValue(it, jsonErr), jsonErr));{{#new-line}}
 {{#else}}
 {{#if Info.ReturnType.Name=='Int32'}}
-		output.push_back(json::AsInt32(json::IndexArray(pages, i, jsonErr), jsonErr));{{#new-line}}
+		(void)projection;{{#new-line}}
+		output.push_back(json::AsInt32(json::ArrayValue(it, jsonErr), jsonErr));{{#new-line}}
 {{#else}}
 {{#if Info.ReturnType.Name=='String'}}
-		output.push_back(json::AsString(json::IndexArray(pages, i, jsonErr), jsonErr));{{#new-line}}
+		(void)projection;{{#new-line}}
+		output.push_back(json::AsString(json::ArrayValue(it, jsonErr), jsonErr));{{#new-line}}
 {{#else}}
-		output.push_back(Deserialize{{#fix-type Info.ReturnType.Name}}(json::IndexArray(pages, i, jsonErr), jsonErr));{{#new-line}}
+		output.push_back(Deserialize{{#fix-type Info.ReturnType.Name}}(json::ArrayValue(it, jsonErr), jsonErr, projection));{{#new-line}}
 {{/if}}
 {{/if}}
 {{/if}}
 	}{{#new-line}}
 {{/if}}
 {{#if Info.ReturnType.IsArray==false}}
-	output = Deserialize{{#fix-type Info.ReturnType.Name}}(pageStruct.result, jsonErr);{{#new-line}}
+	output = Deserialize{{#fix-type Info.ReturnType.Name}}(pageStruct.result, jsonErr, projection);{{#new-line}}
 {{/if}}
 	if( !out_error.code && jsonErr ){{#new-line}}
 		out_error.code = PhantasmaError::InvalidJSON;{{#new-line}}
@@ -824,19 +1704,22 @@ if (!json::IsArray(jsonResponse, jsonErr)){{#new-line}}
 	const JSONArray& resultArray = json::AsArray(jsonResponse, jsonErr);{{#new-line}}
 	int resultArraySize = json::ArraySize(resultArray, jsonErr);{{#new-line}}
 	output.reserve(resultArraySize);{{#new-line}}
-	for(int i = 0; i < resultArraySize; ++i){{#new-line}}
+	for(JSONArrayCursor it = json::ArrayBegin(resultArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr)){{#new-line}}
 	{
 {{#new-line}}
 {{#if Info.ReturnType.Name=='UInt32'}}
-		output.push_back(json::AsUInt32(json::IndexArray(resultArray, i, jsonErr), jsonErr));{{#new-line}}
+		(void)projection;{{#new-line}}
+		output.push_back(json::AsUInt32(json::ArrayValue(it, jsonErr), jsonErr));{{#new-line}}
 {{#else}}
 {{#if Info.ReturnType.Name=='Int32'}}
-		output.push_back(json::AsInt32(json::IndexArray(resultArray, i, jsonErr), jsonErr));{{#new-line}}
+		(void)projection;{{#new-line}}
+		output.push_back(json::AsInt32(json::ArrayValue(it, jsonErr), jsonErr));{{#new-line}}
 {{#else}}
 {{#if Info.ReturnType.Name=='String'}}
-		output.push_back(json::AsString(json::IndexArray(resultArray, i, jsonErr), jsonErr));{{#new-line}}
+		(void)projection;{{#new-line}}
+		output.push_back(json::AsString(json::ArrayValue(it, jsonErr), jsonErr));{{#new-line}}
 {{#else}}
-		output.push_back(Deserialize{{#fix-type Info.ReturnType.Name}}(json::IndexArray(resultArray, i, jsonErr), jsonErr));{{#new-line}}
+		output.push_back(Deserialize{{#fix-type Info.ReturnType.Name}}(json::ArrayValue(it, jsonErr), jsonErr, projection));{{#new-line}}
 		if( jsonErr || out_error.code ){{#new-line}}
 			break;{{#new-line}}
 {{/if}}
@@ -846,15 +1729,18 @@ if (!json::IsArray(jsonResponse, jsonErr)){{#new-line}}
 {{/if}}
 {{#if Info.ReturnType.IsArray==false}}
 {{#if Info.ReturnType.Name=='UInt32'}}
-output = json::AsUInt32(jsonResponse, jsonErr);{{#new-line}}
+(void)projection; // nothing to project in a UInt32{{#new-line}}
+	output = json::AsUInt32(jsonResponse, jsonErr);{{#new-line}}
 {{#else}}
 {{#if Info.ReturnType.Name=='Int32'}}
-output = json::AsInt32(jsonResponse, jsonErr);{{#new-line}}
+(void)projection; // nothing to project in a Int32{{#new-line}}
+	output = json::AsInt32(jsonResponse, jsonErr);{{#new-line}}
 {{#else}}
 {{#if Info.ReturnType.Name=='String'}}
-output = json::AsString(jsonResponse, jsonErr);{{#new-line}}
+(void)projection; // nothing to project in a String{{#new-line}}
+	output = json::AsString(jsonResponse, jsonErr);{{#new-line}}
 {{#else}}
-output = Deserialize{{#fix-type Info.ReturnType.Name}}(jsonResponse, jsonErr);{{#new-line}}
+output = Deserialize{{#fix-type Info.ReturnType.Name}}(jsonResponse, jsonErr, projection);{{#new-line}}
 {{/if}}
 {{/if}}
 {{/if}}
@@ -868,12 +1754,32 @@ output = Deserialize{{#fix-type Info.ReturnType.Name}}(jsonResponse, jsonErr);{{
 {{/each}}
 	
 #if defined(PHANTASMA_HTTPCLIENT)
+PHANTASMA_FUNCTION bool PhantasmaAPI::Send(PHANTASMA_ARENA_PARAM RpcBatch& batch, PhantasmaError* out_error)
+{
+	PhantasmaError err_dummy;
+	PhantasmaError& error = out_error ? *out_error : err_dummy;
+	// A failed HTTP request only fails the requests of its own sub-batch; the first failure is reported
+	for( int i = 0, count = batch.Batches(); i != count; ++i )
+	{
+		PhantasmaError batchError;
+		JSONBuilder request;
+		PhantasmaJsonAPI::MakeBatchRequest(request, batch, i);
+		const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, &batchError));
+		if( batchError.code )
+			batch.Fail(i, batchError);
+		else
+			PhantasmaJsonAPI::ParseBatchResponse(json::Parse(response), batch, i, &batchError);
+		if( batchError.code && !error.code )
+			error = batchError;
+	}
+	return error.code == 0;
+}
 {{#each methods}}
-PHANTASMA_FUNCTION {{#if Info.ReturnType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix-type Info.ReturnType.Name}}{{#if Info.ReturnType.IsArray}}>{{/if}} PhantasmaAPI::{{Info.Name}}({{#each Info.Parameters}}{{#fix-ref Type.Name}} {{Name}}, {{/each}}PhantasmaError* out_error)
+PHANTASMA_FUNCTION {{#if Info.ReturnType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix-type Info.ReturnType.Name}}{{#if Info.ReturnType.IsArray}}>{{/if}} PhantasmaAPI::{{Info.Name}}(PHANTASMA_ARENA_PARAM {{#each Info.Parameters}}{{#fix-ref Type.Name}} {{Name}}, {{/each}}PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::Make{{Info.Name}}Request(request{{#each Info.Parameters}}, {{Name}}{{/each}});
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	{{#if Info.ReturnType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix-type Info.ReturnType.Name}}{{#if Info.ReturnType.IsArray}}>{{/if}} output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::Parse{{Info.Name}}Response(json::Parse(response), output, out_error);
@@ -881,6 +1787,34 @@ PHANTASMA_FUNCTION {{#if Info.ReturnType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix
 }
 {{/each}}
 #endif
+#if defined(PHANTASMA_ASYNC_HTTPCLIENT)
+{{#each methods}}
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::{{Info.Name}}({{#each Info.Parameters}}{{#fix-ref Type.Name}} {{Name}}, {{/each}}std::function<void({{#if Info.ReturnType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix-type Info.ReturnType.Name}}{{#if Info.ReturnType.IsArray}}>{{/if}}& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::Make{{Info.Name}}Request(request{{#each Info.Parameters}}, {{Name}}{{/each}});
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		{{#if Info.ReturnType.IsArray}}PHANTASMA_VECTOR<{{/if}}{{#fix-type Info.ReturnType.Name}}{{#if Info.ReturnType.IsArray}}>{{/if}} output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::Parse{{Info.Name}}Response(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+{{/each}}
+#endif
 }
 
 namespace json
@@ -891,6 +1825,39 @@ namespace json
 //------------------------------------------------------------------------------
     JSONValue Parse(const JSONDocument& doc) { return doc; }
 
+#ifdef PHANTASMA_SIMD_X64
+# if defined(_MSC_VER) && !defined(__clang__)
+	inline int SimdLowestBit(unsigned mask) { unsigned long i; _BitScanForward(&i, mask); return (int)i; }
+# else
+	inline int SimdLowestBit(unsigned mask) { return __builtin_ctz(mask); }
+# endif
+	// Returns the index of the first a/b character, or the start of the final partial block
+	inline size_t ScanFor2SSE2(const char* s, size_t i, size_t n, char a, char b)
+	{
+		const __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b);
+		for(; i+16 <= n; i += 16)
+		{
+			__m128i x = _mm_loadu_si128((const __m128i*)(s+i));
+			unsigned mask = (unsigned)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(x, va), _mm_cmpeq_epi8(x, vb)));
+			if( mask ) { return i + SimdLowestBit(mask); }
+		}
+		return i;
+	}
+#endif
+	// Equivalent to v.find_first_of({a,b}, i)
+	inline size_t ScanFor2(const JSONValue& v, size_t i, Char a, Char b)
+	{
+#ifdef PHANTASMA_SIMD_X64
+		if( sizeof(Char) == 1 && i < v.size() )
+			i = ScanFor2SSE2((const char*)v.data(), i, v.size(), (char)a, (char)b);
+#endif
+		for(; i < v.size(); ++i)
+		{
+			if( v[i] == a || v[i] == b ) { return i; }
+		}
+		return JSONValue::npos;
+	}
+
 	inline size_t SkipNumber(const JSONValue& v, size_t i, bool& out_error)
 	{
 		size_t j = v.find_first_not_of(PHANTASMA_LITERAL("+-0123456789.eE"), i);
@@ -902,7 +1869,7 @@ namespace json
 		if( v[i] != '"' ) { PHANTASMA_EXCEPTION("Invalid String"); out_error = true; return i+1; }
 		for(++i; i<v.size();)
 		{
-			i =  v.find_first_of(PHANTASMA_LITERAL("\"\\"), i);
+			i =  ScanFor2(v, i, '"', '\\');
 			if( i == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated String"); out_error = true; return i; }
 			if( v[i] == '"' ) { break; }
 			if( i+1 < v.size() )
@@ -928,6 +1895,18 @@ namespace json
 		PHANTASMA_EXCEPTION("Invalid Value"); out_error = true; return i+1;
 	}
 	inline size_t SkipObject(const JSONValue& v, size_t i, bool& out_error);
+	inline size_t SkipArray(const JSONValue& v, size_t i, bool& out_error);
+	inline size_t SkipValue(const JSONValue& v, size_t i, bool& out_error)
+	{
+		switch( v[i] )
+		{
+		case '{': return SkipObject(v, i, out_error);
+		case '[': return SkipArray(v, i, out_error);
+		case '"': return SkipString(v, i, out_error);
+		case 't': case 'f': case 'n': return SkipBoolNull(v, i, out_error);
+		default:  return SkipNumber(v, i, out_error);
+		}
+	}
 	inline size_t SkipArray(const JSONValue& v, size_t i, bool& out_error)
 	{
 		if( v[i] != '[' ) { PHANTASMA_EXCEPTION("Invalid Array"); out_error = true; return i+1; }
@@ -955,7 +1934,7 @@ namespace json
 		if( v[i] != '{' ) { PHANTASMA_EXCEPTION("Invalid object"); out_error = true; return i+1; }
 		for(; i<v.size();)
 		{
-			size_t keyBegin = v.find_first_of(PHANTASMA_LITERAL("\"}"), i);
+			size_t keyBegin = ScanFor2(v, i, '"', '}');
 			if( keyBegin == JSONValue::npos || v[keyBegin] == '}' ) { break; }//no more keys
 			size_t keyEnd = v.find_first_of('"', keyBegin+1);
 			if( keyEnd == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated string"); out_error = true; break; }
@@ -987,7 +1966,7 @@ namespace json
 		size_t fieldLen = PHANTASMA_STRLEN(field);
 		for(size_t i=0; i<v.size();)
 		{
-			size_t keyBegin = v.find_first_of(PHANTASMA_LITERAL("\"}"), i);
+			size_t keyBegin = ScanFor2(v, i, '"', '}');
 			if( keyBegin == JSONValue::npos || v[keyBegin] == '}' ) { break; }//no more keys
 			++keyBegin;
 			size_t keyEnd = v.find_first_of('"', keyBegin);
@@ -1038,6 +2017,15 @@ namespace json
 		if( pos == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated string"); out_error = true; return String(); }
 		return String(v.substr(1, pos-1));
 	}
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+	PHANTASMA_FUNCTION StringView AsStringView(const JSONValue& v, bool& out_error)
+	{
+		if( v.length() < 1 || v[0] != '"' ) { PHANTASMA_EXCEPTION("Casting non-string value to string"); out_error = true; return StringView(); }
+		size_t pos = v.find('"', 1);
+		if( pos == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated string"); out_error = true; return StringView(); }
+		return v.substr(1, pos-1);
+	}
+#endif
 	PHANTASMA_FUNCTION JSONArray AsArray(const JSONValue& v, bool& out_error) { if(!IsArray(v, out_error)) { PHANTASMA_EXCEPTION("Casting non-array value to array"); out_error = true; } return v; }
 	PHANTASMA_FUNCTION bool IsArray(const JSONValue& v, bool& out_error)
 	{
@@ -1095,6 +2083,111 @@ namespace json
 		out_error = true;
 		return JSONValue();
 	}
+	PHANTASMA_FUNCTION JSONArrayCursor ArrayBegin(const JSONArray& v, bool& out_error)
+	{
+		if( v.length() < 1 || v[0] != '[' ) { PHANTASMA_EXCEPTION("Invalid Array"); out_error = true; return JSONArrayCursor{ &v, JSONValue::npos, 0 }; }
+		size_t i = v.find_first_not_of(PHANTASMA_LITERAL(" \t\r\n\f\b"), 1);
+		if( i == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated array"); out_error = true; }
+		return JSONArrayCursor{ &v, i, 0 };
+	}
+	PHANTASMA_FUNCTION bool ArrayValid(const JSONArrayCursor& c, bool&)
+	{
+		return c.position < c.array->size() && (*c.array)[c.position] != ']';
+	}
+	PHANTASMA_FUNCTION void ArrayNext(JSONArrayCursor& c, bool& out_error)
+	{
+		const JSONValue& v = *c.array;
+		size_t i = SkipValue(v, c.position, out_error);
+		if( i != JSONValue::npos )
+			i = v.find_first_not_of(PHANTASMA_LITERAL(" \t\r\n\f\b"), i);
+		if( i != JSONValue::npos && v[i] == ',' )
+			i = v.find_first_not_of(PHANTASMA_LITERAL(" \t\r\n\f\b"), i+1);
+		else if( i == JSONValue::npos || v[i] != ']' )
+		{
+			PHANTASMA_EXCEPTION("Unterminated array");
+			out_error = true;
+			i = JSONValue::npos;
+		}
+		c.position = i;
+	}
+	PHANTASMA_FUNCTION JSONValue ArrayValue(const JSONArrayCursor& c, bool&)
+	{
+		return c.array->substr(c.position);
+	}
+	inline void FindObjectKey(JSONObjectCursor& c, size_t i, bool& out_error)
+	{
+		const JSONValue& v = *c.object;
+		c.keyBegin = JSONValue::npos;
+		size_t keyBegin = ScanFor2(v, i, '"', '}');
+		if( keyBegin == JSONValue::npos || v[keyBegin] == '}' ) { return; }//no more keys
+		++keyBegin;
+		size_t keyEnd = v.find_first_of('"', keyBegin);
+		if( keyEnd == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated string"); out_error = true; return; }
+		size_t valueBegin = v.find_first_not_of(PHANTASMA_LITERAL(" \t\r\n\f\b:"), keyEnd+1);
+		if( valueBegin == JSONValue::npos ) { PHANTASMA_EXCEPTION("No value following object key"); out_error = true; return; }
+		c.keyBegin = keyBegin;
+		c.keyEnd = keyEnd;
+		c.valueBegin = valueBegin;
+	}
+	PHANTASMA_FUNCTION JSONObjectCursor ObjectBegin(const JSONValue& v, bool& out_error)
+	{
+		JSONObjectCursor c{ &v, JSONValue::npos, 0, 0 };
+		if( v.length() < 1 || v[0] != '{' ) { PHANTASMA_EXCEPTION("Invalid object"); out_error = true; return c; }
+		FindObjectKey(c, 1, out_error);
+		return c;
+	}
+	PHANTASMA_FUNCTION bool ObjectValid(const JSONObjectCursor& c, bool&)
+	{
+		return c.keyBegin != JSONValue::npos;
+	}
+	PHANTASMA_FUNCTION void ObjectNext(JSONObjectCursor& c, bool& out_error)
+	{
+		size_t i = SkipValue(*c.object, c.valueBegin, out_error);
+		if( i == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated object"); out_error = true; c.keyBegin = JSONValue::npos; return; }
+		FindObjectKey(c, i, out_error);
+	}
+	PHANTASMA_FUNCTION const Char* ObjectKey(const JSONObjectCursor& c, size_t& out_length, bool&)
+	{
+		out_length = c.keyEnd - c.keyBegin;
+		return c.object->data() + c.keyBegin;
+	}
+	PHANTASMA_FUNCTION JSONValue ObjectValue(const JSONObjectCursor& c, bool&)
+	{
+		return c.object->substr(c.valueBegin);
+	}
+#else
+# ifndef PHANTASMA_JSONARRAYCURSOR
+//------------------------------------------------------------------------------
+// Array cursors for JSON libraries that only supply ArraySize/IndexArray:
+//------------------------------------------------------------------------------
+	PHANTASMA_FUNCTION JSONArrayCursor ArrayBegin(const JSONArray& a, bool& out_error) { return JSONArrayCursor{ &a, 0, (size_t)ArraySize(a, out_error) }; }
+	PHANTASMA_FUNCTION bool ArrayValid(const JSONArrayCursor& c, bool&)                { return c.position < c.size; }
+	PHANTASMA_FUNCTION void ArrayNext(JSONArrayCursor& c, bool&)                       { ++c.position; }
+	PHANTASMA_FUNCTION JSONValue ArrayValue(const JSONArrayCursor& c, bool& out_error) { return IndexArray(*c.array, (int)c.position, out_error); }
+# endif
+# ifndef PHANTASMA_JSONOBJECTCURSOR
+//------------------------------------------------------------------------------
+// Object cursors for JSON libraries that only supply HasField/LookupValue. They
+//  visit the fields of the RPC structure that the object has, in the order of
+//  the structure, rather than the members of the object:
+//------------------------------------------------------------------------------
+	inline void FindObjectKey(JSONObjectCursor& c, bool& out_error)
+	{
+		while( c.index < c.numKeys && !HasField(*c.object, c.keys[c.index], out_error) )
+			++c.index;
+	}
+	PHANTASMA_FUNCTION JSONObjectCursor ObjectBegin(const JSONValue& v, const Char* const* keys, int numKeys, bool& out_error)
+	{
+		JSONObjectCursor c{ &v, keys, numKeys, 0 };
+		if( !IsObject(v, out_error) ) { PHANTASMA_EXCEPTION("Invalid object"); out_error = true; c.index = numKeys; return c; }
+		FindObjectKey(c, out_error);
+		return c;
+	}
+	PHANTASMA_FUNCTION bool ObjectValid(const JSONObjectCursor& c, bool&)                                 { return c.index < c.numKeys; }
+	PHANTASMA_FUNCTION void ObjectNext(JSONObjectCursor& c, bool& out_error)                              { ++c.index; FindObjectKey(c, out_error); }
+	PHANTASMA_FUNCTION const Char* ObjectKey(const JSONObjectCursor& c, size_t& out_length, bool&)        { out_length = PHANTASMA_STRLEN(c.keys[c.index]); return c.keys[c.index]; }
+	PHANTASMA_FUNCTION JSONValue ObjectValue(const JSONObjectCursor& c, bool& out_error)                  { return LookupValue(*c.object, c.keys[c.index], out_error); }
+# endif
 #endif
 #ifndef PHANTASMA_JSONBUILDER
 	PHANTASMA_FUNCTION void BeginObject(JSONBuilder& b)                                   { b.BeginObject(); }
@@ -1102,6 +2195,8 @@ namespace json
 	template<class... Args>
 	void AddArray(JSONBuilder& b, const Char* key, Args... args)                          { b.AddArray(key, args...); }
 	PHANTASMA_FUNCTION void EndObject(JSONBuilder& b)                                     { b.EndObject(); }
+	PHANTASMA_FUNCTION void BeginArray(JSONBuilder& b)                                    { b.BeginArray(); }
+	PHANTASMA_FUNCTION void EndArray(JSONBuilder& b)                                      { b.EndArray(); }
 #endif
 #endif
 }
@@ -2,6 +2,10 @@
 #ifdef PHANTASMA_API_INCLUDED
 #error "Include JSON/HTTP API adaptors immediately before including PhantasmaAPI.h"
 #endif 
+#define PHANTASMA_CPPREST
+#ifdef PHANTASMA_RPC_STRINGVIEW
+#error "The C++ REST adaptor copies JSON values, so it cannot be used with PHANTASMA_RPC_STRINGVIEW"
+#endif
 //------------------------------------------------------------------------------
 // This header supplies the Phantasma API with HTTP and JSON features provided
 //  by the cpprest library (https://github.com/Microsoft/cpprestsdk).
@@ -10,6 +14,9 @@
 #include <cpprest/http_client.h>
 #include <cpprest/json.h>
 #include <cstdint>
+#ifdef PHANTASMA_PMR
+# include <string_view>
+#endif
 
 namespace phantasma { 
 
@@ -46,15 +53,43 @@ inline bool             AsBool(       const web::json::value& v,
 inline int32_t          AsInt32(      const web::json::value& v,                    bool& out_error) { return v.as_integer(); }
 inline uint32_t         AsUInt32(     const web::json::value& v,                    bool& out_error) { return (uint32_t)v.as_integer(); }
 inline String           AsString(     const web::json::value& v,                    bool& out_error) { return v.as_string(); }
+#ifdef PHANTASMA_PMR
+inline std::basic_string_view<Char> AsStringView(const web::json::value& v,         bool& out_error) { return v.as_string(); } // only valid while v lives
+#endif
 inline web::json::array AsArray(      const web::json::value& v,                    bool& out_error) { return v.as_array(); }
 inline bool             IsArray(      const web::json::value& v,                    bool& out_error) { return v.is_array(); }
 inline bool             IsObject(     const web::json::value& v,                    bool& out_error) { return v.is_object(); }
 inline int              ArraySize(    const web::json::array& a,                    bool& out_error) { return (int)a.size(); }
 inline web::json::value IndexArray(   const web::json::array& a, int index,         bool& out_error) { return a.at((size_t)index); }
 
-inline void BeginObject(web::json::value&) {}
+struct CppRestArrayCursor
+{
+	web::json::array::const_iterator it;
+	web::json::array::const_iterator end;
+};
+inline CppRestArrayCursor ArrayBegin(const web::json::array& a,        bool&)           { return CppRestArrayCursor{ a.begin(), a.end() }; }
+inline bool               ArrayValid(const CppRestArrayCursor& c,      bool&)           { return c.it != c.end; }
+inline void               ArrayNext(       CppRestArrayCursor& c,      bool&)           { ++c.it; }
+inline web::json::value   ArrayValue(const CppRestArrayCursor& c,      bool&)           { return *c.it; }
+
+struct CppRestObjectCursor
+{
+	web::json::object::const_iterator it;
+	web::json::object::const_iterator end;
+};
+inline CppRestObjectCursor ObjectBegin(const web::json::value& v,      bool& out_error) { if( !v.is_object() ) { out_error = true; return CppRestObjectCursor{}; } const web::json::object& o = v.as_object(); return CppRestObjectCursor{ o.begin(), o.end() }; }
+inline bool                ObjectValid(const CppRestObjectCursor& c,   bool&)           { return c.it != c.end; }
+inline void                ObjectNext(       CppRestObjectCursor& c,   bool&)           { ++c.it; }
+inline const Char*         ObjectKey(  const CppRestObjectCursor& c, size_t& out_length, bool&) { out_length = c.it->first.size(); return c.it->first.c_str(); }
+inline web::json::value    ObjectValue(const CppRestObjectCursor& c,   bool&)           { return c.it->second; }
+
+// Within an array (a batch of requests), keys are added to the last object in the array
+inline web::json::value& CurrentObject(web::json::value& root)                          { return root.is_array() ? root[root.size()-1] : root; }
+inline void BeginArray(web::json::value& root)                                          { root = web::json::value::array(); }
+inline void EndArray(web::json::value&)                                                 {}
+inline void BeginObject(web::json::value& root)                                         { if( root.is_array() ) { root[root.size()] = web::json::value::object(); } }
 inline void EndObject(web::json::value&){}
-inline void AddString(web::json::value& root, const Char* key, const Char* value)       { root[key] = web::json::value::string(value); }
+inline void AddString(web::json::value& root, const Char* key, const Char* value)       { CurrentObject(root)[key] = web::json::value::string(value); }
 inline void AddValues(int idx, web::json::value& ar)                                    {}
 inline void AddValues(int idx, web::json::value& ar, const Char* arg)                   { ar[idx] = web::json::value::string(arg); }
 template<class T> void AddValues(int idx, web::json::value& ar, T arg)                  { ar[idx] = web::json::value::number(arg); }
@@ -65,7 +100,7 @@ template<class T, class... Args> void AddValues(int idx, web::json::value& ar, T
 }
 template<class... Args> void AddArray(web::json::value& root, const Char* key, Args... args)
 {
-	web::json::value& ar = (root[key] = web::json::value::array());
+	web::json::value& ar = (CurrentObject(root)[key] = web::json::value::array());
 	AddValues(0, ar, args...);
 }
 }
@@ -95,14 +130,61 @@ inline web::json::value HttpPost(web::http::client::http_client& client, const j
 	}).get();
 }
 
+// Returns as soon as the request has been sent. onComplete is called on a cpprest worker thread, with
+//  either the response, or a null response and an error message.
+//  Exceptions that escape onComplete are discarded.
+template<class Callback>
+void HttpPostAsync(web::http::client::http_client& client, const json::Char* uri, const web::json::value& data, Callback onComplete)
+{
+	web::uri_builder builder(uri);
+	client.request(web::http::methods::POST, builder.to_string(), data)
+		.then([](web::http::http_response response)
+	{
+		const auto statusCode = response.status_code();
+		if (statusCode != 200)
+		{
+			utility::stringstream_t msg;
+			msg << U("Malformed RPC request or endpoint: response status = ");
+			msg << statusCode;
+			throw web::http::http_exception(msg.str());
+		}
+		return response.extract_json(true);
+	}).then([onComplete](pplx::task<web::json::value> task)
+	{
+		web::json::value json;
+		utility::string_t msg;
+		bool failed = false;
+		try
+		{
+			json = task.get(); // the task has already completed, so this does not block
+		}
+		catch(const std::exception& e)
+		{
+			msg = utility::conversions::to_string_t(e.what());
+			failed = true;
+		}
+		// Nothing observes the task of this continuation, so an exception that escaped it would terminate the process
+		try
+		{
+			onComplete(failed ? nullptr : &json, failed ? msg.c_str() : nullptr);
+		}
+		catch(...)
+		{
+		}
+	});
+}
+
 #ifndef  PHANTASMA_EXCEPTION_ENABLE
 # define PHANTASMA_EXCEPTION_ENABLE
 #endif
 
 #define PHANTASMA_JSONVALUE     web::json::value
 #define PHANTASMA_JSONARRAY     web::json::array
+#define PHANTASMA_JSONARRAYCURSOR json::CppRestArrayCursor
+#define PHANTASMA_JSONOBJECTCURSOR json::CppRestObjectCursor
 #define PHANTASMA_JSONDOCUMENT  web::json::value
 #define PHANTASMA_JSONBUILDER   web::json::value
 #define PHANTASMA_HTTPCLIENT    web::http::client::http_client
+#define PHANTASMA_ASYNC_HTTPCLIENT web::http::client::http_client
 
 }
@@ -8,9 +8,29 @@
 //  CURL library (https://curl.haxx.se/)
 // 
 // Include this file AFTER PhantasmaAPI_rapidjson.h to interop libCurl and RapidJSON.
+//
+// CurlClient performs one blocking request at a time. CurlMultiClient keeps 
+//  many requests in flight over a bounded pool of connections, and is the 
+//  AsyncHttpClient for AsyncPhantasmaAPI. Call its Perform or Run method to 
+//  drive the requests and invoke their callbacks. Requests may be queued with
+//  PostAsync from any thread, but only one thread at a time may call Perform,
+//  Run or Post (a libcurl multi handle must not be used by several threads).
+//
+// Responses are received into ReallocBuffers, which grow geometrically. 
+//  CurlMultiClient pools them, so their capacity is reused by later requests.
+//  The received bytes are handed to the JSON parser without being copied.
 //------------------------------------------------------------------------------
 #include "curl/curl.h"
 #include "curl/easy.h"
+#include "curl/multi.h"
+#include <functional>
+#include <string>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <cassert>
 
 #ifndef PHANTASMA_STRING
 # include <string>
@@ -46,25 +66,28 @@ struct PhantasmaError;
 class ReallocBuffer // buffer class for CURL to write responses into
 {
 public:
-	ReallocBuffer(size_t initialCapacity = 1024)
-		: memory((char*)malloc(initialCapacity))
-		, size(0), capactiy(initialCapacity) {}
-	~ReallocBuffer() { free(memory); }
-	void   clear() { size = 0; }
-	char*  begin() { return memory; }
-	char*  end() { return memory + size; }
-	size_t bytes() const { return size; }
-	size_t capacity() const { return capactiy; }
+	ReallocBuffer(size_t initialCapacity = 1024) { m_data.reserve(initialCapacity); }
+	void   clear() { m_data.clear(); } // keeps the capacity
+	char*  begin() { return &m_data[0]; }
+	char*  end() { return begin() + m_data.size(); }
+	char*  c_str() { return &m_data[0]; } // always null-terminated, and writable for in-situ parsing
+	size_t bytes() const { return m_data.size(); }
+	size_t capacity() const { return m_data.capacity(); }
+	void   reserve(size_t bytes) { m_data.reserve(bytes); }
+	void   swap(ReallocBuffer& other) { m_data.swap(other.m_data); }
+	// The storage itself, which can be moved into a JSON document instead of being copied
+	std::string& str() { return m_data; }
 	char* append(const void* data, size_t dataSize)
 	{
-		size_t newCapacity = size + dataSize;
-		if (newCapacity > capactiy)
-			memory = (char*)realloc(memory, capactiy = newCapacity);
-		char* dst = end();
+		size_t newSize = m_data.size() + dataSize;
+		if( newSize > m_data.capacity() ) // grow geometrically, so a large response costs O(log n) reallocations
+			m_data.reserve(newSize > m_data.capacity() * 2 ? newSize : m_data.capacity() * 2);
+		size_t offset = m_data.size();
 		if( data )
-			memcpy(dst, data, dataSize);
-		size += dataSize;
-		return dst;
+			m_data.append((const char*)data, dataSize);
+		else
+			m_data.resize(newSize);
+		return begin() + offset;
 	}
 	static size_t CurlWrite(void *contents, size_t size, size_t nmemb, void *userp)
 	{
@@ -74,9 +97,37 @@ public:
 		return realsize;
 	}
 private:
-	char*  memory;
-	size_t size;
-	size_t capactiy;
+	std::string m_data;
+};
+
+class ReallocBufferPool // Keeps the capacity of finished response buffers, for reuse by later requests
+{
+public:
+	// At most maxBuffers buffers are kept, and buffers that grew beyond maxCapacity (for an unusually large 
+	//  response) are freed instead of being kept.
+	ReallocBufferPool(size_t maxBuffers = 16, size_t maxCapacity = 16*1024*1024)
+		: m_maxBuffers(maxBuffers), m_maxCapacity(maxCapacity) {}
+	// Returns an empty buffer, with the capacity of a previously released buffer if there is one
+	ReallocBuffer Acquire()
+	{
+		if( m_free.empty() )
+			return ReallocBuffer();
+		ReallocBuffer buffer = std::move(m_free.back());
+		m_free.pop_back();
+		return buffer;
+	}
+	void Release(ReallocBuffer&& buffer)
+	{
+		if( m_free.size() >= m_maxBuffers || buffer.capacity() > m_maxCapacity )
+			return;
+		buffer.clear();
+		m_free.push_back(std::move(buffer));
+	}
+	size_t Size() const { return m_free.size(); }
+private:
+	std::vector<ReallocBuffer> m_free;
+	size_t m_maxBuffers;
+	size_t m_maxCapacity;
 };
 
 class CurlClient // Very simple wrapper around CURL
@@ -111,6 +162,20 @@ public:
 		CURLcode code = curl_easy_perform(m_curl);
 		return code;
 	}
+	// As Post, but the response is passed to `write` as it arrives, instead of being stored in `result`
+	CURLcode PostStream(const char* data, size_t dataLen, const char* url, curl_write_callback write, void* userp)
+	{
+		PHANTASMA_STRING fullUrl = host + url;
+		curl_easy_setopt(m_curl, CURLOPT_URL, fullUrl.c_str());
+		curl_easy_setopt(m_curl, CURLOPT_WRITEFUNCTION, write);
+		curl_easy_setopt(m_curl, CURLOPT_WRITEDATA, userp);
+		curl_easy_setopt(m_curl, CURLOPT_POST, 1);
+		curl_easy_setopt(m_curl, CURLOPT_POSTFIELDS, data);
+		curl_easy_setopt(m_curl, CURLOPT_POSTFIELDSIZE, dataLen);
+		CURLcode code = curl_easy_perform(m_curl);
+		curl_easy_setopt(m_curl, CURLOPT_WRITEFUNCTION, ReallocBuffer::CurlWrite);
+		return code;
+	}
 	CURLcode Get(const char* url)
 	{
 		result.clear();
@@ -123,35 +188,294 @@ public:
 	}
 };
 
+class CurlMultiClient // Runs many requests at once over a bounded pool of reused CURL handles and connections
+{
+public:
+	typedef std::function<void(CURLcode, ReallocBuffer& response)> Callback;
+
+	const PHANTASMA_STRING host;
+	ReallocBuffer result;
 #ifdef PHANTASMA_RAPIDJSON
+	rapidjson::Document doc;
+#endif
+
+	// At most maxConnections connections are opened to the host, and at most maxTransfers requests are in flight
+	//  at once; further requests wait in a queue. Over HTTP/2, the transfers are multiplexed onto the connections.
+	CurlMultiClient(const PHANTASMA_STRING& host = "http://localhost:7077", int maxConnections = 8, int maxTransfers = 64)
+		: host(host)
+		, m_maxTransfers(maxTransfers > 0 ? maxTransfers : 1)
+	{
+		m_multi = curl_multi_init();
+		curl_multi_setopt(m_multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+		curl_multi_setopt(m_multi, CURLMOPT_MAX_HOST_CONNECTIONS, (long)maxConnections);
+		curl_multi_setopt(m_multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, (long)maxConnections);
+		curl_multi_setopt(m_multi, CURLMOPT_MAXCONNECTS, (long)maxConnections);
+	}
+	~CurlMultiClient()
+	{
+		for( const std::unique_ptr<Transfer>& t : m_transfers )
+		{
+			if( t->active )
+				curl_multi_remove_handle(m_multi, t->curl);
+			curl_easy_cleanup(t->curl);
+		}
+		curl_multi_cleanup(m_multi);
+	}
+	CurlMultiClient(const CurlMultiClient&) = delete;
+	CurlMultiClient& operator=(const CurlMultiClient&) = delete;
+
+	// Queues a request and returns immediately. onComplete is called from within Perform, with the response body.
+	// This may be called from any thread, while a single thread calls Perform.
+	void PostAsync(const char* data, size_t dataLen, const char* url, Callback onComplete)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_queueLock);
+			m_queue.push_back(Request{ host + url, std::string(data, dataLen), std::move(onComplete) });
+		}
+#if LIBCURL_VERSION_NUM >= 0x074400
+		curl_multi_wakeup(m_multi);
+#endif
+	}
+
+	// Starts queued requests, waits up to timeoutMs for network activity if nothing has completed yet, and calls the 
+	//  callbacks of the requests that have completed. Returns the number of requests that are in flight or queued.
+	int Perform(int timeoutMs = 0)
+	{
+		DriverScope driver(*this);
+		Start();
+		int running = 0;
+		curl_multi_perform(m_multi, &running);
+		if( !Finish() && running && timeoutMs > 0 )
+		{
+#if LIBCURL_VERSION_NUM >= 0x074200
+			curl_multi_poll(m_multi, nullptr, 0, timeoutMs, nullptr);
+#else
+			curl_multi_wait(m_multi, nullptr, 0, timeoutMs, nullptr);
+#endif
+			Start();
+			curl_multi_perform(m_multi, &running);
+			Finish();
+		}
+		return Pending();
+	}
+	// Performs until every request has completed
+	void Run()
+	{
+		while( Perform(1000) ) {}
+	}
+	int Pending()
+	{
+		std::lock_guard<std::mutex> lock(m_queueLock);
+		return m_active + (int)m_queue.size();
+	}
+
+	// Blocking requests, for use with PhantasmaAPI. Other requests continue to be performed while this one waits.
+	// Post drives the client, so it must not be called while another thread is in Perform, Run or Post. As with
+	//  CurlClient, the response is kept in `result` (and `doc`) until the next call.
+	CURLcode Post(const char* data, size_t dataLen, const char* url)
+	{
+		CURLcode code = CURLE_OK;
+		bool done = false;
+		PostAsync(data, dataLen, url, [&](CURLcode c, ReallocBuffer& response)
+		{
+			code = c;
+			result.swap(response); // hands the response over without a copy; the old result buffer returns to the pool
+			done = true;
+		});
+		while( !done )
+			Perform(1000);
+		return code;
+	}
+private:
+	struct Request
+	{
+		PHANTASMA_STRING url;
+		std::string      body;
+		Callback         onComplete;
+	};
+	struct Transfer
+	{
+		CURL*        curl = 0;
+		bool         active = false;
+		Request      request;
+		ReallocBuffer response; // acquired from m_buffers while the transfer is active
+	};
+	CURLM* m_multi = 0;
+	int    m_maxTransfers;
+	int    m_active = 0;
+	std::vector<std::unique_ptr<Transfer>> m_transfers;
+	std::vector<Transfer*>                 m_idle;
+	std::deque<Request>                    m_queue;
+	std::mutex                             m_queueLock;
+	ReallocBufferPool                      m_buffers;
+	std::atomic<bool>                      m_driving{false};
+
+	struct DriverScope // Checks that only one thread drives the multi handle at a time
+	{
+		CurlMultiClient& client;
+		explicit DriverScope(CurlMultiClient& client) : client(client)
+		{
+			bool driven = client.m_driving.exchange(true);
+			assert(!driven && "CurlMultiClient::Perform/Post called from two threads at once, or from a callback");
+			(void)driven;
+		}
+		~DriverScope() { client.m_driving = false; }
+	};
+
+	void Start()
+	{
+		std::lock_guard<std::mutex> lock(m_queueLock);
+		while( m_active < m_maxTransfers && !m_queue.empty() )
+		{
+			Transfer* t;
+			if( m_idle.empty() )
+				t = Create();
+			else
+			{
+				t = m_idle.back();
+				m_idle.pop_back();
+			}
+			t->request = std::move(m_queue.front());
+			m_queue.pop_front();
+			++m_active;
+			t->active = true;
+			t->response = m_buffers.Acquire();
+			curl_easy_setopt(t->curl, CURLOPT_URL, t->request.url.c_str());
+			curl_easy_setopt(t->curl, CURLOPT_POSTFIELDS, t->request.body.data());
+			curl_easy_setopt(t->curl, CURLOPT_POSTFIELDSIZE, (long)t->request.body.size());
+			curl_multi_add_handle(m_multi, t->curl);
+		}
+	}
+	Transfer* Create()
+	{
+		m_transfers.emplace_back(new Transfer);
+		Transfer* t = m_transfers.back().get();
+		t->curl = curl_easy_init();
+		curl_easy_setopt(t->curl, CURLOPT_PRIVATE, (void*)t);
+		curl_easy_setopt(t->curl, CURLOPT_WRITEFUNCTION, ReallocBuffer::CurlWrite);
+		curl_easy_setopt(t->curl, CURLOPT_WRITEDATA, (void*)&t->response);
+		curl_easy_setopt(t->curl, CURLOPT_POST, 1L);
+		curl_easy_setopt(t->curl, CURLOPT_TCP_KEEPALIVE, 1L);
+		curl_easy_setopt(t->curl, CURLOPT_PIPEWAIT, 1L);
+		return t;
+	}
+	int Finish()
+	{
+		int completed = 0;
+		int queued = 0;
+		while( CURLMsg* msg = curl_multi_info_read(m_multi, &queued) )
+		{
+			if( msg->msg != CURLMSG_DONE )
+				continue;
+			CURL* curl = msg->easy_handle;
+			CURLcode code = msg->data.result;
+			Transfer* t = 0;
+			curl_easy_getinfo(curl, CURLINFO_PRIVATE, (char**)&t);
+			curl_multi_remove_handle(m_multi, curl);
+			Callback onComplete = std::move(t->request.onComplete);
+			onComplete(code, t->response);
+			m_buffers.Release(std::move(t->response));
+			t->active = false;
+			{
+				std::lock_guard<std::mutex> lock(m_queueLock);
+				--m_active;
+				m_idle.push_back(t);
+			}
+			++completed;
+		}
+		return completed;
+	}
+};
+
 namespace rpc {
 struct PhantasmaError;
 void OnHttpError(PhantasmaError&, const char*);
 }
 
+#ifdef PHANTASMA_RAPIDJSON
+
 template<class CurlClient>
 static rapidjson::Document& HttpPost(CurlClient& client, const json::Char* uri, const RapidJsonBufferWriter& data, rpc::PhantasmaError* err)
 {
 	const char* request = data.buf.GetString();
 	CURLcode code = client.Post(request, strlen(request), uri);
-	client.result.append("\0", 1);
 	if(err && code != CURLE_OK)
 		rpc::OnHttpError(*err, curl_easy_strerror(code));
-	return client.doc.ParseInsitu<0>(client.result.begin());
+#ifdef PHANTASMA_RPC_STRINGVIEW
+	return client.doc.template Parse<0>(client.result.c_str()); // RpcString views must not point into the reused result buffer
+#else
+	return client.doc.template ParseInsitu<0>(client.result.c_str());
+#endif
 }
+template<class CurlClient>
+static void HttpPostStream(CurlClient& client, const json::Char* uri, const RapidJsonBufferWriter& data, curl_write_callback write, void* userp, rpc::PhantasmaError* err)
+{
+	const char* request = data.buf.GetString();
+	CURLcode code = client.PostStream(request, strlen(request), uri, write, userp);
+	if(err && code != CURLE_OK)
+		rpc::OnHttpError(*err, curl_easy_strerror(code));
+}
+template<class Callback>
+static void HttpPostAsync(CurlMultiClient& client, const json::Char* uri, const RapidJsonBufferWriter& data, Callback onComplete)
+{
+	const char* request = data.buf.GetString();
+	client.PostAsync(request, strlen(request), uri, [onComplete](CURLcode code, ReallocBuffer& response)
+	{
+		if( code != CURLE_OK )
+			return onComplete(nullptr, curl_easy_strerror(code));
+		rapidjson::Document doc;
+		doc.ParseInsitu<0>(response.c_str()); // the response buffer outlives the callback
+		onComplete(&doc, nullptr);
+	});
+}
+#else
+#if defined(PHANTASMA_JSONDOCUMENT)
+typedef PHANTASMA_JSONDOCUMENT CurlResponse; // the document takes ownership of the response buffer's storage
+#elif defined(PHANTASMA_RPC_STRINGVIEW)
+typedef std::string        CurlResponse; // the ResponseArena takes ownership of the response buffer's storage
 #else
+typedef const std::string& CurlResponse; // the built-in parser reads the client's response buffer in place
+#endif
 template<class CurlClient>
-static PHANTASMA_STRING HttpPost(CurlClient& client, const PHANTASMA_CHAR* uri, const PHANTASMA_STRINGBUILDER& data, rpc::PhantasmaError* err)
+static CurlResponse HttpPost(CurlClient& client, const PHANTASMA_CHAR* uri, const PHANTASMA_STRINGBUILDER& data, rpc::PhantasmaError* err)
 {
 	const PHANTASMA_STRING& request = data.str();
 	CURLcode code = client.Post(request.c_str(), request.length(), uri);
-	client.result.append("\0", 1);
 	if(err && code != CURLE_OK)
 		rpc::OnHttpError(*err, curl_easy_strerror(code));
-	return { client.result.begin() };
+	return std::move(client.result.str());
+}
+template<class CurlClient>
+static void HttpPostStream(CurlClient& client, const PHANTASMA_CHAR* uri, const PHANTASMA_STRINGBUILDER& data, curl_write_callback write, void* userp, rpc::PhantasmaError* err)
+{
+	const PHANTASMA_STRING& request = data.str();
+	CURLcode code = client.PostStream(request.c_str(), request.length(), uri, write, userp);
+	if(err && code != CURLE_OK)
+		rpc::OnHttpError(*err, curl_easy_strerror(code));
+}
+template<class Callback>
+static void HttpPostAsync(CurlMultiClient& client, const PHANTASMA_CHAR* uri, const PHANTASMA_STRINGBUILDER& data, Callback onComplete)
+{
+	const PHANTASMA_STRING& request = data.str();
+	client.PostAsync(request.c_str(), request.length(), uri, [onComplete](CURLcode code, ReallocBuffer& response)
+	{
+		if( code != CURLE_OK )
+			return onComplete(nullptr, curl_easy_strerror(code));
+#ifdef PHANTASMA_JSONDOCUMENT
+		const PHANTASMA_JSONDOCUMENT doc(std::move(response.str())); // takes the storage; the pool replaces the buffer
+		onComplete(&doc, nullptr);
+#else
+		onComplete(&response.str(), nullptr); // the built-in parser reads the response buffer in place
+#endif
+	});
 }
 #endif
 
-#define PHANTASMA_HTTPCLIENT       CurlClient
+#ifndef PHANTASMA_HTTPCLIENT // may be defined as CurlMultiClient, to share its connections with PhantasmaAPI
+# define PHANTASMA_HTTPCLIENT      CurlClient
+#endif
+#ifndef PHANTASMA_ASYNC_HTTPCLIENT
+# define PHANTASMA_ASYNC_HTTPCLIENT CurlMultiClient
+#endif
 
 }
@@ -0,0 +1,617 @@
+#pragma once
+#ifdef PHANTASMA_API_INCLUDED
+#error "Include HTTP API adaptors immediately before including PhantasmaAPI.h"
+#endif
+#define PHANTASMA_EPOLL
+#ifdef PHANTASMA_CURL
+#error "The epoll HTTP adaptor cannot be combined with the libCurl adaptor"
+#endif
+#if !defined(__linux__)
+#error "The epoll HTTP adaptor requires Linux"
+#endif
+#ifdef _UNICODE
+#error "The epoll HTTP adaptor only supports narrow character strings"
+#endif
+//------------------------------------------------------------------------------
+// This header supplies the Phantasma API with a dependency-free HTTP/1.1
+//  client, built on non-blocking sockets and epoll. It only speaks plain HTTP
+//  (no TLS), which is all that is needed to talk to a node's /rpc endpoint on
+//  a local network.
+//
+// Each connection is kept alive between requests, and up to `maxPipeline`
+//  requests are written to it before their responses arrive (HTTP pipelining).
+//  Responses are parsed in place, from a receive buffer that each connection
+//  reuses for its lifetime.
+//
+// EpollHttpClient is both the HttpClient for PhantasmaAPI (blocking HttpPost)
+//  and the AsyncHttpClient for AsyncPhantasmaAPI (HttpPostAsync). Call its
+//  Perform or Run method to drive asynchronous requests and invoke their
+//  callbacks. It must only be used from one thread at a time.
+//  The EpollLoopbackSample sample checks it against a stub server.
+//
+// Include this file AFTER PhantasmaAPI_rapidjson.h to interop with RapidJSON.
+//------------------------------------------------------------------------------
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef PHANTASMA_STRING
+# define PHANTASMA_STRING std::string
+#endif
+
+#ifndef PHANTASMA_STRINGBUILDER
+# include <sstream>
+# define PHANTASMA_STRINGBUILDER std::stringstream
+#endif
+
+#ifndef PHANTASMA_CHAR
+# define PHANTASMA_CHAR char
+#endif
+
+namespace phantasma {
+namespace rpc {
+struct PhantasmaError;
+void OnHttpError(PhantasmaError&, const char*);
+}
+
+class EpollHttpClient
+{
+public:
+	// error is null on success, in which case body/length is the response body. It points into the connection's receive
+	//  buffer, so is only valid during the callback, and is null-terminated and may be modified (e.g. parsed in situ).
+	typedef std::function<void(const char* error, char* body, size_t length)> Callback;
+
+	PHANTASMA_STRING result; // the response body of the last blocking Post
+#ifdef PHANTASMA_RAPIDJSON
+	rapidjson::Document doc;
+#endif
+
+	// host is of the form "http://name:port/path". At most maxConnections connections are opened to it, and each
+	//  has at most maxPipeline requests in flight; further requests wait in a queue.
+	EpollHttpClient(const char* host = "http://localhost:7077", int maxConnections = 4, int maxPipeline = 16)
+		: m_maxConnections(maxConnections > 0 ? maxConnections : 1)
+		, m_maxPipeline(maxPipeline > 0 ? maxPipeline : 1)
+	{
+		m_epoll = epoll_create1(EPOLL_CLOEXEC);
+		ParseHost(host);
+	}
+	~EpollHttpClient()
+	{
+		for( const std::unique_ptr<Connection>& c : m_connections )
+			if( c->fd >= 0 )
+				close(c->fd);
+		if( m_epoll >= 0 )
+			close(m_epoll);
+	}
+	EpollHttpClient(const EpollHttpClient&) = delete;
+	EpollHttpClient& operator=(const EpollHttpClient&) = delete;
+
+	// Queues a request and returns immediately. onComplete is called from within Perform.
+	void PostAsync(const char* data, size_t dataLen, const char* url, Callback onComplete)
+	{
+		m_queue.push_back(Request{ m_path + url, std::string(data, dataLen), std::move(onComplete), false });
+	}
+
+	// Sends queued requests, waits up to timeoutMs for network activity, and calls the callbacks of the requests
+	//  that have completed. Returns the number of requests that are in flight or queued.
+	int Perform(int timeoutMs = 0)
+	{
+		Dispatch();
+		if( Pending() == 0 )
+			return 0;
+		epoll_event events[32];
+		int count = epoll_wait(m_epoll, events, 32, timeoutMs);
+		for( int i = 0; i < count; ++i )
+		{
+			Connection& c = *(Connection*)events[i].data.ptr;
+			if( c.fd < 0 )
+				continue;
+			if( events[i].events & (EPOLLERR | EPOLLHUP) && !(events[i].events & EPOLLIN) )
+				Fail(c, "Connection failed");
+			else
+			{
+				if( events[i].events & EPOLLIN )
+					Receive(c);
+				if( c.fd >= 0 && events[i].events & EPOLLOUT )
+					Send(c);
+			}
+		}
+		Dispatch();
+		return Pending();
+	}
+	// Performs until every request has completed
+	void Run()
+	{
+		while( Perform(1000) ) {}
+	}
+	int Pending() const
+	{
+		size_t pending = m_queue.size();
+		for( const std::unique_ptr<Connection>& c : m_connections )
+			pending += c->inflight.size();
+		return (int)pending;
+	}
+
+	// Blocking request, for use with PhantasmaAPI. Other requests continue to be performed while this one waits.
+	bool Post(const char* data, size_t dataLen, const char* url, const char** out_error)
+	{
+		bool done = false;
+		const char* error = 0;
+		PostAsync(data, dataLen, url, [&](const char* e, char* body, size_t length)
+		{
+			error = e;
+			if( e )
+				result.clear();
+			else
+				result.assign(body, length);
+			done = true;
+		});
+		while( !done )
+			Perform(1000);
+		if( out_error )
+			*out_error = error;
+		return !error;
+	}
+private:
+	struct Request
+	{
+		std::string path;
+		std::string body;
+		Callback    onComplete;
+		bool        retried;
+	};
+	struct Connection
+	{
+		int                 fd = -1;
+		bool                connecting = false;
+		bool                reused = false;   // has completed a response, so may be closed by the server while idle
+		std::string         out;              // bytes that have not been written to the socket yet
+		size_t              outBegin = 0;
+		std::vector<char>   in;               // received bytes, reused across responses
+		size_t              inBegin = 0;      // start of the response that is being parsed
+		std::string         chunked;          // decoded body of a chunked response, reused across responses
+		std::deque<Request> inflight;         // requests that have been written, in the order their responses will arrive
+	};
+
+	int m_epoll = -1;
+	int m_maxConnections;
+	int m_maxPipeline;
+	const char* m_hostError = 0;
+	std::string m_hostHeader;
+	std::string m_path;
+	sockaddr_storage m_address = {};
+	socklen_t m_addressLength = 0;
+	std::deque<Request> m_queue;
+	std::vector<std::unique_ptr<Connection>> m_connections;
+
+	void ParseHost(const char* host)
+	{
+		std::string url = host ? host : "";
+		if( url.compare(0, 8, "https://") == 0 ) { m_hostError = "https is not supported by the epoll HTTP adaptor"; return; }
+		if( url.compare(0, 7, "http://") == 0 )
+			url = url.substr(7);
+		size_t slash = url.find('/');
+		if( slash != std::string::npos )
+		{
+			m_path = url.substr(slash);
+			url = url.substr(0, slash);
+			if( !m_path.empty() && m_path.back() == '/' )
+				m_path.pop_back();
+		}
+		m_hostHeader = url;
+		std::string port = "80";
+		size_t colon = url.rfind(':');
+		if( colon != std::string::npos )
+		{
+			port = url.substr(colon + 1);
+			url = url.substr(0, colon);
+		}
+		addrinfo hints = {};
+		hints.ai_family = AF_UNSPEC;
+		hints.ai_socktype = SOCK_STREAM;
+		addrinfo* info = 0;
+		if( getaddrinfo(url.c_str(), port.c_str(), &hints, &info) != 0 || !info )
+		{
+			m_hostError = "Could not resolve host name";
+			return;
+		}
+		memcpy(&m_address, info->ai_addr, info->ai_addrlen);
+		m_addressLength = (socklen_t)info->ai_addrlen;
+		freeaddrinfo(info);
+	}
+
+	// Moves queued requests onto the least busy connection, opening new connections up to the limit
+	void Dispatch()
+	{
+		while( !m_queue.empty() )
+		{
+			if( m_hostError )
+			{
+				Request request = std::move(m_queue.front());
+				m_queue.pop_front();
+				request.onComplete(m_hostError, 0, 0);
+				continue;
+			}
+			Connection* best = 0;
+			for( const std::unique_ptr<Connection>& c : m_connections )
+				if( c->fd >= 0 && (!best || c->inflight.size() < best->inflight.size()) )
+					best = c.get();
+			if( !best || (!best->inflight.empty() && (int)OpenCount() < m_maxConnections) )
+			{
+				Connection* opened = Open();
+				if( opened )
+					best = opened;
+			}
+			if( !best || (int)best->inflight.size() >= m_maxPipeline )
+				return;
+			Request request = std::move(m_queue.front());
+			m_queue.pop_front();
+			Write(*best, std::move(request));
+		}
+	}
+	size_t OpenCount() const
+	{
+		size_t count = 0;
+		for( const std::unique_ptr<Connection>& c : m_connections )
+			count += c->fd >= 0 ? 1 : 0;
+		return count;
+	}
+	Connection* Open()
+	{
+		int fd = socket(m_address.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+		if( fd < 0 )
+			return 0;
+		int one = 1;
+		setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+		setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &one, sizeof(one));
+		if( connect(fd, (const sockaddr*)&m_address, m_addressLength) != 0 && errno != EINPROGRESS )
+		{
+			close(fd);
+			return 0;
+		}
+		Connection* c = 0;
+		for( const std::unique_ptr<Connection>& existing : m_connections )
+			if( existing->fd < 0 )
+				c = existing.get();
+		if( !c )
+		{
+			m_connections.emplace_back(new Connection);
+			c = m_connections.back().get();
+		}
+		c->fd = fd;
+		c->connecting = true;
+		c->reused = false;
+		c->out.clear();
+		c->outBegin = 0;
+		c->in.clear();
+		c->inBegin = 0;
+		epoll_event event = {};
+		event.events = EPOLLIN | EPOLLOUT;
+		event.data.ptr = c;
+		epoll_ctl(m_epoll, EPOLL_CTL_ADD, fd, &event);
+		return c;
+	}
+	void Watch(Connection& c)
+	{
+		epoll_event event = {};
+		event.events = EPOLLIN | (c.connecting || c.outBegin < c.out.size() ? (uint32_t)EPOLLOUT : 0u);
+		event.data.ptr = &c;
+		epoll_ctl(m_epoll, EPOLL_CTL_MOD, c.fd, &event);
+	}
+	void Write(Connection& c, Request&& request)
+	{
+		char length[24];
+		snprintf(length, sizeof(length), "%zu", request.body.size());
+		c.out.append("POST ").append(request.path).append(" HTTP/1.1\r\nHost: ").append(m_hostHeader)
+		     .append("\r\nContent-Type: application/json\r\nContent-Length: ").append(length)
+		     .append("\r\nConnection: keep-alive\r\n\r\n").append(request.body);
+		c.inflight.push_back(std::move(request));
+		if( !c.connecting )
+			Send(c);
+	}
+	bool Connected(Connection& c)
+	{
+		if( c.connecting )
+		{
+			int error = 0;
+			socklen_t length = sizeof(error);
+			if( getsockopt(c.fd, SOL_SOCKET, SO_ERROR, &error, &length) != 0 || error != 0 )
+			{
+				Fail(c, "Couldn't connect to server");
+				return false;
+			}
+			c.connecting = false;
+		}
+		return true;
+	}
+	void Send(Connection& c)
+	{
+		if( !Connected(c) )
+			return;
+		while( c.outBegin < c.out.size() )
+		{
+			ssize_t sent = send(c.fd, c.out.data() + c.outBegin, c.out.size() - c.outBegin, MSG_NOSIGNAL);
+			if( sent < 0 )
+			{
+				if( errno == EAGAIN || errno == EWOULDBLOCK )
+					break;
+				if( errno == EINTR )
+					continue;
+				Receive(c); // the server may have closed the connection after responses that are still buffered
+				if( c.fd >= 0 )
+					Fail(c, "Failed to send request");
+				return;
+			}
+			c.outBegin += (size_t)sent;
+		}
+		if( c.outBegin == c.out.size() )
+		{
+			c.out.clear();
+			c.outBegin = 0;
+		}
+		Watch(c);
+	}
+	void Receive(Connection& c)
+	{
+		if( !Connected(c) )
+			return;
+		for(;;)
+		{
+			size_t used = c.in.size();
+			if( c.in.capacity() - used < 4096 )
+				c.in.reserve(Grow(c.in.capacity()));
+			c.in.resize(c.in.capacity());
+			ssize_t received = recv(c.fd, c.in.data() + used, c.in.size() - used, 0);
+			c.in.resize(used + (received > 0 ? (size_t)received : 0));
+			if( received > 0 )
+				continue;
+			if( received < 0 && errno == EINTR )
+				continue;
+			if( received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK) )
+				break;
+			ParseResponses(c);
+			return Fail(c, "Connection closed by server");
+		}
+		ParseResponses(c);
+	}
+	static size_t Grow(size_t capacity) { return capacity < 16384 ? 16384 : capacity * 2; }
+
+	// Completes every response that has been fully received, in order
+	void ParseResponses(Connection& c)
+	{
+		while( c.fd >= 0 && !c.inflight.empty() )
+		{
+			const char* begin = c.in.data() + c.inBegin;
+			const char* end = c.in.data() + c.in.size();
+			const char* headerEnd = Find(begin, end, "\r\n\r\n");
+			if( !headerEnd )
+				break;
+			int status = 0;
+			if( end - begin < 12 || memcmp(begin, "HTTP/1.", 7) != 0 || (status = atoi(begin + 9)) <= 0 )
+				return Fail(c, "Malformed HTTP response");
+			const char* statusEnd = Find(begin, headerEnd + 2, "\r\n"); // is headerEnd if there are no header lines
+			if( !statusEnd )
+				return Fail(c, "Malformed HTTP response");
+			long long contentLength = -1;
+			bool chunked = false, closeAfter = false;
+			for( const char* line = statusEnd + 2; line < headerEnd; )
+			{
+				const char* lineEnd = Find(line, headerEnd + 2, "\r\n");
+				if( HeaderIs(line, lineEnd, "content-length:") )
+					contentLength = atoll(HeaderValue(line, lineEnd));
+				else if( HeaderIs(line, lineEnd, "transfer-encoding:") )
+					chunked = Contains(HeaderValue(line, lineEnd), lineEnd, "chunked");
+				else if( HeaderIs(line, lineEnd, "connection:") )
+					closeAfter = Contains(HeaderValue(line, lineEnd), lineEnd, "close");
+				line = lineEnd + 2;
+			}
+			const char* body = headerEnd + 4;
+			const char* bodyEnd = 0;
+			size_t bodyLength = 0;
+			if( chunked )
+			{
+				bodyEnd = Dechunk(c, body, end);
+				if( !bodyEnd )
+					break;
+				bodyLength = c.chunked.size();
+			}
+			else if( contentLength >= 0 )
+			{
+				if( end - body < contentLength )
+					break;
+				bodyEnd = body + contentLength;
+				bodyLength = (size_t)contentLength;
+			}
+			else if( status == 204 || status == 304 ) // never have a body
+				bodyEnd = body;
+			else
+				return Fail(c, "HTTP response without a length is not supported");
+
+			Request request = std::move(c.inflight.front());
+			c.inflight.pop_front();
+			size_t bodyOffset = body - c.in.data();
+			c.inBegin = bodyEnd - c.in.data();
+			c.reused = true;
+			if( status != 200 )
+				request.onComplete("Malformed RPC request or endpoint: unexpected HTTP response status", 0, 0);
+			else if( chunked )
+				request.onComplete(0, &c.chunked[0], bodyLength);
+			else
+			{
+				// terminate the body in place for the duration of the callback; the next response may follow it
+				bool appended = c.inBegin == c.in.size();
+				if( appended )
+					c.in.push_back('\0');
+				char following = c.in[c.inBegin];
+				c.in[c.inBegin] = '\0';
+				request.onComplete(0, c.in.data() + bodyOffset, bodyLength);
+				if( appended )
+					c.in.pop_back();
+				else
+					c.in[c.inBegin] = following;
+			}
+			if( closeAfter )
+				return Fail(c, "Connection closed by server", true);
+		}
+		if( c.inBegin == c.in.size() )
+		{
+			c.in.clear(); // keeps its capacity
+			c.inBegin = 0;
+		}
+		else if( c.inBegin > c.in.size() / 2 )
+		{
+			c.in.erase(c.in.begin(), c.in.begin() + c.inBegin);
+			c.inBegin = 0;
+		}
+	}
+	// Decodes a chunked body into c.chunked, returning the end of the encoded body, or null if it is incomplete
+	static const char* Dechunk(Connection& c, const char* begin, const char* end)
+	{
+		c.chunked.clear();
+		for(;;)
+		{
+			const char* lineEnd = Find(begin, end, "\r\n");
+			if( !lineEnd )
+				return 0;
+			size_t size = (size_t)strtoull(begin, 0, 16);
+			begin = lineEnd + 2;
+			if( size == 0 )
+			{
+				const char* trailerEnd = begin + 2 <= end && begin[0] == '\r' && begin[1] == '\n' ? begin : Find(begin, end, "\r\n\r\n");
+				return trailerEnd ? trailerEnd + (trailerEnd == begin ? 2 : 4) : 0;
+			}
+			if( (size_t)(end - begin) < size + 2 )
+				return 0;
+			c.chunked.append(begin, size);
+			begin += size + 2;
+		}
+	}
+	static const char* Find(const char* begin, const char* end, const char* text)
+	{
+		size_t length = strlen(text);
+		for( const char* i = begin; i + length <= end; ++i )
+			if( memcmp(i, text, length) == 0 )
+				return i;
+		return 0;
+	}
+	static bool HeaderIs(const char* line, const char* lineEnd, const char* name)
+	{
+		size_t length = strlen(name);
+		return (size_t)(lineEnd - line) >= length && strncasecmp(line, name, length) == 0;
+	}
+	static const char* HeaderValue(const char* line, const char* lineEnd)
+	{
+		const char* value = (const char*)memchr(line, ':', lineEnd - line) + 1;
+		while( value < lineEnd && *value == ' ' )
+			++value;
+		return value;
+	}
+	static bool Contains(const char* begin, const char* end, const char* text)
+	{
+		for( const char* i = begin; i < end; ++i )
+			if( strncasecmp(i, text, strlen(text)) == 0 )
+				return true;
+		return false;
+	}
+
+	// Closes a connection. Requests whose response had not started to arrive are queued again once, as the server
+	//  may close a kept-alive connection at any time; the others fail. If the server announced that it would close
+	//  the connection, the requests after that response were never processed, so are always queued again.
+	void Fail(Connection& c, const char* error, bool unprocessed = false)
+	{
+		epoll_ctl(m_epoll, EPOLL_CTL_DEL, c.fd, 0);
+		close(c.fd);
+		c.fd = -1;
+		bool partial = c.inBegin < c.in.size();
+		std::deque<Request> inflight;
+		inflight.swap(c.inflight);
+		c.out.clear();
+		c.outBegin = 0;
+		c.in.clear();
+		c.inBegin = 0;
+		for( size_t i = inflight.size(); i-- > 0; )
+		{
+			Request& request = inflight[i];
+			if( unprocessed )
+				m_queue.push_front(std::move(request));
+			else if( c.reused && !request.retried && !(i == 0 && partial) )
+			{
+				request.retried = true;
+				m_queue.push_front(std::move(request));
+			}
+			else
+				request.onComplete(error, 0, 0);
+		}
+	}
+};
+
+#ifdef PHANTASMA_RAPIDJSON
+static rapidjson::Document& HttpPost(EpollHttpClient& client, const json::Char* uri, const RapidJsonBufferWriter& data, rpc::PhantasmaError* err)
+{
+	const char* request = data.buf.GetString();
+	const char* error = 0;
+	if( !client.Post(request, strlen(request), uri, &error) && err )
+		rpc::OnHttpError(*err, error);
+	return client.doc.Parse<0>(client.result.c_str());
+}
+template<class Callback>
+static void HttpPostAsync(EpollHttpClient& client, const json::Char* uri, const RapidJsonBufferWriter& data, Callback onComplete)
+{
+	const char* request = data.buf.GetString();
+	client.PostAsync(request, strlen(request), uri, [onComplete](const char* error, char* body, size_t length)
+	{
+		if( error )
+			return onComplete(nullptr, error);
+		rapidjson::Document doc;
+		doc.ParseInsitu<0>(body);
+		onComplete(&doc, nullptr);
+	});
+}
+#else
+static PHANTASMA_STRING HttpPost(EpollHttpClient& client, const PHANTASMA_CHAR* uri, const PHANTASMA_STRINGBUILDER& data, rpc::PhantasmaError* err)
+{
+	const PHANTASMA_STRING& request = data.str();
+	const char* error = 0;
+	if( !client.Post(request.c_str(), request.length(), uri, &error) && err )
+		rpc::OnHttpError(*err, error);
+	return client.result;
+}
+template<class Callback>
+static void HttpPostAsync(EpollHttpClient& client, const PHANTASMA_CHAR* uri, const PHANTASMA_STRINGBUILDER& data, Callback onComplete)
+{
+	const PHANTASMA_STRING& request = data.str();
+	client.PostAsync(request.c_str(), request.length(), uri, [onComplete](const char* error, char* body, size_t length)
+	{
+		if( error )
+			return onComplete(nullptr, error);
+#ifdef PHANTASMA_JSONDOCUMENT
+		const PHANTASMA_JSONDOCUMENT doc(body, length);
+#else
+		const PHANTASMA_STRING doc(body, length);
+#endif
+		onComplete(&doc, nullptr);
+	});
+}
+#endif
+
+#ifndef PHANTASMA_HTTPCLIENT
+# define PHANTASMA_HTTPCLIENT       EpollHttpClient
+#endif
+#ifndef PHANTASMA_ASYNC_HTTPCLIENT
+# define PHANTASMA_ASYNC_HTTPCLIENT EpollHttpClient
+#endif
+
+}
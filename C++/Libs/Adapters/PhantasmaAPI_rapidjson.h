@@ -13,6 +13,9 @@
 #include "rapidjson/document.h"
 #include "rapidjson/writer.h"
 #include "rapidjson/stringbuffer.h"
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+# include <string_view>
+#endif
 
 #ifndef PHANTASMA_STRING
 # include <string>
@@ -41,6 +44,18 @@ struct RapidJsonBufferWriter
 	RapidJsonBufferWriter() : w(buf) {}
 };
 
+struct RapidJsonArrayCursor
+{
+	rapidjson::Value::ConstValueIterator it  = nullptr;
+	rapidjson::Value::ConstValueIterator end = nullptr;
+};
+
+struct RapidJsonObjectCursor
+{
+	rapidjson::Value::ConstMemberIterator it;
+	rapidjson::Value::ConstMemberIterator end;
+};
+
 namespace json {
 	typedef PHANTASMA_STRING String;
 	typedef PHANTASMA_CHAR   Char;
@@ -57,16 +72,32 @@ namespace json {
 	inline int32_t                 AsInt32(      const rapidjson::Value& v,                    bool& out_error) { return v.IsString() ? ( int32_t)std::strtoll(v.GetString(), 0, 10) : (v.IsInt() ? v.GetInt() : (out_error=true, 0)); }
 	inline uint32_t                AsUInt32(     const rapidjson::Value& v,                    bool& out_error) { return v.IsString() ? (uint32_t)std::strtoll(v.GetString(), 0, 10) : (v.IsUint() ? v.GetUint() : (out_error=true, 0)); }
 	inline String                  AsString(     const rapidjson::Value& v,                    bool& out_error) { return (String)(v.IsString() ? v.GetString() : ""); }
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+	inline std::basic_string_view<Char> AsStringView(const rapidjson::Value& v,               bool& out_error) { return v.IsString() ? std::basic_string_view<Char>(v.GetString(), v.GetStringLength()) : std::basic_string_view<Char>(); }
+#endif
 	inline const rapidjson::Value& AsArray(      const rapidjson::Value& v,                    bool& out_error) { return v; }
 	inline bool                    IsArray(      const rapidjson::Value& v,                    bool& out_error) { return v.IsArray(); }
 	inline bool                    IsObject(     const rapidjson::Value& v,                    bool& out_error) { return v.IsObject(); }
 
 	inline int                     ArraySize( const rapidjson::Value& v,            bool& out_error) { return v.Size(); }
 	inline const rapidjson::Value& IndexArray(const rapidjson::Value& v, int index, bool& out_error) { return v[index]; }
+
+	inline RapidJsonArrayCursor    ArrayBegin(const rapidjson::Value& v,            bool& out_error) { return v.IsArray() ? RapidJsonArrayCursor{v.Begin(), v.End()} : (out_error=true, RapidJsonArrayCursor{}); }
+	inline bool                    ArrayValid(const RapidJsonArrayCursor& c,        bool&)           { return c.it != c.end; }
+	inline void                    ArrayNext(       RapidJsonArrayCursor& c,        bool&)           { ++c.it; }
+	inline const rapidjson::Value& ArrayValue(const RapidJsonArrayCursor& c,        bool&)           { return *c.it; }
+
+	inline RapidJsonObjectCursor   ObjectBegin(const rapidjson::Value& v,           bool& out_error) { return v.IsObject() ? RapidJsonObjectCursor{v.MemberBegin(), v.MemberEnd()} : (out_error=true, RapidJsonObjectCursor{}); }
+	inline bool                    ObjectValid(const RapidJsonObjectCursor& c,      bool&)           { return c.it != c.end; }
+	inline void                    ObjectNext(       RapidJsonObjectCursor& c,      bool&)           { ++c.it; }
+	inline const Char*             ObjectKey(  const RapidJsonObjectCursor& c, size_t& out_length, bool&) { out_length = c.it->name.GetStringLength(); return c.it->name.GetString(); }
+	inline const rapidjson::Value& ObjectValue(const RapidJsonObjectCursor& c,      bool&)           { return c.it->value; }
 	
 	typedef RapidJsonBufferWriter Builder;
 	inline void BeginObject(Builder& b)                                   { b.w.StartObject(); }
 	inline void EndObject(Builder& b)                                     { b.w.EndObject();}
+	inline void BeginArray(Builder& b)                                    { b.w.StartArray(); }
+	inline void EndArray(Builder& b)                                      { b.w.EndArray(); }
 	inline void AddString(Builder& b, const Char* key, const Char* value) { b.w.String(key); b.w.String(value); }
 	inline void AddValues(Builder& ar)                                    {}
 	inline void AddValues(Builder& b, const Char* arg)                    { b.w.String(arg); }
@@ -90,6 +121,8 @@ namespace json {
 typedef const rapidjson::Value&    RapidJsonValueRef;
 #define PHANTASMA_JSONVALUE        RapidJsonValueRef
 #define PHANTASMA_JSONARRAY        rapidjson::Value
+#define PHANTASMA_JSONARRAYCURSOR  RapidJsonArrayCursor
+#define PHANTASMA_JSONOBJECTCURSOR RapidJsonObjectCursor
 #define PHANTASMA_JSONDOCUMENT     rapidjson::Document
 #define PHANTASMA_JSONBUILDER      RapidJsonBufferWriter
 
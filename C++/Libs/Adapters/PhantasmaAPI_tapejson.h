@@ -0,0 +1,504 @@
+#pragma once
+#ifdef PHANTASMA_API_INCLUDED
+#error "Include JSON API adaptors immediately before including PhantasmaAPI.h"
+#endif
+#define PHANTASMA_TAPEJSON
+#ifdef PHANTASMA_RAPIDJSON
+#error "The tape JSON adaptor cannot be combined with the RapidJSON adaptor"
+#endif
+//------------------------------------------------------------------------------
+// This header supplies the Phantasma API with a dependency-free JSON parser
+//  that tokenizes a response exactly once into a flat "tape" of nodes.
+//
+// Unlike the built-in parser (which re-scans the document text on every field
+//  lookup and array index), JSONValue/JSONArray become small handles into the
+//  tape, so LookupValue is O(fields in the object) and IndexArray is O(1).
+//  Array cursors walk the elements table directly, and object cursors hop
+//  from key to key along each value's next-sibling link.
+//
+// Usage with the low-level API:
+//   json::TapeDocument doc(responseText);
+//   PhantasmaJsonAPI::ParseGetBlockByHeightResponse(json::Parse(doc), block, &err);
+//
+// The libCurl adaptor can be included after this file to provide HTTP.
+//------------------------------------------------------------------------------
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+# include <deque>
+# include <string_view>
+#endif
+
+#ifndef PHANTASMA_STRING
+# ifdef _UNICODE
+#  define PHANTASMA_STRING std::wstring
+# else
+#  define PHANTASMA_STRING std::string
+# endif
+#endif
+
+#ifndef PHANTASMA_CHAR
+# ifdef _UNICODE
+#  define PHANTASMA_CHAR wchar_t
+# else
+#  define PHANTASMA_CHAR char
+# endif
+#endif
+
+namespace phantasma {
+namespace json {
+typedef PHANTASMA_STRING String;
+typedef PHANTASMA_CHAR   Char;
+
+enum class TapeType : uint8_t
+{
+	Invalid,
+	Object,
+	Array,
+	String,
+	Number,
+	True,
+	False,
+	Null,
+};
+
+struct TapeNode
+{
+	TapeType type;
+	bool     escaped;  // strings only: the text contains escape sequences and must be decoded
+	uint32_t begin;    // offset of the token in the document text (strings: excluding the quotes)
+	uint32_t end;      // offset one past the end of the token (strings: excluding the quotes)
+	uint32_t next;     // tape index one past this node's subtree, i.e. its next sibling
+	uint32_t count;    // arrays: number of elements. objects: number of key/value pairs
+	uint32_t elements; // arrays: offset into TapeDocument::Elements() of the first element's tape index
+};
+
+class TapeDocument
+{
+public:
+	constexpr static int MaxDepth = 512;
+
+	TapeDocument() {}
+	TapeDocument(const String& text) : m_text(text) { Tokenize(); }
+	TapeDocument(String&& text) : m_text(std::move(text)) { Tokenize(); }
+	TapeDocument(const Char* text) : m_text(text ? String(text) : String()) { Tokenize(); }
+	TapeDocument(const Char* text, size_t length) : m_text(text, length) { Tokenize(); }
+
+	void Reset(const Char* text, size_t length)
+	{
+		m_text.assign(text, length);
+		Tokenize();
+	}
+
+	bool                         Valid()    const { return !m_tape.empty(); }
+	const String&                Text()     const { return m_text; }
+	const std::vector<TapeNode>& Tape()     const { return m_tape; }
+	const std::vector<uint32_t>& Elements() const { return m_elements; }
+	const TapeNode&              Node(uint32_t i)         const { return m_tape[i]; }
+	uint32_t                     Element(uint32_t i)      const { return m_elements[i]; }
+	const Char*                  Data(const TapeNode& n)  const { return m_text.data() + n.begin; }
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+	// Stores a decoded copy of an escaped string, for views that must live as long as this document
+	std::basic_string_view<Char> Keep(String&& decoded) const { m_decoded.push_back(std::move(decoded)); return m_decoded.back(); }
+#endif
+private:
+	String                m_text;
+	std::vector<TapeNode> m_tape;
+	std::vector<uint32_t> m_elements;
+	std::vector<uint32_t> m_scratch; // element indices of arrays that are still open
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+	mutable std::deque<String> m_decoded;
+#endif
+
+	void Tokenize()
+	{
+		m_tape.clear();
+		m_elements.clear();
+		m_scratch.clear();
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+		m_decoded.clear();
+#endif
+		m_tape.reserve(m_text.size() / 8 + 1);
+		size_t i = 0;
+		bool error = !ParseValue(i, 0) || SkipSpace(i) != m_text.size();
+		if( error ) // an empty tape is reported as invalid JSON by PhantasmaJsonAPI::CheckResponse
+		{
+			m_tape.clear();
+			m_elements.clear();
+		}
+		m_scratch.clear();
+	}
+
+	static bool IsSpace(Char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+	size_t SkipSpace(size_t& i) const
+	{
+		const size_t size = m_text.size();
+		while( i < size && IsSpace(m_text[i]) )
+			++i;
+		return i;
+	}
+	uint32_t Push(TapeType type, size_t begin, size_t end)
+	{
+		uint32_t index = (uint32_t)m_tape.size();
+		m_tape.push_back(TapeNode{ type, false, (uint32_t)begin, (uint32_t)end, index + 1, 0, 0 });
+		return index;
+	}
+	bool ParseValue(size_t& i, int depth)
+	{
+		if( SkipSpace(i) >= m_text.size() || depth > MaxDepth )
+			return false;
+		switch( m_text[i] )
+		{
+		case '{': return ParseObject(i, depth);
+		case '[': return ParseArray(i, depth);
+		case '"': return ParseString(i);
+		case 't': return ParseLiteral(i, "true",  4, TapeType::True);
+		case 'f': return ParseLiteral(i, "false", 5, TapeType::False);
+		case 'n': return ParseLiteral(i, "null",  4, TapeType::Null);
+		default:  return ParseNumber(i);
+		}
+	}
+	bool ParseLiteral(size_t& i, const char* literal, size_t length, TapeType type)
+	{
+		if( m_text.size() - i < length )
+			return false;
+		for( size_t j = 0; j != length; ++j )
+			if( m_text[i + j] != (Char)literal[j] )
+				return false;
+		Push(type, i, i + length);
+		i += length;
+		return true;
+	}
+	bool ParseNumber(size_t& i)
+	{
+		const size_t size = m_text.size();
+		size_t begin = i;
+		for( ; i < size; ++i )
+		{
+			Char c = m_text[i];
+			if( !((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') )
+				break;
+		}
+		if( i == begin )
+			return false;
+		Push(TapeType::Number, begin, i);
+		return true;
+	}
+	bool ParseString(size_t& i)
+	{
+		const size_t size = m_text.size();
+		size_t begin = ++i;
+		bool escaped = false;
+		while( i < size )
+		{
+			Char c = m_text[i];
+			if( c == '"' )
+			{
+				uint32_t node = Push(TapeType::String, begin, i);
+				m_tape[node].escaped = escaped;
+				++i;
+				return true;
+			}
+			if( c == '\\' )
+			{
+				escaped = true;
+				i += 2;
+				continue;
+			}
+			++i;
+		}
+		return false;
+	}
+	bool ParseArray(size_t& i, int depth)
+	{
+		uint32_t node = Push(TapeType::Array, i, i);
+		size_t scratchBase = m_scratch.size();
+		++i;
+		if( SkipSpace(i) < m_text.size() && m_text[i] == ']' )
+			++i;
+		else for(;;)
+		{
+			m_scratch.push_back((uint32_t)m_tape.size());
+			if( !ParseValue(i, depth + 1) )
+				return false;
+			if( SkipSpace(i) >= m_text.size() )
+				return false;
+			Char c = m_text[i++];
+			if( c == ']' )
+				break;
+			if( c != ',' )
+				return false;
+		}
+		TapeNode& n = m_tape[node];
+		n.end      = (uint32_t)i;
+		n.next     = (uint32_t)m_tape.size();
+		n.count    = (uint32_t)(m_scratch.size() - scratchBase);
+		n.elements = (uint32_t)m_elements.size();
+		m_elements.insert(m_elements.end(), m_scratch.begin() + scratchBase, m_scratch.end());
+		m_scratch.resize(scratchBase);
+		return true;
+	}
+	bool ParseObject(size_t& i, int depth)
+	{
+		uint32_t node = Push(TapeType::Object, i, i);
+		uint32_t count = 0;
+		++i;
+		if( SkipSpace(i) < m_text.size() && m_text[i] == '}' )
+			++i;
+		else for(;;)
+		{
+			if( SkipSpace(i) >= m_text.size() || m_text[i] != '"' || !ParseString(i) )
+				return false;
+			if( SkipSpace(i) >= m_text.size() || m_text[i] != ':' )
+				return false;
+			++i;
+			if( !ParseValue(i, depth + 1) )
+				return false;
+			++count;
+			if( SkipSpace(i) >= m_text.size() )
+				return false;
+			Char c = m_text[i++];
+			if( c == '}' )
+				break;
+			if( c != ',' )
+				return false;
+		}
+		TapeNode& n = m_tape[node];
+		n.end   = (uint32_t)i;
+		n.next  = (uint32_t)m_tape.size();
+		n.count = count;
+		return true;
+	}
+};
+
+struct TapeValue // A handle to a node within a TapeDocument, which must outlive it
+{
+	const TapeDocument* doc  = nullptr;
+	uint32_t            node = 0;
+
+	const TapeNode* Node() const { return doc && doc->Valid() ? &doc->Node(node) : nullptr; }
+	bool operator==(const TapeValue& o) const { return doc == o.doc && node == o.node; }
+	bool operator!=(const TapeValue& o) const { return !(*this == o); }
+};
+
+inline TapeType TypeOf(const TapeValue& v) { const TapeNode* n = v.Node(); return n ? n->type : TapeType::Invalid; }
+
+inline void AppendUtf(String& out, uint32_t cp)
+{
+	if( sizeof(Char) > 1 || cp < 0x80 ) { out.push_back((Char)cp); return; }
+	if( cp < 0x800 )   { out.push_back((Char)(0xC0 | (cp >> 6))); }
+	else if( cp < 0x10000 ) { out.push_back((Char)(0xE0 | (cp >> 12)));                  out.push_back((Char)(0x80 | ((cp >> 6) & 0x3F))); }
+	else               { out.push_back((Char)(0xF0 | (cp >> 18))); out.push_back((Char)(0x80 | ((cp >> 12) & 0x3F))); out.push_back((Char)(0x80 | ((cp >> 6) & 0x3F))); }
+	out.push_back((Char)(0x80 | (cp & 0x3F)));
+}
+inline bool ParseHex4(const Char* s, const Char* end, uint32_t& out)
+{
+	if( end - s < 4 )
+		return false;
+	out = 0;
+	for( int i = 0; i != 4; ++i )
+	{
+		Char c = s[i];
+		out <<= 4;
+		if( c >= '0' && c <= '9' )      out |= (uint32_t)(c - '0');
+		else if( c >= 'a' && c <= 'f' ) out |= (uint32_t)(c - 'a' + 10);
+		else if( c >= 'A' && c <= 'F' ) out |= (uint32_t)(c - 'A' + 10);
+		else return false;
+	}
+	return true;
+}
+inline String DecodeString(const TapeDocument& doc, const TapeNode& n, bool& out_error)
+{
+	const Char* s   = doc.Data(n);
+	const Char* end = s + (n.end - n.begin);
+	if( !n.escaped )
+		return String(s, end);
+	String out;
+	out.reserve(end - s);
+	while( s < end )
+	{
+		Char c = *s++;
+		if( c != '\\' ) { out.push_back(c); continue; }
+		if( s == end ) { out_error = true; break; }
+		switch( c = *s++ )
+		{
+		case '"': case '\\': case '/': out.push_back(c); break;
+		case 'b': out.push_back('\b'); break;
+		case 'f': out.push_back('\f'); break;
+		case 'n': out.push_back('\n'); break;
+		case 'r': out.push_back('\r'); break;
+		case 't': out.push_back('\t'); break;
+		case 'u':
+		{
+			uint32_t cp, lo;
+			if( !ParseHex4(s, end, cp) ) { out_error = true; return out; }
+			s += 4;
+			if( cp >= 0xD800 && cp < 0xDC00 && end - s >= 6 && s[0] == '\\' && s[1] == 'u' && ParseHex4(s + 2, end, lo) && lo >= 0xDC00 && lo < 0xE000 )
+			{
+				cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+				s += 6;
+			}
+			AppendUtf(out, cp);
+			break;
+		}
+		default: out_error = true; break;
+		}
+	}
+	return out;
+}
+inline int64_t DecodeInteger(const TapeDocument& doc, const TapeNode& n, bool& out_error)
+{
+	const Char* s   = doc.Data(n);
+	const Char* end = s + (n.end - n.begin);
+	bool negative = s != end && *s == '-';
+	if( negative || (s != end && *s == '+') )
+		++s;
+	if( s == end || *s < '0' || *s > '9' ) { out_error = true; return 0; }
+	int64_t value = 0;
+	for( ; s != end && *s >= '0' && *s <= '9'; ++s )
+		value = value * 10 + (*s - '0');
+	return negative ? -value : value;
+}
+
+inline TapeValue Parse(const TapeDocument& d) { return d.Valid() ? TapeValue{ &d, 0 } : TapeValue{}; }
+
+inline TapeValue LookupValue(const TapeValue& v, const Char* field, bool& out_error)
+{
+	const TapeNode* obj = v.Node();
+	if( !obj || obj->type != TapeType::Object ) { out_error = true; return TapeValue{}; }
+	const TapeDocument& doc = *v.doc;
+	size_t fieldLen = std::char_traits<Char>::length(field);
+	uint32_t key = v.node + 1;
+	for( uint32_t i = 0; i != obj->count; ++i )
+	{
+		const TapeNode& k = doc.Node(key);
+		uint32_t value = key + 1;
+		if( !k.escaped )
+		{
+			if( k.end - k.begin == fieldLen && 0 == std::char_traits<Char>::compare(doc.Data(k), field, fieldLen) )
+				return TapeValue{ &doc, value };
+		}
+		else if( DecodeString(doc, k, out_error) == field )
+			return TapeValue{ &doc, value };
+		key = doc.Node(value).next;
+	}
+	return TapeValue{};
+}
+inline bool AsBool(const TapeValue& v, bool& out_error)
+{
+	switch( TypeOf(v) )
+	{
+	case TapeType::True:  return true;
+	case TapeType::False: return false;
+	default: out_error = true; return false;
+	}
+}
+inline int32_t AsInt32(const TapeValue& v, bool& out_error)
+{
+	TapeType type = TypeOf(v);
+	if( type != TapeType::Number && type != TapeType::String ) { out_error = true; return 0; }
+	return (int32_t)DecodeInteger(*v.doc, *v.Node(), out_error);
+}
+inline uint32_t  AsUInt32(const TapeValue& v, bool& out_error) { return (uint32_t)AsInt32(v, out_error); }
+inline String    AsString(const TapeValue& v, bool& out_error)
+{
+	if( TypeOf(v) != TapeType::String ) { out_error = true; return String(); }
+	return DecodeString(*v.doc, *v.Node(), out_error);
+}
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+inline std::basic_string_view<Char> AsStringView(const TapeValue& v, bool& out_error)
+{
+	if( TypeOf(v) != TapeType::String ) { out_error = true; return std::basic_string_view<Char>(); }
+	const TapeNode& n = *v.Node();
+	if( !n.escaped )
+		return std::basic_string_view<Char>(v.doc->Data(n), n.end - n.begin);
+	return v.doc->Keep(DecodeString(*v.doc, n, out_error));
+}
+#endif
+inline bool      IsArray( const TapeValue& v, bool& out_error) { const TapeNode* n = v.Node(); if( !n ) { out_error = true; return false; } return n->type == TapeType::Array; }
+inline bool      IsObject(const TapeValue& v, bool& out_error) { const TapeNode* n = v.Node(); if( !n ) { out_error = true; return false; } return n->type == TapeType::Object; }
+inline TapeValue AsArray( const TapeValue& v, bool& out_error) { if( !IsArray(v, out_error) ) { out_error = true; } return v; }
+
+inline bool      LookupBool(   const TapeValue& v, const Char* field, bool& out_error) { return AsBool(  LookupValue(v, field, out_error), out_error); }
+inline int32_t   LookupInt32(  const TapeValue& v, const Char* field, bool& out_error) { return AsInt32( LookupValue(v, field, out_error), out_error); }
+inline uint32_t  LookupUInt32( const TapeValue& v, const Char* field, bool& out_error) { return AsUInt32(LookupValue(v, field, out_error), out_error); }
+inline String    LookupString( const TapeValue& v, const Char* field, bool& out_error) { return AsString(LookupValue(v, field, out_error), out_error); }
+inline TapeValue LookupArray(  const TapeValue& v, const Char* field, bool& out_error) { return AsArray( LookupValue(v, field, out_error), out_error); }
+inline bool      HasField(     const TapeValue& v, const Char* field, bool& out_error) { return TapeValue{} != LookupValue(v, field, out_error); }
+inline bool      HasArrayField(const TapeValue& v, const Char* field, bool& out_error) { return TypeOf(LookupValue(v, field, out_error)) == TapeType::Array; }
+
+inline int ArraySize(const TapeValue& v, bool& out_error)
+{
+	const TapeNode* n = v.Node();
+	if( !n || n->type != TapeType::Array ) { out_error = true; return 0; }
+	return (int)n->count;
+}
+inline TapeValue IndexArray(const TapeValue& v, int index, bool& out_error)
+{
+	const TapeNode* n = v.Node();
+	if( !n || n->type != TapeType::Array ) { out_error = true; return TapeValue{}; }
+	if( index < 0 || (uint32_t)index >= n->count ) { out_error = true; return TapeValue{}; }
+	return TapeValue{ v.doc, v.doc->Element(n->elements + (uint32_t)index) };
+}
+
+struct TapeArrayCursor // Walks a run of TapeDocument::Elements()
+{
+	const TapeDocument* doc      = nullptr;
+	uint32_t            position = 0;
+	uint32_t            end      = 0;
+};
+
+inline TapeArrayCursor ArrayBegin(const TapeValue& v, bool& out_error)
+{
+	const TapeNode* n = v.Node();
+	if( !n || n->type != TapeType::Array ) { out_error = true; return TapeArrayCursor{}; }
+	return TapeArrayCursor{ v.doc, n->elements, n->elements + n->count };
+}
+inline bool      ArrayValid(const TapeArrayCursor& c, bool& out_error) { return !out_error && c.position < c.end; }
+inline void      ArrayNext(       TapeArrayCursor& c, bool&)           { ++c.position; }
+inline TapeValue ArrayValue(const TapeArrayCursor& c, bool&)           { return TapeValue{ c.doc, c.doc->Element(c.position) }; }
+
+struct TapeObjectCursor // Walks the key/value siblings of an object node
+{
+	const TapeDocument* doc       = nullptr;
+	uint32_t            key       = 0;
+	uint32_t            remaining = 0;
+	mutable String      decoded; // escaped keys only
+};
+
+inline TapeObjectCursor ObjectBegin(const TapeValue& v, bool& out_error)
+{
+	const TapeNode* n = v.Node();
+	if( !n || n->type != TapeType::Object ) { out_error = true; return TapeObjectCursor{}; }
+	return TapeObjectCursor{ v.doc, v.node + 1, n->count, {} };
+}
+inline bool ObjectValid(const TapeObjectCursor& c, bool& out_error) { return !out_error && c.remaining != 0; }
+inline void ObjectNext(TapeObjectCursor& c, bool&)
+{
+	c.key = c.doc->Node(c.key + 1).next;
+	--c.remaining;
+}
+inline const Char* ObjectKey(const TapeObjectCursor& c, size_t& out_length, bool& out_error)
+{
+	const TapeNode& k = c.doc->Node(c.key);
+	if( !k.escaped )
+	{
+		out_length = k.end - k.begin;
+		return c.doc->Data(k);
+	}
+	c.decoded = DecodeString(*c.doc, k, out_error);
+	out_length = c.decoded.size();
+	return c.decoded.c_str();
+}
+inline TapeValue ObjectValue(const TapeObjectCursor& c, bool&)           { return TapeValue{ c.doc, c.key + 1 }; }
+}
+
+#define PHANTASMA_JSONVALUE        json::TapeValue
+#define PHANTASMA_JSONARRAY        json::TapeValue
+#define PHANTASMA_JSONARRAYCURSOR  json::TapeArrayCursor
+#define PHANTASMA_JSONOBJECTCURSOR json::TapeObjectCursor
+#define PHANTASMA_JSONDOCUMENT     json::TapeDocument
+
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "../Cryptography/SHA.h"
+#include "../Cryptography/Hash.h"
+#include "../Cryptography/Address.h"
+#include "../Cryptography/Signature.h"
+#include "../Domain/Event.h"
+#include "../Numerics/Base16.h"
+#include "../Utils/Timestamp.h"
+#include "../Utils/Serializable.h"
+
+namespace phantasma
+{
+
+// A block as returned by GetRawBlockByHeight / GetRawBlockByHash (Base16 of its binary serialization).
+// Decoding it is much cheaper than parsing the JSON of GetBlockByHeight, which encodes the same data as text.
+// The block only lists the hashes of its transactions; their bodies are fetched with GetRawTransaction and
+//  decoded with Transaction::Unserialize.
+class Block : public Serializable
+{
+public:
+	struct TransactionEntry
+	{
+		Hash                     hash;
+		PHANTASMA_VECTOR<Event>  events;
+		ByteArray                result;
+		bool                     hasResult = false;
+	};
+	struct OracleEntry
+	{
+		String    url;
+		ByteArray content;
+	};
+private:
+	BigInteger m_height;
+	Timestamp m_timestamp;
+	Hash m_previousHash;
+	Address m_chainAddress;
+	UInt32 m_protocol = 0;
+	PHANTASMA_VECTOR<TransactionEntry> m_transactions;
+	PHANTASMA_VECTOR<OracleEntry> m_oracleData;
+	Address m_validator;
+	ByteArray m_payload;
+	Signature m_signature;
+	Hash m_hash;
+public:
+	const BigInteger& Height() const { return m_height; }
+	const Timestamp   Time() const { return m_timestamp; }
+	const Hash&       PreviousHash() const { return m_previousHash; }
+	const Address&    ChainAddress() const { return m_chainAddress; }
+	UInt32            Protocol() const { return m_protocol; }
+	const PHANTASMA_VECTOR<TransactionEntry>& Transactions() const { return m_transactions; }
+	const PHANTASMA_VECTOR<OracleEntry>&      OracleData() const { return m_oracleData; }
+	const Address&    Validator() const { return m_validator; }
+	const ByteArray&  Payload() const { return m_payload; }
+	const Signature&  GetSignature() const { return m_signature; }
+	const Hash        GetHash() const { return m_hash; }
+
+	template<class BinaryReader>
+	static Block Unserialize( BinaryReader& reader )
+	{
+		Block block;
+		block.UnserializeData( reader );
+		return block;
+	}
+
+	// Decodes the result of GetRawBlockByHeight / GetRawBlockByHash. Returns false if it is not a valid block.
+	static bool FromRawBlock( const String& rawBlock, Block& output )
+	{
+		ByteArray bytes = Base16::Decode( rawBlock );
+		if( bytes.empty() )
+			return false;
+		BinaryReader reader( bytes );
+		PHANTASMA_TRY
+		{
+			output.UnserializeData( reader );
+		}
+		PHANTASMA_CATCH_ALL()
+		{
+			return false;
+		}
+		return !reader.Error();
+	}
+
+	template<class BinaryReader>
+	void UnserializeData( BinaryReader& reader )
+	{
+		UInt32 start = reader.Position();
+		Int64 varInt = 0;
+		reader.ReadBigInteger(m_height);
+		reader.Read(m_timestamp.Value);
+		reader.ReadHash(m_previousHash);
+		reader.ReadAddress(m_chainAddress);
+		reader.ReadVarInt(varInt);
+		m_protocol = (UInt32)varInt;
+
+		reader.ReadVarInt(varInt);
+		int transactionCount = (int)varInt;
+		m_transactions.clear();
+		m_transactions.reserve(Reservable(reader, transactionCount));
+		for(int i = 0; i < transactionCount && !reader.Error(); i++)
+		{
+			m_transactions.emplace_back();
+			TransactionEntry& tx = m_transactions.back();
+			reader.ReadHash(tx.hash);
+			reader.ReadVarInt(varInt);
+			int eventCount = (int)varInt;
+			tx.events.reserve(Reservable(reader, eventCount));
+			for(int j = 0; j < eventCount && !reader.Error(); j++)
+			{
+				tx.events.push_back(Event::Unserialize(reader));
+			}
+			int16_t resultLength = 0;
+			reader.Read(resultLength); // -1 when the transaction has no result
+			tx.hasResult = resultLength >= 0;
+			if( resultLength > 0 )
+				reader.ReadByteArray(tx.result);
+		}
+
+		reader.ReadVarInt(varInt);
+		int oracleCount = (int)varInt;
+		m_oracleData.clear();
+		for(int i = 0; i < oracleCount && !reader.Error(); i++)
+		{
+			m_oracleData.emplace_back();
+			reader.ReadVarString(m_oracleData.back().url);
+			reader.ReadByteArray(m_oracleData.back().content);
+		}
+
+		reader.ReadAddress(m_validator);
+		reader.ReadByteArray(m_payload);
+		UInt32 end = reader.Position();
+
+		// as with transactions, the signature is optional
+		PHANTASMA_TRY
+		{
+			if( end < reader.ToArray().size() )
+				reader.ReadSignature(m_signature);
+		}
+		PHANTASMA_CATCH_ALL()
+		{
+			m_signature = Signature();
+		}
+
+		// the hash covers everything but the signature
+		const ByteArray& bytes = reader.ToArray();
+		Byte hash[PHANTASMA_SHA256_LENGTH];
+		if( !reader.Error() && end > start && end <= bytes.size() )
+		{
+			SHA256( hash, PHANTASMA_SHA256_LENGTH, &bytes[start], (int)(end - start) );
+			m_hash = Hash( hash, PHANTASMA_SHA256_LENGTH );
+		}
+	}
+private:
+	// The counts in the stream are not trusted, so never reserve more entries than the remaining bytes could hold
+	template<class BinaryReader>
+	static size_t Reservable( BinaryReader& reader, int count )
+	{
+		size_t remaining = reader.ToArray().size() - PHANTASMA_MIN((size_t)reader.Position(), reader.ToArray().size());
+		return count > 0 ? PHANTASMA_MIN((size_t)count, remaining) : 0;
+	}
+};
+
+}
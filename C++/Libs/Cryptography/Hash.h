@@ -1,7 +1,7 @@
 #pragma once
 
 #include "../Numerics/Base16.h"
-#include "../Numerics/BigInteger.h"
+#include "../Numerics/Int256.h"
 #include "../utils/Serializable.h"
 #include "../utils/TextUtils.h"
 #include "SHA.h"
@@ -255,7 +255,12 @@ public:
 
 	operator BigInteger() const
 	{
-		return BigInteger::FromUnsignedArray(ToByteArray(), true);
+		return BigInteger(m_data, Length, 1);
+	}
+
+	UInt256 ToUInt256() const
+	{
+		return UInt256::FromUnsignedArray(m_data, Length, true);
 	}
 
 	static Hash MerkleCombine(const Hash& A, const Hash& B)
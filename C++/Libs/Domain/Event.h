@@ -251,9 +251,12 @@ public:
 	static Event Unserialize( BinaryReader& reader )
 	{
 		EventKind kind = (EventKind)reader.ReadByte();
-		Address address = reader.ReadAddress();
-		String contract = reader.ReadVarString();
-		ByteArray data = reader.ReadByteArray();
+		Address address;
+		String contract;
+		ByteArray data;
+		reader.ReadAddress(address);
+		reader.ReadVarString(contract);
+		reader.ReadByteArray(data);
 		return Event( kind, address, contract, data );
 	}
 };
@@ -266,14 +269,14 @@ inline T DecodeCustomEvent( EventKind kind )
 		PHANTASMA_EXCEPTION( "Cannot cast system event" );
 	}
 
-	int intVal = ((int)kind - (int)EventKind.Custom);
+	int intVal = ((int)kind - (int)EventKind::Custom);
 	return (T)intVal;
 }
 
 template<class T, typename std::enable_if<std::is_enum<T>::value>::type* = nullptr>
 inline EventKind EncodeCustomEvent( T kind )
 {
-	return (EventKind)(EventKind::Custom + (int)kind);
+	return (EventKind)((int)EventKind::Custom + (int)kind);
 }
 
 }
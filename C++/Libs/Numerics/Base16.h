@@ -12,11 +12,17 @@ namespace Base16 {
 constexpr Char Alphabet[] = "0123456789ABCDEF";
 inline int AlphabetIndexOf( Char in )
 {
-	for( const Char* c = Alphabet; *c; ++c )
-		if( *c == in )
-			return (int)(c - Alphabet);
+	if( in >= '0' && in <= '9' )
+		return in - '0';
+	if( in >= 'A' && in <= 'F' )
+		return in - 'A' + 10;
 	return -1;
 }
+// As AlphabetIndexOf, but also accepts lower case digits
+inline int DigitValue( Char in )
+{
+	return AlphabetIndexOf( (in >= 'a' && in <= 'f') ? (Char)(in - 'a' + 'A') : in );
+}
 
 inline int RequiredCharacters( int numBytes )//does not include a null terminator
 {
@@ -68,8 +74,8 @@ inline int Decode(Byte* output, int outputLength, const Char* sz, int inputLengt
 
 	for (int i = 0; i < length; i++)
 	{
-		int A = AlphabetIndexOf(toupper(sz[i * 2 + 0]));
-		int B = AlphabetIndexOf(toupper(sz[i * 2 + 1]));
+		int A = DigitValue(sz[i * 2 + 0]);
+		int B = DigitValue(sz[i * 2 + 1]);
 
 		if(A < 0 || B < 0)
 		{
@@ -17,6 +17,31 @@ inline int AlphabetIndexOf( Char in )
 	return -1;
 }
 
+// output = the number that the input encodes. Returns false if it contains a character that isn't in the alphabet.
+template<class BigInteger>
+bool DecodeNumber(BigInteger& output, const Char* input, int inputLength)
+{
+	//Horner's method, with chunks of up to 5 characters (58^5 < 2^32), each of which costs one multiplication by a
+	// cached power of 58 and one addition
+	constexpr int chunkLength = 5;
+	output = BigInteger::Zero();
+	for (int i = 0; i < inputLength; )
+	{
+		int length = PHANTASMA_MIN(chunkLength, inputLength - i);
+		UInt32 chunk = 0;
+		for (int end = i + length; i < end; i++)
+		{
+			int index = AlphabetIndexOf(input[i]);
+			if(index < 0)
+				return false;
+			chunk = chunk * 58 + (UInt32)index;
+		}
+		output *= BigInteger::template CachedPow<58>(length);
+		output += BigInteger(chunk);
+	}
+	return true;
+}
+
 inline int Decode(Byte* output, int outputLength, const Char* input, int inputLength)
 {
 	if(!input || inputLength < 0 || outputLength < 0)
@@ -31,17 +56,11 @@ inline int Decode(Byte* output, int outputLength, const Char* input, int inputLe
 			return 0;
 	}
 
-	BigInteger bi = BigInteger::Zero();
-	for (int i = inputLength - 1; i >= 0; i--)
+	BigInteger bi;
+	if( !DecodeNumber(bi, input, inputLength) )
 	{
-		int index = AlphabetIndexOf(input[i]);
-		if(index < 0)
-		{
-			PHANTASMA_EXCEPTION("invalid character");
-			return -1;
-		}
-
-		bi += BigInteger(index) * BigInteger::Pow(58, inputLength - 1 - i);
+		PHANTASMA_EXCEPTION("invalid character");
+		return -1;
 	}
 
 	int leadingZeros = 0;
@@ -73,17 +92,11 @@ inline ByteArray Decode(const String& input)
 		return tmp;
 	}
 
-	BigInteger bi = BigInteger::Zero();
-	for (int i = (int)input.length() - 1; i >= 0; i--)
+	BigInteger bi;
+	if( !DecodeNumber(bi, input.c_str(), (int)input.length()) )
 	{
-		int index = AlphabetIndexOf(input[i]);
-		if(index < 0)
-		{
-			PHANTASMA_EXCEPTION("invalid character");
-			return tmp;
-		}
-
-		bi += BigInteger(index) * BigInteger::Pow(58, (int)input.length() - 1 - i);
+		PHANTASMA_EXCEPTION("invalid character");
+		return tmp;
 	}
 
 	ByteArray bytes = bi.ToUnsignedByteArray();
@@ -135,17 +148,11 @@ inline int DecodeSecure(Byte* output, int outputSize, const Char* input, int inp
 	if(!input || input[0] == '\0')
 		return 0;
 
-	SecureBigInteger bi = SecureBigInteger::Zero();
-	for (int i = inputLength - 1; i >= 0; i--)
+	SecureBigInteger bi;
+	if( !DecodeNumber(bi, input, inputLength) )
 	{
-		int index = AlphabetIndexOf(input[i]);
-		if(index < 0)
-		{
-			PHANTASMA_EXCEPTION("invalid character");
-			return 0;
-		}
-
-		bi += SecureBigInteger(index) * SecureBigInteger::Pow(58, inputLength - 1 - i);
+		PHANTASMA_EXCEPTION("invalid character");
+		return 0;
 	}
 
 	int numBytes = bi.ToUnsignedByteArray(0, 0);
@@ -8,6 +8,10 @@
 #include <utility>
 #include "../Security/SecureString.h"
 
+#if !defined(PHANTASMA_INT128_DISABLE) && defined(__SIZEOF_INT128__)
+# define PHANTASMA_INT128
+#endif
+
 /*
 * Implementation of BigInteger class, written for Phantasma project
 * Author: Simão Pavlovich and Bernardo Pinho
@@ -21,6 +25,112 @@ template<        class True, class False> struct SelectType<false,True,False> {
 
 template<class T> class SecureVector;
 template<bool S> class TBigInteger;
+template<bool S> class TInt256;
+
+// A vector of trivially copyable elements that keeps up to N of them in place, and only allocates once it grows
+//  past that. Growing it reuses its storage, and moving it never allocates.
+template<class T, int N>
+class SmallVector
+{
+public:
+	typedef size_t size_type;
+
+	SmallVector() {}
+	SmallVector(const SmallVector& other)
+	{
+		*this = other;
+	}
+	SmallVector(SmallVector&& other) noexcept
+	{
+		*this = std::move(other);
+	}
+	SmallVector& operator=(const SmallVector& other)
+	{
+		if( this != &other )
+		{
+			if( other.m_size > capacity() )
+				Grow(other.m_size);
+			PHANTASMA_COPY(other.begin(), other.end(), m_data);
+			m_size = other.m_size;
+		}
+		return *this;
+	}
+	// Takes the other's heap storage (giving it this one's in return), or copies its elements if they are in place
+	SmallVector& operator=(SmallVector&& other) noexcept
+	{
+		if( this == &other )
+			return *this;
+		if( other.m_data != other.m_inline )
+		{
+			PHANTASMA_SWAP(m_heap, other.m_heap);
+			m_data = &m_heap.front();
+			other.m_data = other.m_heap.empty() ? other.m_inline : &other.m_heap.front();
+		}
+		else
+			PHANTASMA_COPY(other.m_inline, other.m_inline + other.m_size, m_data);
+		m_size = other.m_size;
+		other.m_size = 0;
+		return *this;
+	}
+
+	T*        begin()       { return m_data; }
+	const T*  begin() const { return m_data; }
+	T*          end()       { return m_data + m_size; }
+	const T*    end() const { return m_data + m_size; }
+	size_type  size() const { return m_size; }
+	bool      empty() const { return m_size == 0; }
+	T&         back()       { return m_data[m_size - 1]; }
+	const T&   back() const { return m_data[m_size - 1]; }
+	T&        front()       { return m_data[0]; }
+	const T&  front() const { return m_data[0]; }
+	T&       operator[](size_type i)       { return m_data[i]; }
+	const T& operator[](size_type i) const { return m_data[i]; }
+	size_type capacity() const { return m_heap.empty() ? N : m_heap.size(); }
+
+	void reserve( size_type size )
+	{
+		if( size > capacity() )
+			Grow(size);
+	}
+	// New elements are zero
+	void resize( size_type size )
+	{
+		if( size > capacity() )
+			Grow(size);
+		for( size_type i = m_size; i < size; ++i )
+			m_data[i] = T();
+		m_size = size;
+	}
+	void clear()
+	{
+		m_size = 0;
+	}
+	void push_back( const T& t )
+	{
+		T value = t;
+		if( m_size == capacity() )
+			Grow(m_size + 1);
+		m_data[m_size++] = value;
+	}
+	void pop_back()
+	{
+		--m_size;
+	}
+private:
+	T*                  m_data = m_inline; // m_inline, or the front of m_heap
+	size_type           m_size = 0;
+	PHANTASMA_VECTOR<T> m_heap;            // sized to the capacity, once that exceeds N
+	T                   m_inline[N];
+
+	void Grow( size_type size )
+	{
+		PHANTASMA_VECTOR<T> heap;
+		heap.resize(PHANTASMA_MAX(size, 2 * capacity()));
+		PHANTASMA_COPY(m_data, m_data + m_size, &heap.front());
+		PHANTASMA_SWAP(m_heap, heap);
+		m_data = &m_heap.front();
+	}
+};
 
 typedef TBigInteger<false> BigInteger;
 typedef TBigInteger<true> SecureBigInteger;
@@ -28,13 +138,19 @@ typedef TBigInteger<true> SecureBigInteger;
 template<bool UseSecureMemory=false>
 class TBigInteger
 {
+	template<bool> friend class TInt256;
 private:
 	int _sign = 0;
 	typedef PHANTASMA_VECTOR<UInt32> Data_Fast;
 	typedef SecureVector<UInt32>     Data_Secure;
 
 	typedef typename SelectType<UseSecureMemory, Data_Secure, Data_Fast>::Type Data;
-	Data _data;
+
+	//Values of up to 256 bits are kept in place, without allocating. The digits of SecureBigIntegers always stay in
+	// locked memory instead.
+	constexpr static int _InlineDigits = 8;
+	typedef typename SelectType<UseSecureMemory, Data_Secure, SmallVector<UInt32, _InlineDigits>>::Type Digits;
+	Digits _data;
 
 	constexpr static int _Base = sizeof(UInt32) * 8;    //number of bits required for shift operations
 	constexpr static UInt32 _MaxVal = 0xFFFFFFFFU;
@@ -43,19 +159,37 @@ private:
 	{
 		while( _data.size() > 1 && _data.back() == 0 )
 			_data.pop_back();
-		if( _data.empty() || (_data.size() == 1 && _data.back() == 0) )
+		if( _data.empty() )
+			_data.push_back(0);
+		if( _data.size() == 1 && _data.back() == 0 )
 			_sign = 0;
 	}
+	void SetZero()
+	{
+		_sign = 0;
+		_data.resize(1);
+		_data[0] = 0;
+	}
+	static TBigInteger FromDigits(const Digits& digits, int sign = 1)
+	{
+		TBigInteger result;
+		result._data = digits;
+		result._sign = sign;
+		result.Trim();
+		return result;
+	}
 public:
-	static const TBigInteger Zero() { return TBigInteger{0LL}; }
-	static const TBigInteger One()  { return TBigInteger{1LL}; }
+	static const TBigInteger Zero() { return TBigInteger{(Int64)0}; }
+	static const TBigInteger One()  { return TBigInteger{(Int64)1}; }
 
 	TBigInteger() : TBigInteger(0) {}
 
-	TBigInteger(TBigInteger&& other)
+	//Moving only allocates for SecureBigIntegers, which leave a zero digit in the moved-from value
+	TBigInteger(TBigInteger&& other) noexcept(!UseSecureMemory)
 		: _sign(other._sign)
-		, _data(other._data)
+		, _data(std::move(other._data))
 	{
+		other.SetZero();
 	}
 
 	TBigInteger(const TBigInteger& other)
@@ -71,6 +205,17 @@ public:
 		return *this;
 	}
 
+	TBigInteger& operator=(TBigInteger&& other) noexcept(!UseSecureMemory)
+	{
+		if( this != &other )
+		{
+			_sign = other._sign;
+			_data = std::move(other._data);
+			other.SetZero();
+		}
+		return *this;
+	}
+
 	TBigInteger(const UInt32* words, int numWords, int sign = 1)
 	{
 		_sign = sign;
@@ -100,13 +245,13 @@ public:
 	template<class Bytes>
 	static TBigInteger FromUnsignedArray(const Bytes& unsignedArray, bool isPositive)
 	{
-		return BigInteger(unsignedArray, isPositive ? 1 : -1);
+		return TBigInteger(unsignedArray, isPositive ? 1 : -1);
 	}
 
 	template<class Bytes>
 	static TBigInteger FromSignedArray(const Bytes& signedArray)
 	{
-		return BigInteger(signedArray);
+		return TBigInteger(signedArray);
 	}
 
 	static TBigInteger FromSignedArray(const Byte* signedArray, int signedArrayLength)
@@ -117,11 +262,12 @@ public:
 			temp.resize(signedArrayLength);
 			memcpy(&temp.front(), signedArray, signedArrayLength);
 		}
-		return BigInteger(temp);
+		return TBigInteger(temp);
 	}
 
     //this constructor assumes that the byte array is in Two's complement notation
-	template<class Bytes>
+	//(only for containers of bytes, so that e.g. a TInt256 goes through its conversion operator instead)
+	template<class Bytes, class = decltype((void)std::declval<const Bytes&>().empty(), (void)std::declval<const Bytes&>().size(), Byte(std::declval<const Bytes&>()[0]))>
 	TBigInteger(const Bytes& bytes)
 	{
 		if( bytes.empty() )
@@ -172,7 +318,7 @@ private:
 		}
 		else
 		{
-			Data uintArray;
+			Digits uintArray;
 			uintArray.resize((bytes.size()+3) / 4);
 
 			int bytePosition = 0;
@@ -199,7 +345,7 @@ public:
 		}
 		else
 		{
-			Data uintArray;
+			Digits uintArray;
 			uintArray.resize((numBytes+3) / 4);
 
 			int bytePosition = 0;
@@ -263,6 +409,153 @@ private:
 		}
 	}
 
+	//Text is converted in chunks of as many characters as fit in a digit (e.g. 9 decimal characters), so that each
+	// step is one single-digit multiplication or division. Long texts are split in two instead, and the halves are
+	// combined by multiplying with (or dividing by) a power of the radix, which costs less than one step per chunk.
+	constexpr static int _ParseSplitCharacters = 2000;
+	constexpr static int _FormatSplitDigits = 80;
+	constexpr static UInt32 _DecimalChunk = 1000000000U;
+	constexpr static int _DecimalChunkCharacters = 9;
+
+	static int CharacterValue(Char c)
+	{
+		if (c >= '0' && c <= '9')
+			return c - '0';
+		int val = toupper(c);
+		return ((val >= '0' && val <= '9') ? (val - '0') : ((val < 'A' || val > 'Z') ? 9999999 : (val - 'A' + 10)));
+	}
+
+	// The number of characters of the given radix that make up a chunk, and chunkRadix = radix ^ that number
+	static int ChunkCharacters(int radix, UInt32& chunkRadix)
+	{
+		int count = 1;
+		UInt64 power = radix;
+		while (power * radix <= _MaxVal)
+		{
+			power *= radix;
+			count++;
+		}
+		chunkRadix = (UInt32)power;
+		return count;
+	}
+
+	static void TrimDigits(Digits& x)
+	{
+		while (x.size() > 1 && x.back() == 0)
+			x.pop_back();
+	}
+
+	// powers[k] = base ^ (2 ^ k), squaring the last power as needed
+	static const Digits& SquaredPower(PHANTASMA_VECTOR<Digits>& powers, UInt32 base, int k)
+	{
+		if (powers.empty())
+		{
+			powers.resize(1);
+			powers[0].resize(1);
+			powers[0][0] = base;
+		}
+		while ((int)powers.size() <= k)
+		{
+			Digits square;
+			Multiply(square, powers.back(), powers.back());
+			TrimDigits(square);
+			powers.push_back(square);
+		}
+		return powers[k];
+	}
+
+	// output = the value of the given characters, which must all be valid in the radix
+	static void ParseDigits(Digits& output, const Char* text, int length, int radix, int chunk, UInt32 chunkRadix, PHANTASMA_VECTOR<Digits>& powers)
+	{
+		if (length <= _ParseSplitCharacters || length <= chunk)
+		{
+			output.resize(1);
+			output[0] = 0;
+			output.reserve(length / chunk + 2);
+			for (int i = 0, size = (length - 1) % chunk + 1; i < length; i += size, size = chunk)
+			{
+				UInt32 value = 0;
+				for (int j = 0; j < size; j++)
+					value = value * radix + CharacterValue(text[i + j]);
+
+				//x = x * chunkRadix + value
+				UInt64 carry = value;
+				for (int j = 0, end = (int)output.size(); j < end; j++)
+				{
+					carry += (UInt64)output[j] * chunkRadix;
+					output[j] = (UInt32)carry;
+					carry >>= 32;
+				}
+				if (carry)
+					output.push_back((UInt32)carry);
+			}
+			return;
+		}
+
+		//high * radix^lowLength + low, where low is a power-of-two count of chunks, and at least half of the text
+		int k = 0;
+		while ((chunk << (k + 1)) < length)
+			k++;
+		int lowLength = chunk << k;
+		Digits high, low;
+		ParseDigits(high, text, length - lowLength, radix, chunk, chunkRadix, powers);
+		ParseDigits(low, text + length - lowLength, lowLength, radix, chunk, chunkRadix, powers);
+		Multiply(output, high, SquaredPower(powers, chunkRadix, k));
+		AddMagnitudes(output, output, low);
+		TrimDigits(output);
+	}
+
+	// x /= 10^9, returning the remainder. Compilers replace the divisions by this constant with multiplications.
+	static UInt32 DivideDecimalChunk(Digits& x)
+	{
+		UInt64 remainder = 0;
+		for (int i = (int)x.size(); i-- > 0;)
+		{
+			UInt64 current = (remainder << 32) | x[i];
+			x[i] = (UInt32)(current / _DecimalChunk);
+			remainder = current % _DecimalChunk;
+		}
+		TrimDigits(x);
+		return (UInt32)remainder;
+	}
+
+	// Writes the decimal characters of x (which is destroyed) so that they end at end, and returns where they begin.
+	// If width isn't 0, exactly that many characters are written, including leading zeros.
+	static Char* FormatDecimal(Digits& x, Char* end, int width, PHANTASMA_VECTOR<Digits>& powers)
+	{
+		if ((int)x.size() > _FormatSplitDigits)
+		{
+			//x = q * 10^(9 * 2^k) + r, where the power has about half as many digits as x
+			int k = 0;
+			while (2 * (int)SquaredPower(powers, _DecimalChunk, k + 1).size() - 1 <= (int)x.size())
+				k++;
+			Digits q, r;
+			DivideMagnitudes(q, r, x, SquaredPower(powers, _DecimalChunk, k));
+			TrimDigits(q);
+			TrimDigits(r);
+			int lowWidth = _DecimalChunkCharacters << k;
+			Char* begin = FormatDecimal(r, end, lowWidth, powers);
+			return FormatDecimal(q, begin, width ? width - lowWidth : 0, powers);
+		}
+
+		Char* begin = end;
+		while (x.size() > 1 || x[0] != 0)
+		{
+			UInt32 chunk = DivideDecimalChunk(x);
+			bool last = x.size() == 1 && x[0] == 0;
+			for (int i = 0; i < _DecimalChunkCharacters && (!last || chunk != 0); i++)
+			{
+				*--begin = (Char)('0' + chunk % 10);
+				chunk /= 10;
+			}
+		}
+		if (begin == end && width == 0)
+			*--begin = '0';
+		while (end - begin < width)
+			*--begin = '0';
+		return begin;
+	}
+
 public:
 	TBigInteger(const String& str, int radix, bool* out_error=0)
 		:TBigInteger(str.c_str(), (int)str.length(), radix, out_error)
@@ -274,9 +567,6 @@ public:
 	}
 	TBigInteger(const Char* str, int strLength, int radix, bool* out_error=0)
 	{
-		TBigInteger bigInteger = Zero();
-		TBigInteger bi = One();
-
 		if (str && strLength == 0)
 		{
 			strLength = (int)PHANTASMA_STRLEN(str);
@@ -308,25 +598,23 @@ public:
 
 		int length = (int)(last+1 - first);
 
-		for (int i = 0; i < length; i++)
+		bool valid = radix >= 2 && radix <= 36;
+		for (int i = 0; valid && i < length; i++)
+			valid = CharacterValue(first[i]) < radix;
+		if( !valid )
 		{
-			int val = toupper(last[-i]);
-			val = ((val >= '0' && val <= '9') ? (val - '0') : ((val < 'A' || val > 'Z') ? 9999999 : (val - 'A' + 10)));
-			if( val >= radix )
-			{
-				if( out_error )
-					*out_error = true;
-				PHANTASMA_EXCEPTION("Invalid string in constructor.");
-				return;
-			}
-
-			bigInteger += bi * val;
-
-			if (i + 1 < length)
-				bi *= radix;
+			SetZero();
+			if( out_error )
+				*out_error = true;
+			PHANTASMA_EXCEPTION("Invalid string in constructor.");
+			return;
 		}
 
-		InitFromArray(&bigInteger._data.front(), (int)bigInteger._data.size());
+		UInt32 chunkRadix;
+		int chunk = ChunkCharacters(radix, chunkRadix);
+		PHANTASMA_VECTOR<Digits> powers;
+		ParseDigits(_data, first, length, radix, chunk, chunkRadix, powers);
+		Trim();
 	}
 
 	static TBigInteger FromHex(const String& p0)
@@ -375,55 +663,30 @@ public:
 
 	String ToDecimal() const
 	{
-		int radix = 10;
-		if( radix < 2 || radix > 36 )
+		if (_sign == 0 || _data.empty())
 		{
-			PHANTASMA_EXCEPTION("Radix must be >= 2 and <= 36");
-			return String();
+			return String(PHANTASMA_LITERAL("0"));
 		}
 
-		const Char* digits = PHANTASMA_LITERAL("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ");
-
-		TBigInteger bi = TBigInteger(radix);
-		if (_data.empty() || (_data.size() == 1 && _data[0] == 0))
+		//each digit needs at most 10 characters (32*log10(2) = 9.63), plus the sign
+		int capacity = (int)_data.size() * 10 + 1;
+		Char inlineText[_InlineDigits * 10 + 1];
+		PHANTASMA_VECTOR<Char> heapText;
+		Char* text = inlineText;
+		if (capacity > _InlineDigits * 10 + 1)
 		{
-			return String(PHANTASMA_LITERAL("0"));
+			heapText.resize(capacity);
+			text = &heapText.front();
 		}
-		else
-		{
-			String text2;
-			TBigInteger largeInteger = *this;
-			largeInteger._sign = 1;
-			TBigInteger largeInteger2;
-			TBigInteger largeInteger3;
-			while (largeInteger._data.size() > 1 || (largeInteger._data.size() == 1 && largeInteger._data[0] != 0))
-			{
-				DivideAndModulus(largeInteger, bi, largeInteger2, largeInteger3);
-				if (largeInteger3._data.size() == 0)
-				{
-					String temp(PHANTASMA_LITERAL("0"));
-					temp.append(text2);
-					text2 = temp;
-				}
-				else
-				{
-					int idx = largeInteger3._data[0];
-					String temp;
-					temp.append({digits[idx]});
-					temp.append(text2);
-					text2 = temp;
-				}
-				largeInteger = largeInteger2;
-			}
-			if (_sign < 1 && 0!=text2.compare(PHANTASMA_LITERAL("0")))
-			{
-				String temp(PHANTASMA_LITERAL("-"));
-				temp.append(text2);
-				text2 = temp;
-			}
 
-			return text2;
-		}
+		Digits x = _data;
+		TrimDigits(x);
+		PHANTASMA_VECTOR<Digits> powers;
+		Char* end = text + capacity;
+		Char* begin = FormatDecimal(x, end, 0, powers);
+		if (_sign < 0)
+			*--begin = '-';
+		return String(begin, (int)(end - begin));
 	}
 
 	String ToHex() const
@@ -443,14 +706,26 @@ public:
 	}
 
 private: 
-	static Data Add(const Data& X, const Data& Y)
+	//the magnitude functions ignore the signs, and assume that the digits have no leading zeros
+
+	static int CompareMagnitudes(const Digits& X, const Digits& Y)
+	{
+		if( X.size() != Y.size() )
+			return X.size() < Y.size() ? -1 : 1;
+		for( int i = (int)X.size() - 1; i >= 0; i-- )
+		{
+			if( X[i] != Y[i] )
+				return X[i] < Y[i] ? -1 : 1;
+		}
+		return 0;
+	}
+
+	// r = |X| + |Y|. r may be X or Y.
+	static void AddMagnitudes(Digits& r, const Digits& X, const Digits& Y)
 	{
 		int sizeX = (int)X.size();
 		int sizeY = (int)Y.size();
 		int longest = PHANTASMA_MAX(sizeX, sizeY);
-		Data r;
-		if( longest == 0 )
-			return r;
 		r.resize(longest+1);
 
 		UInt32 overflow = 0;
@@ -464,190 +739,289 @@ private:
 			overflow = (UInt32)(sum >> _Base);
 		}
 
-		r[longest] = (Byte)overflow;
-		return r;
+		r[longest] = overflow;
 	}
 
-	static Data Subtract(const Data& X, const Data& Y)
+	// r = |X| - |Y|, where |X| >= |Y|. r may be X or Y.
+	static void SubtractMagnitudes(Digits& r, const Digits& X, const Digits& Y)
 	{
 		int sizeX = (int)X.size();
 		int sizeY = (int)Y.size();
-		int longest = PHANTASMA_MAX(sizeX, sizeY);
-		Data r;
-		if( longest == 0 )
-			return r;
-		r.resize(longest);
+		r.resize(sizeX);
 
 		Int64 carry = 0;
 
-		for (int i = 0; i < longest; i++)
+		for (int i = 0; i < sizeX; i++)
 		{
-			Int64 x = i < sizeX ? X[i] : 0;
+			Int64 x = X[i];
 			Int64 y = i < sizeY ? Y[i] : 0;
 			Int64 tmpSub = x - y - carry;
 			r[i] = (UInt32)(tmpSub & _MaxVal);
 			carry = ((tmpSub >= 0) ? 0 : 1);
 		}
-
-		return r;
 	}
 
-	static Data Multiply(const Data& X, const Data& Y)
+	// out[0, nx+ny) = x * y. out must be zero, and must not overlap x or y.
+	static void MultiplyDigits(UInt32* out, const UInt32* x, int nx, const UInt32* y, int ny)
 	{
-		int sizeX = (int)X.size();
-		int sizeY = (int)Y.size();
-		Data output;
-		if( sizeX == 0 || sizeY == 0 )
-			return output;
-		output.resize(sizeX + sizeY + 1);
+#if defined(PHANTASMA_INT128)
+		//works on pairs of digits, as 64x64->128 bit products, which takes a quarter of the multiplications
+		int n = nx + ny;
+		int pairsY = ny / 2;
+		for (int i = 0; i < nx; i += 2)
+		{
+			UInt64 xi = x[i] | (i + 1 < nx ? (UInt64)x[i + 1] << 32 : 0);
+			if (xi == 0)
+				continue;
 
-		for (int i = 0; i < sizeX; i++)
+			UInt32* o = out + i;
+			UInt64 carry = 0;
+			for (int j = 0; j < pairsY; j++)
+			{
+				UInt64 yj = y[2 * j] | ((UInt64)y[2 * j + 1] << 32);
+				UInt64 oj = o[2 * j] | ((UInt64)o[2 * j + 1] << 32);
+				unsigned __int128 tmp = (unsigned __int128)xi * yj + oj + carry;
+				o[2 * j]     = (UInt32)tmp;
+				o[2 * j + 1] = (UInt32)((UInt64)tmp >> 32);
+				carry = (UInt64)(tmp >> 64);
+			}
+			int k = 2 * pairsY;
+			if (ny & 1)
+			{
+				UInt64 ok = o[k] | ((UInt64)o[k + 1] << 32);
+				unsigned __int128 tmp = (unsigned __int128)xi * y[ny - 1] + ok + carry;
+				o[k]     = (UInt32)tmp;
+				o[k + 1] = (UInt32)((UInt64)tmp >> 32);
+				carry = (UInt64)(tmp >> 64);
+				k += 2;
+			}
+			//the digits above the product of odd sized inputs are zero, and may be outside of out
+			if (i + k < n)
+				o[k] = (UInt32)carry;
+			if (i + k + 1 < n)
+				o[k + 1] = (UInt32)(carry >> 32);
+		}
+#else
+		for (int i = 0; i < nx; i++)
 		{
-			if (X[i] == 0)
+			if (x[i] == 0)
 				continue;
 
 			UInt64 carry = 0uL;
 			Int32 k = i;
 
-			for (int j = 0; j < sizeY; j++, k++)
+			for (int j = 0; j < ny; j++, k++)
 			{
-				UInt64 tmp = (UInt64)(X[i] * (Int64)Y[j] + output[k] + (Int64)carry);
-				output[k] = (UInt32)(tmp);
+				UInt64 tmp = (UInt64)x[i] * y[j] + out[k] + carry;
+				out[k] = (UInt32)(tmp);
 				carry = tmp >> 32;
 			}
 
-			output[i + sizeY] = (UInt32)carry;
+			out[i + ny] = (UInt32)carry;
+		}
+#endif
+	}
+
+	// r[0, nr) += a[0, na), returning the carry out of r. na <= nr.
+	static UInt32 AddDigits(UInt32* r, int nr, const UInt32* a, int na)
+	{
+		UInt64 carry = 0;
+		int i = 0;
+		for (; i < na; i++)
+		{
+			carry += (UInt64)r[i] + a[i];
+			r[i] = (UInt32)carry;
+			carry >>= 32;
+		}
+		for (; carry && i < nr; i++)
+		{
+			carry += r[i];
+			r[i] = (UInt32)carry;
+			carry >>= 32;
 		}
+		return (UInt32)carry;
+	}
 
-		return output;
+	// r[0, nr) -= a[0, na), returning the borrow out of r. na <= nr.
+	static UInt32 SubtractDigits(UInt32* r, int nr, const UInt32* a, int na)
+	{
+		UInt32 borrow = 0;
+		int i = 0;
+		for (; i < na; i++)
+		{
+			UInt64 difference = (UInt64)r[i] - a[i] - borrow;
+			r[i] = (UInt32)difference;
+			borrow = (UInt32)(difference >> 63);
+		}
+		for (; borrow && i < nr; i++)
+		{
+			borrow = r[i] == 0 ? 1 : 0;
+			r[i]--;
+		}
+		return borrow;
 	}
 
-public: 
-	TBigInteger operator+(const TBigInteger& b) const
+	static int SignificantDigits(const UInt32* x, int n)
 	{
-		const TBigInteger& a = *this;
-		TBigInteger result;
+		while (n > 0 && x[n - 1] == 0)
+			n--;
+		return n;
+	}
 
-		//all these if-else's are to make sure we don't attempt operations that would give a negative result,
-		//allowing the large int operations to deal only in the scope of unsigned numbers
-		if (a._sign < 0 && b._sign < 0)
+	//Below this many digits in the smaller operand, the schoolbook product is faster than Karatsuba's
+	// (see the BigIntegerBenchmark sample)
+#if defined(PHANTASMA_INT128)
+	constexpr static int _KaratsubaThreshold = 64;
+#else
+	constexpr static int _KaratsubaThreshold = 48;
+#endif
+
+	// out[0, nx+ny) = x * y, using Karatsuba's method for large operands. out must be zero, and must not overlap x or y.
+	static void MultiplyKaratsuba(UInt32* out, const UInt32* x, int nx, const UInt32* y, int ny)
+	{
+		if (nx < ny)
 		{
-			result._data = Add(a._data, b._data);
-			result._sign = (int)result == 0 ? 0 : -1;
+			PHANTASMA_SWAP(x, y);
+			PHANTASMA_SWAP(nx, ny);
 		}
-		else if (a._sign < 0)
+		if (ny < _KaratsubaThreshold)
 		{
-			if (Abs(a) < b)
-			{
-				result = TBigInteger(Subtract(b._data, a._data));
-				result._sign = result == 0 ? 0 : 1;
-			}
-			else
-			{
-				result = TBigInteger(Subtract(a._data, b._data));
-				result._sign = result == 0 ? 0 : -1;
-			}
+			MultiplyDigits(out, x, nx, y, ny);
+			return;
 		}
-		else if (b._sign < 0)
+		if (2 * ny <= nx)
 		{
-			if (a < Abs(b))
-			{
-				result = TBigInteger(Subtract(b._data, a._data));
-				result._sign = result == 0 ? 0 : -1;
-			}
-			else
+			//unbalanced, so multiply y by slices of x that are the same size as it
+			Digits partial;
+			partial.resize(2 * ny);
+			for (int i = 0; i < nx; i += ny)
 			{
-				result = TBigInteger(Subtract(a._data, b._data));
-				result._sign = result == 0 ? 0 : 1;
+				int n = PHANTASMA_MIN(ny, nx - i);
+				memset(&partial.front(), 0, (n + ny) * sizeof(UInt32));
+				MultiplyKaratsuba(&partial.front(), x + i, n, y, ny);
+				AddDigits(out + i, nx + ny - i, &partial.front(), n + ny);
 			}
+			return;
+		}
+
+		//x = x1*B^m + x0, y = y1*B^m + y0
+		//x*y = z2*B^2m + z1*B^m + z0, where z0 = x0*y0, z2 = x1*y1, z1 = (x0+x1)*(y0+y1) - z0 - z2
+		int m = nx / 2;
+		int nz0 = 2 * m;
+		int nz2 = nx + ny - nz0;
+		MultiplyKaratsuba(out,       x,     SignificantDigits(x, m), y,     SignificantDigits(y, m));
+		MultiplyKaratsuba(out + nz0, x + m, nx - m,                  y + m, ny - m);
+
+		int nsx = nx - m + 1;
+		int nsy = PHANTASMA_MAX(m, ny - m) + 1;
+		Digits sum, z1;
+		sum.resize(nsx + nsy);
+		z1.resize(nsx + nsy);
+		UInt32* sx = &sum.front();
+		UInt32* sy = sx + nsx;
+		PHANTASMA_COPY(x + m, x + nx, sx);
+		AddDigits(sx, nsx, x, m);
+		PHANTASMA_COPY(y, y + m, sy);
+		AddDigits(sy, nsy, y + m, ny - m);
+		MultiplyKaratsuba(&z1.front(), sx, SignificantDigits(sx, nsx), sy, SignificantDigits(sy, nsy));
+
+		SubtractDigits(&z1.front(), nsx + nsy, out, nz0);
+		SubtractDigits(&z1.front(), nsx + nsy, out + nz0, nz2);
+		AddDigits(out + m, nx + ny - m, &z1.front(), SignificantDigits(&z1.front(), nsx + nsy));
+	}
+
+	// output = |X| * |Y|. output must not be X or Y.
+	static void Multiply(Digits& output, const Digits& X, const Digits& Y)
+	{
+		int sizeX = (int)X.size();
+		int sizeY = (int)Y.size();
+		output.resize(0);
+		if( sizeX == 0 || sizeY == 0 )
+			return;
+		output.resize(sizeX + sizeY);
+		MultiplyKaratsuba(&output.front(), &X.front(), sizeX, &Y.front(), sizeY);
+	}
+
+	// *this += sign * |digits|, in the storage of *this
+	void AddSigned(const Digits& digits, int sign)
+	{
+		if( sign == 0 )
+			return;
+		if( _sign == 0 )
+		{
+			_data = digits;
+			_sign = sign;
+		}
+		else if( _sign == sign )
+		{
+			AddMagnitudes(_data, _data, digits);
+		}
+		else if( CompareMagnitudes(_data, digits) >= 0 )
+		{
+			SubtractMagnitudes(_data, _data, digits);
 		}
 		else
 		{
-			result = TBigInteger(Add(b._data, a._data));
-			result._sign = result == 0 ? 0 : 1;
+			SubtractMagnitudes(_data, digits, _data);
+			_sign = sign;
 		}
+		Trim();
+	}
 
-		result.Trim();
-
+public: 
+	TBigInteger operator+(const TBigInteger& b) const
+	{
+		TBigInteger result = *this;
+		result += b;
 		return result;
 	}
 	TBigInteger& operator +=(const TBigInteger& b)
 	{
-		return (*this = *this + b);
+		AddSigned(b._data, b._sign);
+		return *this;
 	}
 
 	TBigInteger operator -(const TBigInteger& b) const
 	{
-		const TBigInteger& a = *this;
-		TBigInteger result;
-
-		//all these if-else's are to make sure we don't attempt operations that would give a negative result,
-		//allowing the large int operations to deal only in the scope of unsigned numbers
-		if (a._sign < 0 && b._sign < 0)
-		{
-			if (Abs(a) < Abs(b))
-			{
-				result = TBigInteger(Subtract(b._data, a._data));
-				result._sign = result == 0 ? 0 : 1;
-			}
-			else
-			{
-				result = TBigInteger(Subtract(a._data, b._data));
-				result._sign = result == 0 ? 0 : -1;
-			}
-		}
-		else
-			if (a._sign < 0)
-			{
-				result = TBigInteger(Add(a._data, b._data));
-				result._sign = result == 0 ? 0 : -1;
-			}
-			else if (b._sign < 0)
-			{
-				result = TBigInteger(Add(a._data, b._data));
-				result._sign = result == 0 ? 0 : 1;
-			}
-			else
-			{
-				if (a < b)
-				{
-					result = TBigInteger(Subtract(b._data, a._data));
-					result._sign = result == 0 ? 0 : -1;
-				}
-				else
-				{
-					result = TBigInteger(Subtract(a._data, b._data));
-					result._sign = result == 0 ? 0 : 1;
-				}
-			}
-
+		TBigInteger result = *this;
+		result -= b;
 		return result;
 	}
 	TBigInteger& operator -=(const TBigInteger& b)
 	{
-		return (*this = *this - b);
+		AddSigned(b._data, -b._sign);
+		return *this;
 	}
 
 	TBigInteger operator *(const TBigInteger& b) const
 	{
 		const TBigInteger& a = *this;
 		TBigInteger result;
-		result._data = TBigInteger::Multiply(a._data, b._data);
+		TBigInteger::Multiply(result._data, a._data, b._data);
 		result._sign = a._sign * b._sign;
 		result.Trim();
 		return result;
 	}
 	TBigInteger& operator *=(const TBigInteger& b)
 	{
-		return (*this = *this * b);
+		//values that fit in place are multiplied without allocating, and the product is copied into the existing storage
+		Digits product;
+		TBigInteger::Multiply(product, _data, b._data);
+		_data = product;
+		_sign *= b._sign;
+		Trim();
+		return *this;
 	}
 
 	TBigInteger operator /(const TBigInteger& b) const
 	{
-		const TBigInteger& a = *this;
-		TBigInteger quot, rem;
-		TBigInteger::DivideAndModulus(Abs(a), Abs(b), quot, rem);
-		quot._sign = quot._sign == 0 ? 0 : a._sign * b._sign;
+		TBigInteger quot;
+		if (b.IsZero())
+			return quot;
+		Digits rem;
+		DivideMagnitudes(quot._data, rem, _data, b._data);
+		quot._sign = _sign * b._sign;
+		quot.Trim();
 		return quot;
 	}
 	TBigInteger& operator /=(const TBigInteger& b)
@@ -669,7 +1043,7 @@ public:
 
 	static void DivideAndModulus(const TBigInteger& a, const TBigInteger& b, TBigInteger& quot, TBigInteger& rem)
 	{
-		if ((int)b == 0)
+		if (b.IsZero())
 		{
 			quot = Zero();
 			rem = Zero();
@@ -683,157 +1057,131 @@ public:
 			return;
 		}
 
-		if (b._data.size() == 1)
-			SingleDigitDivMod(a, b, quot, rem);
-		else
-			MultiDigitDivMod(a, b, quot, rem);
-
-
-		rem._sign = a._sign;
-		rem = (int)a >= 0 ? rem : b + rem;
+		//quot or rem may be a or b
+		Digits q, r;
+		DivideMagnitudes(q, r, a._data, b._data);
+		int aSign = a._sign;
+		int qSign = a._sign * b._sign;
+		quot._data = q;
+		quot._sign = qSign;
+		quot.Trim();
+		rem._data = r;
+		rem._sign = aSign;
+		rem.Trim();
 
-		quot._sign = quot.GetBitLength() == 0 ? 0 : a._sign * b._sign;
-		rem._sign = rem.GetBitLength() == 0 ? 0 : rem._sign;
+		if (aSign < 0 && !rem.IsZero())
+			rem = b + rem;
 	}
 
 private:
-	//do not access this function directly under any circumstances, always go through DivideAndModulus
-	static void SingleDigitDivMod(const TBigInteger& numerator, const TBigInteger& denominator, TBigInteger& quotient, TBigInteger& remainder)
+	static int LeadingZeros(UInt32 digit)
 	{
-		Data tmpQuotArray, remArray;
-		tmpQuotArray.resize(numerator._data.size() - denominator._data.size() + 1);
-		remArray.resize(numerator._data.size());
-
-		for (int i = 0, end = (int)numerator._data.size(); i < end; i++)
-		{
-			remArray[i] = numerator._data[i];
-		}
-
-		int quotIter = 0;   //quotient array iterator index
-		UInt64 quickDen = denominator._data[0];  //quick denominator
-		int remIter = (int)remArray.size() - 1;  //remainder array iterator index
-		UInt64 tmpRem = remArray[remIter];   //temporary remainder digit
-
-		if (tmpRem >= quickDen)
-		{
-			UInt64 tmpQuot = tmpRem / quickDen;
-			tmpQuotArray[quotIter++] = (UInt32)tmpQuot;
-			remArray[remIter] = (UInt32)(tmpRem % quickDen);
-		}
+		int n = 0;
+		for (UInt32 bit = 0x80000000u; bit && !(digit & bit); bit >>= 1)
+			n++;
+		return n;
+	}
 
-		remIter--;
-		while (remIter >= 0)
+	// q = |X| / |Y|, r = |X| % |Y|. Y must not be zero, and q and r must not be X or Y.
+	static void DivideMagnitudes(Digits& q, Digits& r, const Digits& X, const Digits& Y)
+	{
+		int m = (int)X.size();
+		int n = (int)Y.size();
+		if (m < n)
 		{
-			tmpRem = ((UInt64)remArray[remIter + 1] << 32) + remArray[remIter];
-			UInt64 tmpQuot = tmpRem / quickDen;
-			tmpQuotArray[quotIter++] = (UInt32)tmpQuot;
-			remArray[remIter + 1] = 0u;
-			remArray[remIter--] = (UInt32)(tmpRem % quickDen);
+			q.resize(1);
+			q[0] = 0;
+			r = X;
 		}
-
-		Data quotArray;
-		quotArray.resize(quotIter);
-		for (int i = (int)quotArray.size() - 1, j = 0; i >= 0; i--, j++)
+		else if (n == 1)
 		{
-			quotArray[j] = tmpQuotArray[i];
+			q.resize(m);
+			r.resize(1);
+			UInt64 divisor = Y[0];
+			UInt64 remainder = 0;
+			for (int i = m; i-- > 0;)
+			{
+				UInt64 current = (remainder << 32) | X[i];
+				q[i] = (UInt32)(current / divisor);
+				remainder = current % divisor;
+			}
+			r[0] = (UInt32)remainder;
 		}
-
-		quotient._data = quotArray;
-		quotient._sign = 1;
-		remainder._data = remArray;
-		remainder._sign = 1;
-
-		quotient.Trim();
-		remainder.Trim();
-	}
-
-	//do not access this function directly under any circumstances, always go through DivideAndModulus
-	static void MultiDigitDivMod(const TBigInteger& numerator, TBigInteger denominator, TBigInteger& quot, TBigInteger& rem)
-	{
-		Data quotArray, remArray;
-		quotArray.resize(numerator._data.size() - denominator._data.size() + 1);
-		remArray.resize(numerator._data.size() + 1);
-
-		UInt32 tmp = 0x80000000u;
-		UInt32 tmp2 = denominator._data[denominator._data.size() - 1];    //denominator most significant digit
-		int shiftCount = 0;
-
-		while (tmp != 0 && (tmp2 & tmp) == 0)
-		{
-			shiftCount++;
-			tmp >>= 1;
+		else
+			DivideKnuth(q, r, X, Y);
+	}
+
+	// Knuth, TAOCP vol.2, 4.3.1, Algorithm D. The remainder is worked out in the storage of r.
+	static void DivideKnuth(Digits& q, Digits& r, const Digits& X, const Digits& Y)
+	{
+		int m = (int)X.size();
+		int n = (int)Y.size();
+		q.resize(m - n + 1);
+		r.resize(m + 1);
+		UInt32* u = &r.front();
+
+		//normalize, so that the most significant digit of the denominator has its top bit set
+		int shift = LeadingZeros(Y[n - 1]);
+		Digits normalized;
+		const UInt32* v = &Y.front();
+		if (shift)
+		{
+			normalized.resize(n);
+			for (int i = n - 1; i > 0; i--)
+				normalized[i] = (Y[i] << shift) | (Y[i - 1] >> (32 - shift));
+			normalized[0] = Y[0] << shift;
+			v = &normalized.front();
+			u[m] = X[m - 1] >> (32 - shift);
+			for (int i = m - 1; i > 0; i--)
+				u[i] = (X[i] << shift) | (X[i - 1] >> (32 - shift));
+			u[0] = X[0] << shift;
 		}
-		for (int i = 0, end = (int)numerator._data.size(); i < end; i++)
+		else
 		{
-			remArray[i] = numerator._data[i];
+			PHANTASMA_COPY(&X.front(), &X.front() + m, u);
+			u[m] = 0;
 		}
 
-		ShiftLeft(remArray, shiftCount);
-		denominator <<= shiftCount;
-
-		int j = (int)numerator._data.size() - (int)denominator._data.size() + 1;
-		int remIter = (int)numerator._data.size(); //yes, numerator, not remArray
-		UInt64 denMsd = denominator._data[(int)denominator._data.size() - 1];       //denominator most significant digit
-		UInt64 denSubMsd = denominator._data[(int)denominator._data.size() - 2];    //denominator second most significant digit
-		int denSize = (int)denominator._data.size() + 1;
-
-		Data tmpRemSubArray;
-		tmpRemSubArray.resize(denSize);
-
-		while (j > 0)
+		for (int j = m - n; j >= 0; j--)
 		{
-			UInt64 quickDenominator = ((UInt64)remArray[remIter] << 32) + remArray[remIter - 1];
-			UInt64 tmpQuot = quickDenominator / denMsd;
-			UInt64 tmpRem = quickDenominator % denMsd;
-			bool flag = false;
-			while (!flag)
+			//estimate the quotient digit from the top two digits, then correct it using the third
+			UInt64 top = ((UInt64)u[j + n] << 32) | u[j + n - 1];
+			UInt64 qhat = top / v[n - 1];
+			UInt64 rhat = top % v[n - 1];
+			while (qhat > _MaxVal || qhat * v[n - 2] > ((rhat << 32) | u[j + n - 2]))
 			{
-				flag = true;
-				if (tmpQuot == 0x100000000LL || tmpQuot * denSubMsd > (tmpRem << 32) + remArray[remIter - 2])
-				{
-					tmpQuot--;
-					tmpRem += denMsd;
-					if (tmpRem < 0x100000000LL)
-					{
-						flag = false;
-					}
-				}
+				qhat--;
+				rhat += v[n - 1];
+				if (rhat > _MaxVal)
+					break;
 			}
 
-			for (int k = 0; k < denSize; k++)
+			//multiply and subtract
+			UInt32 borrow = 0;
+			UInt64 carry = 0;
+			for (int i = 0; i < n; i++)
 			{
-				tmpRemSubArray[(tmpRemSubArray.size() - 1) - k] = remArray[remIter - k];
+				UInt64 product = qhat * v[i] + carry;
+				carry = product >> 32;
+				UInt64 difference = (UInt64)u[i + j] - (UInt32)product - borrow;
+				u[i + j] = (UInt32)difference;
+				borrow = (UInt32)(difference >> 63);
 			}
+			UInt64 difference = (UInt64)u[j + n] - carry - borrow;
+			u[j + n] = (UInt32)difference;
 
-			TBigInteger tmpRemBigInt(tmpRemSubArray);
-			TBigInteger estimNumBigInt = denominator * (Int64)tmpQuot;  //current numerator estimate
-			while (estimNumBigInt > tmpRemBigInt)
+			//the estimate was one too large, add the denominator back
+			q[j] = (UInt32)qhat;
+			if (difference >> 63)
 			{
-				tmpQuot--;
-				estimNumBigInt -= denominator;
+				q[j]--;
+				u[j + n] += AddDigits(u + j, n, v, n);
 			}
-			TBigInteger estimRemBigInt = tmpRemBigInt - estimNumBigInt;    //current remainder estimate
-			for (int k = 0; k < denSize; k++)
-			{
-				tmp = denominator._data.size() - k < estimRemBigInt._data.size()
-					? estimRemBigInt._data[denominator._data.size() - k]
-					: 0;
-				remArray[remIter - k] = tmp;
-			}
-
-			remIter--;
-			j--;
-			quotArray[j] = (UInt32)tmpQuot;
 		}
 
-		quot = TBigInteger(quotArray);
-
-		ShiftRight(remArray, shiftCount);
-
-		rem = TBigInteger(remArray);
-
-		quot.Trim();
-		rem.Trim();
+		for (int i = 0; i < n; i++)
+			u[i] = (u[i] >> shift) | (shift ? u[i + 1] << (32 - shift) : 0);
+		r.resize(n);
 	}
 
 public:
@@ -850,8 +1198,6 @@ public:
 		bits = bits < 0 ? -bits : bits;
 		TBigInteger r = *this;
 		ShiftRight(r._data, bits);
-		if (r._data[0] == 0 && r._data.size() == 1)
-			r._sign = 0;
 		r.Trim();
 		return r;
 	}
@@ -861,13 +1207,11 @@ public:
 			return *this;
 		bits = bits < 0 ? -bits : bits;
 		ShiftRight(_data, bits);
-		if (_data[0] == 0 && _data.size() == 1)
-			_sign = 0;
 		Trim();
 		return *this;
 	}
 private:
-	static void ShiftRight(Data& buffer, int shiftBitCount)
+	static void ShiftRight(Digits& buffer, int shiftBitCount)
 	{
 		int length = (int)buffer.size();
 		if( length == 0 )
@@ -890,7 +1234,7 @@ private:
 			return;
 		}
 
-		Data newBuffer;
+		Digits newBuffer;
 		newBuffer.resize(newLength);
 
 		quickShiftAmount = 32 - quickShiftAmount;   //we'll use this new shift amount to pre-left shift the applicable digits
@@ -910,7 +1254,7 @@ private:
 			newBuffer[j - 1] |= shiftLsd;
 		}
 
-		newBuffer[0] |= buffer[shrinkage] >> shiftBitCount;
+		newBuffer[0] |= buffer[shrinkage] >> (shiftBitCount % 32);
 
 		PHANTASMA_SWAP(buffer, newBuffer);
 	}
@@ -922,6 +1266,7 @@ public:
 		bits = bits < 0 ? -bits : bits;
 		TBigInteger r = *this;
 		ShiftLeft(r._data, bits);
+		r.Trim();
 		return r;
 	}
 	TBigInteger& operator <<=(int bits)
@@ -930,11 +1275,12 @@ public:
 			return *this;
 		bits = bits < 0 ? -bits : bits;
 		ShiftLeft(_data, bits);
+		Trim();
 		return *this;
 	}
 
 private:
-	static void ShiftLeft(Data& buffer, int shiftBitCount)
+	static void ShiftLeft(Digits& buffer, int shiftBitCount)
 	{
 		auto length = buffer.size();
 		if( length == 0 )
@@ -948,7 +1294,7 @@ private:
 		int extraDigit = (msd != (UInt32)msd) ? 1 : 0;  //if it goes above the UInt32 range, we need to add
 														//a new position for the new MSD
 
-		Data newBuffer;
+		Digits newBuffer;
 		newBuffer.resize(length + amountOfZeros + extraDigit);
 
 		for (UInt32 i = 0, j = amountOfZeros; i < length; i++, j++)
@@ -970,23 +1316,23 @@ private:
 public:
 	TBigInteger& operator ++()
 	{
-		return (*this = *this + 1);
+		return (*this += 1);
 	}
 	TBigInteger operator ++(int)
 	{
 		TBigInteger pre = *this;
-		*this = *this + 1;
+		*this += 1;
 		return pre;
 	}
 
 	TBigInteger& operator --()
 	{
-		return (*this = *this - 1);
+		return (*this -= 1);
 	}
 	TBigInteger operator --(int)
 	{
 		TBigInteger pre = *this;
-		*this = *this - 1;
+		*this -= 1;
 		return pre;
 	}
 
@@ -1025,33 +1371,18 @@ private:
 			return !op;
 		}
 
-		if (a._data.size() < b._data.size())
+		//the larger magnitude is the smaller number, when both are negative
+		int compare = a._sign * CompareMagnitudes(a._data, b._data);
+		if (compare < 0)
 		{
 			return op;
 		}
 
-		if (a._data.size() > b._data.size())
+		if (compare > 0)
 		{
 			return !op;
 		}
 
-		const Data& A = a._data;
-		const Data& B = b._data;
-		for (int i = (int)A.size() - 1; i >= 0; i--)
-		{
-			UInt32 x = A[i];
-			UInt32 y = B[i];
-			if (x < y)
-			{
-				return op;
-			}
-
-			if (x > y)
-			{
-				return !op;
-			}
-		}
-
 		return false;
 	}
 
@@ -1084,7 +1415,7 @@ public:
 		auto aSize = a._data.size();
 		auto bSize = b._data.size();
 		auto len = PHANTASMA_MAX(aSize, bSize);
-		Data temp;
+		Digits temp;
 		temp.resize(len);
 
 		for (UInt32 i = 0; i < len; i++)
@@ -1094,7 +1425,7 @@ public:
 			temp[i] = (A ^ B);
 		}
 
-		return TBigInteger(std::move(temp));
+		return FromDigits(temp);
 	}
 
 	TBigInteger operator |(const TBigInteger& b) const
@@ -1103,7 +1434,7 @@ public:
 		auto aSize = a._data.size();
 		auto bSize = b._data.size();
 		auto len = PHANTASMA_MAX(aSize, bSize);
-		Data temp;
+		Digits temp;
 		temp.resize(len);
 
 		for (UInt32 i = 0; i < len; i++)
@@ -1113,19 +1444,19 @@ public:
 			temp[i] = A | B;
 		}
 
-		return TBigInteger(std::move(temp));
+		return FromDigits(temp);
 	}
 
 	TBigInteger operator ~() const
 	{
-		Data buffer;
+		Digits buffer;
 		buffer.resize(_data.size());
 		for (int i = 0, end = (int)buffer.size(); i < end; i++)
 		{
 			buffer[i] = ~_data[i];
 		}
 
-		return TBigInteger(std::move(buffer));
+		return FromDigits(buffer);
 	}
 
 	TBigInteger operator &(const TBigInteger& b) const
@@ -1134,7 +1465,7 @@ public:
 		auto aSize = a._data.size();
 		auto bSize = b._data.size();
 		auto len = PHANTASMA_MAX(aSize, bSize);
-		Data temp;
+		Digits temp;
 		temp.resize(len);
 
 		for (UInt32 i = 0; i < len; i++)
@@ -1144,7 +1475,7 @@ public:
 			temp[i] = A & B;
 		}
 
-		return TBigInteger(std::move(temp));
+		return FromDigits(temp);
 	}
 
 	bool Equals(TBigInteger other) const
@@ -1177,16 +1508,59 @@ public:
 	static TBigInteger Pow(TBigInteger powBase, TBigInteger powExp)
 	{
 		TBigInteger val = One();
-		TBigInteger i = Zero();
+		if (powExp._sign <= 0)
+			return val;
 
-		while (i < powExp)
+		//square-and-multiply, from the most significant bit of the exponent
+		for (int bit = powExp.GetBitLength(); bit-- > 0;)
 		{
-			val *= powBase;
-			i = i + One();
+			val *= val;
+			if ((powExp._data[bit / 32] >> (bit % 32)) & 1)
+				val *= powBase;
 		}
 		return val;
 	}
 
+	//Powers of 10 (for decimal places) and of 58 (for Base58) are taken from CachedPow when possible
+	static TBigInteger Pow(Int64 powBase, int powExp)
+	{
+		if (powExp <= 0)
+			return One();
+		if (powExp < CachedPowers && powBase == 10)
+			return CachedPow<10>(powExp);
+		if (powExp < CachedPowers && powBase == 58)
+			return CachedPow<58>(powExp);
+		return Pow(TBigInteger(powBase), TBigInteger(powExp));
+	}
+
+	constexpr static int CachedPowers = 80;
+
+	// Base^exponent, where 0 <= exponent < CachedPowers, from a table of those powers. Each table is computed the
+	//  first time that it is used, and is then shared by all threads.
+	template<UInt32 Base>
+	static const TBigInteger& CachedPow(int exponent)
+	{
+		static const PHANTASMA_VECTOR<TBigInteger> table = PowerTable(Base, CachedPowers);
+		if (exponent < 0 || exponent >= CachedPowers)
+		{
+			PHANTASMA_EXCEPTION("Exponent is outside of the cached range");
+			return table[0];
+		}
+		return table[exponent];
+	}
+
+	// base^0 .. base^(count-1)
+	static PHANTASMA_VECTOR<TBigInteger> PowerTable(UInt32 base, int count)
+	{
+		PHANTASMA_VECTOR<TBigInteger> table;
+		table.reserve(count);
+		table.push_back(One());
+		TBigInteger multiplier(base);
+		for (int i = 1; i < count; i++)
+			table.push_back(table.back() * multiplier);
+		return table;
+	}
+
 	static TBigInteger ModPow(TBigInteger b, TBigInteger exp, TBigInteger mod)
 	{
 		return b.ModPow(exp, mod);
@@ -1336,7 +1710,11 @@ public:
 
 	Data ToUintArray() const
 	{
-		return _data;
+		Data result;
+		result.resize(_data.size());
+		for( int i = 0, end = (int)_data.size(); i < end; i++ )
+			result[i] = _data[i];
+		return result;
 	}
 
 	bool CalcIsEven() const
@@ -1376,14 +1754,14 @@ public:
 			num2++;
 		}
 
-		Data sqrtArray;
+		Digits sqrtArray;
 		sqrtArray.resize(num2);
 		for (int num4 = (int)(num2 - 1); num4 >= 0; num4--)
 		{
 			while (num3 != 0)
 			{
 				sqrtArray[num4] ^= num3;
-				TBigInteger tmp(sqrtArray);
+				TBigInteger tmp = FromDigits(sqrtArray);
 				if (tmp * tmp > *this)
 				{
 					sqrtArray[num4] ^= num3;
@@ -1392,7 +1770,7 @@ public:
 			}
 			num3 = 0x80000000u;
 		}
-		return TBigInteger(std::move(sqrtArray));
+		return FromDigits(sqrtArray);
 	}
 
     /// <summary>
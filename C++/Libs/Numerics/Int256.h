@@ -0,0 +1,942 @@
+#pragma once
+#ifndef PHANTASMA_API_INCLUDED
+#error "Configure and include PhantasmaAPI.h first"
+#endif
+
+#include "BigInteger.h"
+
+//------------------------------------------------------------------------------
+// Fixed-width 256-bit integers
+//------------------------------------------------------------------------------
+// TBigInteger keeps up to 256 bits of digits inline, but it still tracks their
+//  length, trims and grows them on every operation, and SecureBigInteger
+//  allocates every value. Token amounts, gas, NFT ids and hashes all fit in 256
+//  bits, so UInt256 and Int256 always hold exactly 8 words in place, and provide
+//  the same arithmetic, comparison, byte array and string conversions without
+//  any length bookkeeping or allocation:
+//
+//     UInt256 total;
+//     for( const rpc::Balance& balance : account.balances )
+//         total += UInt256(balance.amount, 10);
+//     String text = DecimalConversion(total, decimals);
+//
+// As with the built-in integer types, arithmetic wraps around on overflow,
+//  division truncates towards zero, and Int256 is stored in two's complement.
+//  Conversions from TBigInteger, byte arrays and strings whose value does not
+//  fit raise PHANTASMA_EXCEPTION (the TryParse / TryFrom* functions return
+//  false instead).
+//------------------------------------------------------------------------------
+
+namespace phantasma {
+
+template<bool Signed> class TInt256;
+
+typedef TInt256<false> UInt256;
+typedef TInt256<true>  Int256;
+
+template<bool Signed>
+class TInt256
+{
+	template<bool> friend class TInt256;
+public:
+	constexpr static int Words = 8;  //32-bit digits, least significant first, as in TBigInteger
+	constexpr static int Bits = Words * 32;
+private:
+	UInt32 _data[Words];
+
+	constexpr static UInt32 _SignBit = 0x80000000U;
+
+	UInt32 Fill() const { return IsNegative() ? 0xFFFFFFFFU : 0; }
+
+	static int SignificantWords(const UInt32* words)
+	{
+		int n = Words;
+		while( n > 0 && words[n - 1] == 0 )
+			n--;
+		return n;
+	}
+	static int LeadingZeros(UInt32 word)
+	{
+		int n = 0;
+		for( UInt32 bit = _SignBit; bit && !(word & bit); bit >>= 1 )
+			n++;
+		return n;
+	}
+	// The absolute value, as an unsigned number (which also holds the magnitude of the smallest Int256)
+	void Magnitude(UInt32* output) const
+	{
+		if( IsNegative() )
+			Negate(_data, output);
+		else
+			PHANTASMA_COPY(_data, _data + Words, output);
+	}
+	static void Negate(const UInt32* input, UInt32* output)
+	{
+		UInt64 carry = 1;
+		for( int i = 0; i < Words; i++ )
+		{
+			UInt64 sum = (UInt64)(UInt32)~input[i] + carry;
+			output[i] = (UInt32)sum;
+			carry = sum >> 32;
+		}
+	}
+	// Multiplies words by a single digit and adds another. Returns the digit that overflowed.
+	static UInt32 MultiplyAdd(UInt32* words, UInt32 multiplier, UInt32 addend)
+	{
+		UInt64 carry = addend;
+		for( int i = 0; i < Words; i++ )
+		{
+			UInt64 product = (UInt64)words[i] * multiplier + carry;
+			words[i] = (UInt32)product;
+			carry = product >> 32;
+		}
+		return (UInt32)carry;
+	}
+	// Divides words by a single digit in place. Returns the remainder.
+	static UInt32 DivideWord(UInt32* words, UInt32 divisor)
+	{
+		UInt64 remainder = 0;
+		for( int i = Words; i-- > 0; )
+		{
+			UInt64 current = (remainder << 32) | words[i];
+			words[i] = (UInt32)(current / divisor);
+			remainder = current % divisor;
+		}
+		return (UInt32)remainder;
+	}
+	// Unsigned division of 256-bit numbers (Knuth, TAOCP vol.2, 4.3.1, Algorithm D)
+	static void DivideUnsigned(const UInt32* numerator, const UInt32* denominator, UInt32* quot, UInt32* rem)
+	{
+		int m = SignificantWords(numerator);
+		int n = SignificantWords(denominator);
+		UInt32 q[Words] = {};
+		UInt32 r[Words] = {};
+		if( n == 0 )
+		{
+			//as TBigInteger, division by zero gives zero
+		}
+		else if( m < n )
+		{
+			PHANTASMA_COPY(numerator, numerator + Words, r);
+		}
+		else if( n == 1 )
+		{
+			PHANTASMA_COPY(numerator, numerator + Words, q);
+			r[0] = DivideWord(q, denominator[0]);
+		}
+		else
+		{
+			//normalize, so that the most significant digit of the denominator has its top bit set
+			int shift = LeadingZeros(denominator[n - 1]);
+			UInt32 u[Words + 1];
+			UInt32 v[Words];
+			for( int i = n - 1; i > 0; i-- )
+				v[i] = (denominator[i] << shift) | (shift ? denominator[i - 1] >> (32 - shift) : 0);
+			v[0] = denominator[0] << shift;
+			u[m] = shift ? numerator[m - 1] >> (32 - shift) : 0;
+			for( int i = m - 1; i > 0; i-- )
+				u[i] = (numerator[i] << shift) | (shift ? numerator[i - 1] >> (32 - shift) : 0);
+			u[0] = numerator[0] << shift;
+
+			for( int j = m - n; j >= 0; j-- )
+			{
+				//estimate the quotient digit from the top two digits, then correct it using the third
+				UInt64 top = ((UInt64)u[j + n] << 32) | u[j + n - 1];
+				UInt64 qhat = top / v[n - 1];
+				UInt64 rhat = top % v[n - 1];
+				while( qhat > 0xFFFFFFFFU || qhat * v[n - 2] > ((rhat << 32) | u[j + n - 2]) )
+				{
+					qhat--;
+					rhat += v[n - 1];
+					if( rhat > 0xFFFFFFFFU )
+						break;
+				}
+
+				//multiply and subtract
+				Int64 borrow = 0;
+				UInt64 carry = 0;
+				for( int i = 0; i < n; i++ )
+				{
+					UInt64 product = qhat * v[i] + carry;
+					carry = product >> 32;
+					Int64 difference = (Int64)u[i + j] - borrow - (Int64)(UInt32)product;
+					u[i + j] = (UInt32)difference;
+					borrow = difference < 0 ? 1 : 0;
+				}
+				Int64 difference = (Int64)u[j + n] - borrow - (Int64)carry;
+				u[j + n] = (UInt32)difference;
+
+				//the estimate was one too large, add the denominator back
+				q[j] = (UInt32)qhat;
+				if( difference < 0 )
+				{
+					q[j]--;
+					carry = 0;
+					for( int i = 0; i < n; i++ )
+					{
+						UInt64 sum = (UInt64)u[i + j] + v[i] + carry;
+						u[i + j] = (UInt32)sum;
+						carry = sum >> 32;
+					}
+					u[j + n] += (UInt32)carry;
+				}
+			}
+
+			for( int i = 0; i < n; i++ )
+				r[i] = (u[i] >> shift) | (shift ? u[i + 1] << (32 - shift) : 0);
+		}
+		if( quot )
+			PHANTASMA_COPY(q, q + Words, quot);
+		if( rem )
+			PHANTASMA_COPY(r, r + Words, rem);
+	}
+	static int Compare(const TInt256& a, const TInt256& b)
+	{
+		for( int i = Words; i-- > 0; )
+		{
+			UInt32 x = a._data[i];
+			UInt32 y = b._data[i];
+			if( Signed && i == Words - 1 )
+			{
+				x ^= _SignBit;
+				y ^= _SignBit;
+			}
+			if( x != y )
+				return x < y ? -1 : 1;
+		}
+		return 0;
+	}
+	// Fails if a magnitude does not fit in this type with the given sign
+	static bool FromMagnitude(const UInt32* magnitude, bool negative, TInt256& output)
+	{
+		if( Signed && (magnitude[Words - 1] & _SignBit) )
+		{
+			//only the smallest Int256 has a magnitude with the top bit set
+			if( !negative || magnitude[Words - 1] != _SignBit )
+				return false;
+			for( int i = 0; i < Words - 1; i++ )
+				if( magnitude[i] )
+					return false;
+		}
+		if( !Signed && negative && SignificantWords(magnitude) )
+			return false;
+		if( negative )
+			Negate(magnitude, output._data);
+		else
+			PHANTASMA_COPY(magnitude, magnitude + Words, output._data);
+		return true;
+	}
+public:
+	static const TInt256 Zero() { return TInt256{}; }
+	static const TInt256 One()  { return TInt256{(Int32)1}; }
+	static const TInt256 MaxValue()
+	{
+		TInt256 result = ~TInt256{};
+		if( Signed )
+			result._data[Words - 1] = ~_SignBit;
+		return result;
+	}
+	static const TInt256 MinValue()
+	{
+		TInt256 result;
+		if( Signed )
+			result._data[Words - 1] = _SignBit;
+		return result;
+	}
+
+	TInt256() : _data() {}
+
+	TInt256(Int32 val) : TInt256((Int64)val)
+	{
+	}
+
+	TInt256(UInt32 val) : TInt256((UInt64)val)
+	{
+	}
+
+	TInt256(Int64 val)
+	{
+		_data[0] = (UInt32)val;
+		_data[1] = (UInt32)((UInt64)val >> 32);
+		for( int i = 2; i < Words; i++ )
+			_data[i] = val < 0 ? 0xFFFFFFFFU : 0;
+	}
+
+	TInt256(UInt64 val) : _data()
+	{
+		_data[0] = (UInt32)val;
+		_data[1] = (UInt32)(val >> 32);
+	}
+
+	// Reinterprets the bits of the other type, as a cast between int64_t and uint64_t would
+	template<bool S>
+	explicit TInt256(const TInt256<S>& other)
+	{
+		PHANTASMA_COPY(other._data, other._data + Words, _data);
+	}
+
+	TInt256(const UInt32* words, int numWords, int sign = 1) : _data()
+	{
+		UInt32 magnitude[Words] = {};
+		int n = words ? numWords : 0;
+		for( int i = 0; i < n; i++ )
+		{
+			if( i < Words )
+				magnitude[i] = words[i];
+			else if( words[i] )
+			{
+				PHANTASMA_EXCEPTION("number is too large");
+				return;
+			}
+		}
+		if( !FromMagnitude(magnitude, sign < 0, *this) )
+		{
+			PHANTASMA_EXCEPTION("number is too large");
+		}
+	}
+
+	template<bool S>
+	explicit TInt256(const TBigInteger<S>& value) : _data()
+	{
+		if( !TryFromBigInteger(value, *this) )
+		{
+			PHANTASMA_EXCEPTION("number is too large");
+		}
+	}
+
+	template<bool S>
+	static bool TryFromBigInteger(const TBigInteger<S>& value, TInt256& output)
+	{
+		output = TInt256{};
+		UInt32 magnitude[Words] = {};
+		for( int i = 0, end = (int)value._data.size(); i < end; i++ )
+		{
+			if( i >= Words )
+			{
+				if( value._data[i] )
+					return false;
+			}
+			else
+				magnitude[i] = value._data[i];
+		}
+		return FromMagnitude(magnitude, value._sign < 0, output);
+	}
+
+	template<bool S = false>
+	TBigInteger<S> ToBigInteger() const
+	{
+		UInt32 magnitude[Words];
+		Magnitude(magnitude);
+		return TBigInteger<S>(magnitude, Words, IsNegative() ? -1 : 1);
+	}
+
+	template<bool S>
+	explicit operator TBigInteger<S>() const
+	{
+		return ToBigInteger<S>();
+	}
+
+	TInt256(const String& str, int radix, bool* out_error=0)
+		: TInt256(str.c_str(), (int)str.length(), radix, out_error)
+	{
+	}
+	TInt256(const Char* str, int strLength, int radix, bool* out_error=0) : _data()
+	{
+		if( !TryParse(str, strLength, radix, *this) )
+		{
+			if( out_error )
+				*out_error = true;
+			PHANTASMA_EXCEPTION("Invalid string in constructor.");
+		}
+	}
+
+	// Parses the text in the given radix (2 to 36), as the TBigInteger constructor does. Returns false if the text
+	//  is not a number, or the number does not fit.
+	static bool TryParse(const Char* str, int strLength, int radix, TInt256& output)
+	{
+		output = TInt256{};
+		if( !str || radix < 2 || radix > 36 )
+			return false;
+		if( strLength == 0 )
+			strLength = (int)PHANTASMA_STRLEN(str);
+
+		const Char* first = str;
+		const Char* last = first + strLength - 1;
+		while( first <= last && (*first == '\r' || *first == '\n') )
+			++first;
+		while( last >= first && (*last == '\r' || *last == '\n') )
+			--last;
+		bool negative = first <= last && *first == '-';
+		if( negative )
+			++first;
+
+		//digits are consumed in chunks as large as a single digit multiplier allows
+		UInt32 chunkLimit = 0xFFFFFFFFU / (UInt32)radix;
+		UInt32 magnitude[Words] = {};
+		UInt32 chunk = 0;
+		UInt32 chunkMultiplier = 1;
+		for( const Char* c = first; c <= last; ++c )
+		{
+			int val = toupper(*c);
+			val = ((val >= '0' && val <= '9') ? (val - '0') : ((val < 'A' || val > 'Z') ? 9999999 : (val - 'A' + 10)));
+			if( val >= radix )
+				return false;
+			chunk = chunk * radix + val;
+			chunkMultiplier *= radix;
+			if( chunkMultiplier > chunkLimit || c == last )
+			{
+				if( MultiplyAdd(magnitude, chunkMultiplier, chunk) )
+					return false;
+				chunk = 0;
+				chunkMultiplier = 1;
+			}
+		}
+		return FromMagnitude(magnitude, negative, output);
+	}
+	static bool TryParse(const String& input, TInt256& output, int radix = 10)
+	{
+		return TryParse(input.c_str(), (int)input.length(), radix, output);
+	}
+
+	template<class String>
+	static TInt256 Parse(const String& input, int radix = 10)
+	{
+		return TInt256(input, radix);
+	}
+
+	static TInt256 FromHex(const String& p0)
+	{
+		return TInt256(p0, 16);
+	}
+
+	explicit operator int() const
+	{
+		return (int)_data[0];
+	}
+
+	explicit operator Int64() const
+	{
+		return (Int64)(((UInt64)_data[1] << 32) | _data[0]);
+	}
+
+	explicit operator UInt64() const
+	{
+		return ((UInt64)_data[1] << 32) | _data[0];
+	}
+
+	static TInt256 Abs(const TInt256& x)
+	{
+		return x.IsNegative() ? -x : x;
+	}
+
+	bool IsNegative() const
+	{
+		return Signed && (_data[Words - 1] & _SignBit) != 0;
+	}
+
+	bool IsZero() const
+	{
+		return SignificantWords(_data) == 0;
+	}
+
+	int Sign() const
+	{
+		return IsNegative() ? -1 : IsZero() ? 0 : 1;
+	}
+
+	String ToString() const
+	{
+		return ToDecimal();
+	}
+
+	String ToDecimal() const
+	{
+		//78 digits, a sign and a null terminator
+		Char text[80];
+		Char* c = text + 80;
+		*--c = '\0';
+
+		UInt32 magnitude[Words];
+		Magnitude(magnitude);
+		do
+		{
+			//nine digits at a time
+			UInt32 chunk = DivideWord(magnitude, 1000000000U);
+			bool last = SignificantWords(magnitude) == 0;
+			for( int i = 0; i < 9 && (!last || chunk || i == 0); i++ )
+			{
+				*--c = (Char)('0' + chunk % 10);
+				chunk /= 10;
+			}
+		} while( SignificantWords(magnitude) );
+
+		if( IsNegative() )
+			*--c = '-';
+		return String(c);
+	}
+
+	String ToHex() const
+	{
+		StringBuilder builder;
+
+		UInt32 magnitude[Words];
+		Magnitude(magnitude);
+		for( int i = 0, end = PHANTASMA_MAX(SignificantWords(magnitude), 1); i < end; i++ )
+		{
+			Char buffer[10];
+			snprintf(buffer, sizeof(buffer), "%08x", magnitude[i]);
+			builder << buffer;
+		}
+
+		return String(builder.str());
+	}
+
+	TInt256& operator +=(const TInt256& b)
+	{
+		UInt64 carry = 0;
+		for( int i = 0; i < Words; i++ )
+		{
+			UInt64 sum = (UInt64)_data[i] + b._data[i] + carry;
+			_data[i] = (UInt32)sum;
+			carry = sum >> 32;
+		}
+		return *this;
+	}
+	TInt256 operator +(const TInt256& b) const
+	{
+		TInt256 result = *this;
+		return result += b;
+	}
+
+	TInt256& operator -=(const TInt256& b)
+	{
+		Int64 borrow = 0;
+		for( int i = 0; i < Words; i++ )
+		{
+			Int64 difference = (Int64)_data[i] - b._data[i] - borrow;
+			_data[i] = (UInt32)difference;
+			borrow = difference < 0 ? 1 : 0;
+		}
+		return *this;
+	}
+	TInt256 operator -(const TInt256& b) const
+	{
+		TInt256 result = *this;
+		return result -= b;
+	}
+
+	TInt256 operator *(const TInt256& b) const
+	{
+		//only the digits that fit in the result are computed
+		TInt256 result;
+		for( int i = 0; i < Words; i++ )
+		{
+			if( _data[i] == 0 )
+				continue;
+			UInt64 carry = 0;
+			for( int j = 0; i + j < Words; j++ )
+			{
+				UInt64 product = (UInt64)_data[i] * b._data[j] + result._data[i + j] + carry;
+				result._data[i + j] = (UInt32)product;
+				carry = product >> 32;
+			}
+		}
+		return result;
+	}
+	TInt256& operator *=(const TInt256& b)
+	{
+		return (*this = *this * b);
+	}
+
+	TInt256 operator /(const TInt256& b) const
+	{
+		TInt256 quot, rem;
+		DivideAndModulus(*this, b, quot, rem);
+		return quot;
+	}
+	TInt256& operator /=(const TInt256& b)
+	{
+		return (*this = *this / b);
+	}
+
+	TInt256 operator %(const TInt256& b) const
+	{
+		TInt256 quot, rem;
+		DivideAndModulus(*this, b, quot, rem);
+		return rem;
+	}
+	TInt256& operator %=(const TInt256& b)
+	{
+		return (*this = *this % b);
+	}
+
+	// The quotient is truncated towards zero, and the remainder has the sign of a. Division by zero gives zero.
+	static void DivideAndModulus(const TInt256& a, const TInt256& b, TInt256& quot, TInt256& rem)
+	{
+		UInt32 x[Words], y[Words];
+		a.Magnitude(x);
+		b.Magnitude(y);
+		DivideUnsigned(x, y, quot._data, rem._data);
+		if( a.IsNegative() != b.IsNegative() )
+			Negate(quot._data, quot._data);
+		if( a.IsNegative() )
+			Negate(rem._data, rem._data);
+	}
+
+	static TInt256 DivideAndRoundToClosest(const TInt256& numerator, const TInt256& denominator)
+	{
+		return (numerator + (denominator / 2)) / denominator;
+	}
+
+	static TInt256 Pow(TInt256 powBase, UInt32 powExp)
+	{
+		TInt256 val = One();
+		for( ; powExp; powExp >>= 1 )
+		{
+			if( powExp & 1 )
+				val *= powBase;
+			if( powExp > 1 )
+				powBase *= powBase;
+		}
+		return val;
+	}
+
+	// Shifts are arithmetic for Int256
+	TInt256 operator >>(int bits) const
+	{
+		TInt256 r = *this;
+		return r >>= bits;
+	}
+	TInt256& operator >>=(int bits)
+	{
+		bits = bits < 0 ? -bits : bits;
+		UInt32 fill = Fill();
+		int words = PHANTASMA_MIN(bits / 32, Words);
+		int shift = bits % 32;
+		for( int i = 0; i < Words; i++ )
+		{
+			UInt32 low  = i + words     < Words ? _data[i + words]     : fill;
+			UInt32 high = i + words + 1 < Words ? _data[i + words + 1] : fill;
+			_data[i] = shift ? (low >> shift) | (high << (32 - shift)) : low;
+		}
+		return *this;
+	}
+
+	TInt256 operator <<(int bits) const
+	{
+		TInt256 r = *this;
+		return r <<= bits;
+	}
+	TInt256& operator <<=(int bits)
+	{
+		bits = bits < 0 ? -bits : bits;
+		int words = PHANTASMA_MIN(bits / 32, Words);
+		int shift = bits % 32;
+		for( int i = Words; i-- > 0; )
+		{
+			UInt32 high = i - words     >= 0 ? _data[i - words]     : 0;
+			UInt32 low  = i - words - 1 >= 0 ? _data[i - words - 1] : 0;
+			_data[i] = shift ? (high << shift) | (low >> (32 - shift)) : high;
+		}
+		return *this;
+	}
+
+	TInt256& operator ++()
+	{
+		return (*this += One());
+	}
+	TInt256 operator ++(int)
+	{
+		TInt256 pre = *this;
+		*this += One();
+		return pre;
+	}
+
+	TInt256& operator --()
+	{
+		return (*this -= One());
+	}
+	TInt256 operator --(int)
+	{
+		TInt256 pre = *this;
+		*this -= One();
+		return pre;
+	}
+
+	TInt256 operator -() const
+	{
+		TInt256 n;
+		Negate(_data, n._data);
+		return n;
+	}
+
+	bool operator ==(const TInt256& b) const
+	{
+		return PHANTASMA_EQUAL(_data, _data + Words, b._data);
+	}
+
+	bool operator !=(const TInt256& b) const
+	{
+		return !(*this == b);
+	}
+
+	bool operator <(const TInt256& b) const
+	{
+		return Compare(*this, b) < 0;
+	}
+
+	bool operator >(const TInt256& b) const
+	{
+		return Compare(*this, b) > 0;
+	}
+
+	bool operator <=(const TInt256& b) const
+	{
+		return Compare(*this, b) <= 0;
+	}
+
+	bool operator >=(const TInt256& b) const
+	{
+		return Compare(*this, b) >= 0;
+	}
+
+	int CompareTo(const TInt256& other) const
+	{
+		return Compare(*this, other);
+	}
+
+	TInt256 operator ^(const TInt256& b) const
+	{
+		TInt256 result;
+		for( int i = 0; i < Words; i++ )
+			result._data[i] = _data[i] ^ b._data[i];
+		return result;
+	}
+
+	TInt256 operator |(const TInt256& b) const
+	{
+		TInt256 result;
+		for( int i = 0; i < Words; i++ )
+			result._data[i] = _data[i] | b._data[i];
+		return result;
+	}
+
+	TInt256 operator &(const TInt256& b) const
+	{
+		TInt256 result;
+		for( int i = 0; i < Words; i++ )
+			result._data[i] = _data[i] & b._data[i];
+		return result;
+	}
+
+	TInt256 operator ~() const
+	{
+		TInt256 result;
+		for( int i = 0; i < Words; i++ )
+			result._data[i] = ~_data[i];
+		return result;
+	}
+
+	bool TestBit(int index) const
+	{
+		if( index < 0 || index >= Bits )
+			return IsNegative();
+		return (_data[index / 32] >> (index % 32)) & 1;
+	}
+
+	bool CalcIsEven() const
+	{
+		return (_data[0] & 1) == 0;
+	}
+
+	// The number of bits of the absolute value, as TBigInteger::GetBitLength
+	int GetBitLength() const
+	{
+		UInt32 magnitude[Words];
+		Magnitude(magnitude);
+		int n = SignificantWords(magnitude);
+		return n == 0 ? 0 : n * 32 - LeadingZeros(magnitude[n - 1]);
+	}
+
+	const UInt32* ToUintArray() const
+	{
+		return _data;
+	}
+
+	// The absolute value, in as few little-endian bytes as possible (see TBigInteger::ToUnsignedByteArray)
+	int ToUnsignedByteArray(Byte* result, int resultSize) const
+	{
+		int bitLength = GetBitLength();
+		int byteArraySize = (bitLength + 7) / 8;
+		if( !result )
+			return byteArraySize;
+		if( resultSize < byteArraySize )
+		{
+			PHANTASMA_EXCEPTION("invalid argument");
+			return 0;
+		}
+		UInt32 magnitude[Words];
+		Magnitude(magnitude);
+		for( int i = 0; i < byteArraySize; i++ )
+			result[i] = (Byte)(magnitude[i / 4] >> (8 * (i % 4)));
+		return byteArraySize;
+	}
+	ByteArray ToUnsignedByteArray() const
+	{
+		ByteArray result;
+		result.resize(ToUnsignedByteArray(0, 0));
+		if( !result.empty() )
+			ToUnsignedByteArray(&result.front(), (int)result.size());
+		return result;
+	}
+
+	// Two's complement, with the same length as TBigInteger::ToSignedByteArray: the bytes of the absolute value plus a
+	//  sign byte, and for negative numbers one more unless the absolute value fills whole digits. At most 34 bytes.
+	int ToSignedByteArray(Byte* result, int resultSize) const
+	{
+		int bitLength = GetBitLength();
+		int byteArraySize = (bitLength + 7) / 8 + 1;
+		if( IsNegative() && (byteArraySize - 1) % 4 != 0 )
+			byteArraySize++;
+		if( !result )
+			return byteArraySize;
+		if( resultSize < byteArraySize )
+		{
+			PHANTASMA_EXCEPTION("invalid argument");
+			return 0;
+		}
+		Byte fill = (Byte)Fill();
+		for( int i = 0; i < byteArraySize; i++ )
+			result[i] = i < Words * 4 ? (Byte)(_data[i / 4] >> (8 * (i % 4))) : fill;
+		return byteArraySize;
+	}
+	ByteArray ToSignedByteArray() const
+	{
+		ByteArray result;
+		result.resize(ToSignedByteArray(0, 0));
+		ToSignedByteArray(&result.front(), (int)result.size());
+		return result;
+	}
+
+	// Reads two's complement bytes, as produced by ToSignedByteArray. Returns false if the number does not fit.
+	static bool TryFromSignedArray(const Byte* signedArray, int signedArrayLength, TInt256& output)
+	{
+		output = TInt256{};
+		if( !signedArray || signedArrayLength <= 0 )
+			return true;
+		Byte msb = signedArray[signedArrayLength - 1];
+		if( msb != 0x00 && msb != 0xFF )
+			return false;
+		bool negative = msb == 0xFF;
+		if( negative && !Signed )
+			return false;
+		for( int i = 0; i < Words * 4; i++ )
+		{
+			Byte b = i < signedArrayLength ? signedArray[i] : msb;
+			output._data[i / 4] |= (UInt32)b << (8 * (i % 4));
+		}
+		//every byte past the ones kept must only repeat the sign
+		for( int i = Words * 4; i < signedArrayLength; i++ )
+			if( signedArray[i] != msb )
+				return false;
+		return !Signed || output.IsNegative() == negative;
+	}
+	static TInt256 FromSignedArray(const Byte* signedArray, int signedArrayLength)
+	{
+		TInt256 result;
+		if( !TryFromSignedArray(signedArray, signedArrayLength, result) )
+		{
+			PHANTASMA_EXCEPTION("invalid sign byte, or number is too large");
+		}
+		return result;
+	}
+	template<class Bytes>
+	static TInt256 FromSignedArray(const Bytes& signedArray)
+	{
+		return FromSignedArray(signedArray.empty() ? 0 : &signedArray.front(), (int)signedArray.size());
+	}
+
+	// Reads the little-endian bytes of an absolute value. Returns false if the number does not fit.
+	static bool TryFromUnsignedArray(const Byte* unsignedArray, int unsignedArrayLength, bool isPositive, TInt256& output)
+	{
+		output = TInt256{};
+		UInt32 magnitude[Words] = {};
+		for( int i = 0; unsignedArray && i < unsignedArrayLength; i++ )
+		{
+			if( i >= Words * 4 )
+			{
+				if( unsignedArray[i] )
+					return false;
+			}
+			else
+				magnitude[i / 4] |= (UInt32)unsignedArray[i] << (8 * (i % 4));
+		}
+		return FromMagnitude(magnitude, !isPositive, output);
+	}
+	static TInt256 FromUnsignedArray(const Byte* unsignedArray, int unsignedArrayLength, bool isPositive)
+	{
+		TInt256 result;
+		if( !TryFromUnsignedArray(unsignedArray, unsignedArrayLength, isPositive, result) )
+		{
+			PHANTASMA_EXCEPTION("number is too large");
+		}
+		return result;
+	}
+	template<class Bytes>
+	static TInt256 FromUnsignedArray(const Bytes& unsignedArray, bool isPositive)
+	{
+		return FromUnsignedArray(unsignedArray.empty() ? 0 : &unsignedArray.front(), (int)unsignedArray.size(), isPositive);
+	}
+
+	// The same hash as TBigInteger::GetHashCode for the same value
+	int GetHashCode() const
+	{
+		Int64 hashCode = -1521134295 * Sign();
+
+		UInt32 magnitude[Words];
+		Magnitude(magnitude);
+		for( int i = 0, end = PHANTASMA_MAX(SignificantWords(magnitude), 1); i < end; i++ )
+		{
+			hashCode = (int)((Int64)((UInt64)hashCode << 3) | ((hashCode >> 29) ^ magnitude[i]));
+		}
+
+		return (int)hashCode;
+	}
+};
+
+template<bool S>
+inline String DecimalConversion( const TInt256<S>& value, UInt32 decimals, Char decimalPoint='.', bool alwaysShowDecimalPoint=false )
+{
+	String digits = value.ToString();
+	const Char* text = digits.c_str();
+	bool negative = *text == '-';
+	if( negative )
+		++text;
+	UInt32 length = (UInt32)PHANTASMA_STRLEN(text);
+	UInt32 integerLength = length > decimals ? length - decimals : 0;
+	UInt32 fractionEnd = length;
+	while( fractionEnd > integerLength && text[fractionEnd - 1] == '0' )
+		--fractionEnd;
+
+	PHANTASMA_VECTOR<Char> result;
+	result.reserve(length + decimals + 4);
+	if( negative )
+		result.push_back('-');
+	if( integerLength == 0 )
+		result.push_back('0');
+	result.insert(result.end(), text, text + integerLength);
+	if( fractionEnd > integerLength || alwaysShowDecimalPoint )
+	{
+		result.push_back(decimalPoint);
+		if( fractionEnd > integerLength )
+		{
+			for( UInt32 i = length - integerLength; i < decimals; ++i )
+				result.push_back('0');
+			result.insert(result.end(), text + integerLength, text + fractionEnd);
+		}
+	}
+	result.push_back('\0');
+	return String(&result.front());
+}
+
+}
@@ -155,9 +155,12 @@
 // |`PHANTASMA_VECTOR`       |                           | `std::vector`       | Must support `push_back` and `size` members            |
 // |`PHANTASMA_JSONVALUE`    | `phantasma::JSONValue`    | `std::string_view`  | See JSON and Adaptors section                          |
 // |`PHANTASMA_JSONARRAY`    | `phantasma::JSONArray`    | `JSONValue`         | See JSON and Adaptors section                          |
+// |`PHANTASMA_JSONARRAYCURSOR`|`phantasma::JSONArrayCursor`| `JSONArrayCursor`*| See JSON and Adaptors section                          |
+// |`PHANTASMA_JSONOBJECTCURSOR`|`phantasma::JSONObjectCursor`| `JSONObjectCursor`*| See JSON and Adaptors section                        |
 // |`PHANTASMA_JSONDOCUMENT` | `phantasma::JSONDocument` | `std::string`       | See JSON and Adaptors section                          |
 // |`PHANTASMA_JSONBUILDER`  | `phantasma::JSONBuilder`  | `std::stringstream`*| See JSON and Adaptors section                          |
 // |`PHANTASMA_HTTPCLIENT`   | `phantasma::HttpClient`   |                     | See HTTP and Adaptors section                          |
+// |`PHANTASMA_ASYNC_HTTPCLIENT`|`phantasma::AsyncHttpClient`|                  | See HTTP and Asynchronous API sections                 |
 //
 // The behavior of this header can further be modified by using the following 
 //  `#defines` (BEFORE including `phantasma.h`)
@@ -169,6 +172,10 @@
 // |`PHANTASMA_LITERAL(x)`                         | See Unicode section     |
 // |`PHANTASMA_FUNCTION`                           | See Integration section |        
 // |`PHANTASMA_IMPLEMENTATION`                     | See Integration section |
+// |`PHANTASMA_SIMD_DISABLE`                       | See JSON section        |
+// |`PHANTASMA_RPC_STRINGVIEW`                     | See String views section|
+// |`PHANTASMA_PMR`                                | See Allocators section  |
+// |`PHANTASMA_INT128_DISABLE`                     | See Extended usage      |
 //
 //------------------------------------------------------------------------------
 // Integration
@@ -239,7 +246,9 @@
 // |----------|--------------|-------------------------------------|-----------------------------------------|
 // |C++ REST  | HTTP + JSON  | `Adapters/PhantasmaAPI_cpprest.h`   | https://github.com/microsoft/cpprestsdk |
 // |libcurl   | HTTP         | `Adapters/PhantasmaAPI_curl.h`      | https://curl.haxx.se/libcurl/           |
+// |epoll     | HTTP         | `Adapters/PhantasmaAPI_epoll.h`     | (built-in, Linux only, no TLS)          |
 // |RapidJSON | JSON         | `Adapters/PhantasmaAPI_rapidjson.h` | http://rapidjson.org/                   |
+// |Tape JSON | JSON         | `Adapters/PhantasmaAPI_tapejson.h`  | (built-in, no external dependency)      |
 // |Sodium    | Cryptography | `Adapters/PhantasmaAPI_sodium.h`    | https://libsodium.org                   |
 //
 //------------------------------------------------------------------------------
@@ -249,14 +258,24 @@
 //  as simple as possible (approx 200 lines of code) and is not high-performance
 //  or highly robust.
 //
+// On x86-64, the built-in parser scans the bodies of strings 16 bytes at a
+//  time (SSE2). Define `PHANTASMA_SIMD_DISABLE` to use the portable
+//  byte-at-a-time scanner instead. The JsonScanBenchmark sample compares it
+//  with the other scanners on block payloads.
+//
 // It is recommended that you supply another JSON-parsing API, by defining the
 //  following macros before including `phantasma.h`:
 //  `#define PHANTASMA_JSONVALUE    Your_Json_Value_Type`
 //  `#define PHANTASMA_JSONARRAY    Your_Json_Array_Type`
+//  `#define PHANTASMA_JSONARRAYCURSOR Your_Json_Array_Iterator_Type` (optional)
+//  `#define PHANTASMA_JSONOBJECTCURSOR Your_Json_Object_Iterator_Type` (optional)
 //  `#define PHANTASMA_JSONDOCUMENT Your_JSON_Document_Type`
 //  `#define PHANTASMA_JSONBUILDER  Your_Json_Serializer_Type`
 //
-// **The CPP REST and RapidJSON adaptors implement these macros.**
+// **The CPP REST, RapidJSON and Tape JSON adaptors implement these macros.**
+//
+// The Tape JSON adaptor tokenizes each response once, making field lookups and
+//  array indexing far cheaper than the built-in parser on large responses.
 //
 // Also, this header uses the following procedural API to interact with these types.
 // If you have supplied your own JSON types, you must implement the following functions:
@@ -285,12 +304,41 @@
 //        int       ArraySize(    const JSONArray&,                    bool& out_error);
 //        JSONValue IndexArray(   const JSONArray&, int index,         bool& out_error);
 //     
+//        JSONArrayCursor ArrayBegin(const JSONArray&,                 bool& out_error);
+//        bool      ArrayValid(   const JSONArrayCursor&,              bool& out_error);
+//        void      ArrayNext(    JSONArrayCursor&,                    bool& out_error);
+//        JSONValue ArrayValue(   const JSONArrayCursor&,              bool& out_error);
+//     
+//        JSONObjectCursor ObjectBegin(const JSONValue&,               bool& out_error);
+//        bool      ObjectValid(  const JSONObjectCursor&,             bool& out_error);
+//        void      ObjectNext(   JSONObjectCursor&,                   bool& out_error);
+//        const Char* ObjectKey(  const JSONObjectCursor&, size_t& out_length, bool& out_error);
+//        JSONValue ObjectValue(  const JSONObjectCursor&,             bool& out_error);
+//     
 //                               void BeginObject(JSONBuilder&);
 //                               void AddString  (JSONBuilder&, const Char* key, const Char* value);
 //       template<class... Args> void AddArray   (JSONBuilder&, const Char* key, Args...);
 //                               void EndObject  (JSONBuilder&);
+//                               void BeginArray (JSONBuilder&);
+//                               void EndArray   (JSONBuilder&);
 //     }}
 //
+// The Array* cursor functions are used to walk arrays from front to back in
+//  linear time. If you don't define `PHANTASMA_JSONARRAYCURSOR`, they are
+//  implemented for you on top of ArraySize/IndexArray.
+//
+// The Object* cursor functions walk the members of an object in document 
+//  order. The RPC structures are deserialized in a single pass over their 
+//  members, which are matched to fields by a hash of the key. If JSONValue is 
+//  a reference type, ObjectValue must return a reference into the document.
+//  If you don't define `PHANTASMA_JSONOBJECTCURSOR`, they are implemented for
+//  you on top of HasField/LookupValue, which look up each field of the RPC
+//  structure by name instead. If you do define it, declare ObjectBegin before
+//  including this header.
+//
+// BeginArray/EndArray wrap a sequence of BeginObject..EndObject calls in a JSON
+//  array, which is used to send batches of requests (see Batches).
+//
 //------------------------------------------------------------------------------
 // HTTP
 //------------------------------------------------------------------------------
@@ -302,7 +350,7 @@
 //  including `phantasma.h`:
 // `#define PHANTASMA_HTTPCLIENT   Your_HTTP_Client_Type`
 //
-// **The CPP REST and libcurl adaptors implement this macro.**
+// **The CPP REST, libcurl and epoll adaptors implement this macro.**
 //
 // Also, this header uses the following procedural API to interact with this type.
 // If you have defined `PHANTASMA_HTTPCLIENT`, you must implement the following,
@@ -312,6 +360,195 @@
 //      JSONDocument HttpPost(HttpClient&, const Char* uri, const JSONBuilder&, PhantasmaError* out_error);
 //     }
 //
+// To stream large responses with `Utils/RpcStream.h`, the client must also
+//  implement the following, which should pass the response body to `write` as
+//  it arrives (a short return from `write` should abort the request):
+//
+//     namespace phantasma {
+//      void HttpPostStream(HttpClient&, const Char* uri, const JSONBuilder&, 
+//                          size_t(*write)(char*, size_t, size_t, void* userp), void* userp, PhantasmaError* out_error);
+//     }
+//
+// **The libcurl adaptor implements this function.**
+//
+// To enable the `AsyncPhantasmaAPI` class, define the following macro before 
+//  including `phantasma.h`:
+// `#define PHANTASMA_ASYNC_HTTPCLIENT   Your_Async_HTTP_Client_Type`
+//
+// and implement the following function, which should start a HTTP POST request
+//  and return without waiting for the response. Once the request completes, it
+//  must call `onComplete` exactly once, with the parsed response, or with a null
+//  response and an error message:
+//
+//     namespace phantasma {
+//      void HttpPostAsync(AsyncHttpClient&, const Char* uri, const JSONBuilder&, 
+//                         std::function<void(const JSONDocument* response, const Char* error)> onComplete);
+//     }
+//
+// **The CPP REST, libcurl (`CurlMultiClient`) and epoll adaptors implement this function.**
+//
+// To spread calls over several nodes, `Utils/NodePool.h` wraps the HttpClients
+//  of several nodes. It routes each call to the fastest healthy node, and can
+//  hedge slow calls by also sending them to a second node.
+//
+// `Utils/ResponseCache.h` provides `CachedPhantasmaAPI`, which keeps the parsed
+//  results of calls that rarely change (chains, tokens, the nexus, contracts)
+//  for a time-to-live, and of blocks permanently, in a size-limited LRU cache.
+//
+// `Utils/BlockRangeFetcher.h` fetches a range of blocks over several
+//  connections at once, optionally as JSON-RPC batches, and delivers them in
+//  height order with a bounded look-ahead window.
+//
+// `Utils/PaginatedFetcher.h` does the same for the pages of paginated calls
+//  (`AddressTransactionsFetcher`, `AuctionsFetcher`), reading the number of
+//  pages from the first response.
+//
+// `Utils/BlockStore.h` keeps raw blocks on disk, in append-only segment files
+//  with an index by height, so that a chain can be re-indexed without fetching
+//  it again. The stored blocks are memory-mapped, and `BlockView` reads them in
+//  place, without copying or allocating.
+//
+//------------------------------------------------------------------------------
+// String views
+//------------------------------------------------------------------------------
+// By default, every string field of the RPC structures (`rpc::Block`, 
+//  `rpc::Transaction`, etc) is a `String` that owns a copy of its text.
+// Read-only consumers can avoid these allocations by defining the following
+//  before including `phantasma.h`:
+//
+// `#define PHANTASMA_RPC_STRINGVIEW`
+//
+// The string fields then become `RpcString` (`std::basic_string_view<Char>`), 
+//  which point into the JSON document that they were parsed from, so that 
+//  document must outlive the RPC structures.
+// The `PhantasmaAPI` methods take a `ResponseArena&` as their first argument, 
+//  which keeps each response document alive until the arena is cleared:
+//
+//     ResponseArena arena;
+//     Block block = phantasmaAPI.GetBlockByHeight(arena, chainInput, height, error);
+//
+// Your JSON library must also implement the following function, which returns
+//  a view that lives as long as the JSON document:
+//
+//     namespace phantasma { namespace json {
+//        StringView AsStringView(const JSONValue&, bool& out_error);
+//     }}
+//
+// **The built-in parser, RapidJSON and Tape JSON adaptors implement this function.**
+//
+// The helpers in `Utils/RpcUtils.h` require owning strings.
+//
+//------------------------------------------------------------------------------
+// Allocators
+//------------------------------------------------------------------------------
+// By default, the RPC structures are deserialized onto the global heap.
+// To allocate them from a C++17 `std::pmr::memory_resource` instead, such as a
+//  `std::pmr::monotonic_buffer_resource`, define the following before including
+//  `phantasma.h`:
+//
+// `#define PHANTASMA_PMR`
+//
+// The array fields then become `RpcVector<T>` (`std::pmr::vector<T>`), and the
+//  string fields become `RpcString` (`std::pmr::basic_string<Char>`, unless 
+//  `PHANTASMA_RPC_STRINGVIEW` is also defined).
+// The memory resource is selected for the calling thread by a `RpcMemoryScope`:
+//
+//     std::pmr::monotonic_buffer_resource arena;
+//     Block block;
+//     {
+//        RpcMemoryScope scope(&arena);
+//        PhantasmaJsonAPI::ParseGetBlockByHeightResponse(json::Parse(doc), block, &err);
+//     }
+//
+// Everything beneath the top-level output object is allocated from the arena,
+//  so the output must be destroyed before the arena is.
+// The RpcArenaBenchmark sample counts the heap allocations of a block of 5000
+//  transactions with and without an arena.
+// Your JSON library must implement `json::AsStringView` (see String views).
+//
+//------------------------------------------------------------------------------
+// Projections
+//------------------------------------------------------------------------------
+// If you only need a few fields of a large response, pass a `RpcProjection` to
+//  the `PhantasmaJsonAPI::Parse*Response` functions. For each type of RPC 
+//  structure, it holds a mask of the fields to deserialize, built from the
+//  constants in the `fields` namespace. All fields are selected by default.
+//
+//     RpcProjection projection;
+//     projection.Select<fields::Transaction>(fields::Transaction::hash | fields::Transaction::events)
+//               .Select<fields::Event>(fields::Event::kind | fields::Event::address | fields::Event::data);
+//     PhantasmaJsonAPI::ParseGetBlockByHeightResponse(json::Parse(doc), block, &err, &projection);
+//
+// Fields that are not selected are never looked up in the JSON document, so 
+//  their values are not decoded, copied or allocated, and are left empty / zero.
+//
+//------------------------------------------------------------------------------
+// Lazy deserialization
+//------------------------------------------------------------------------------
+// `LazyBlock` and `LazyTransaction` mirror `Block` and `Transaction`, except 
+//  that their nested arrays are `LazyArray<T>` values, which keep a reference
+//  to the unparsed JSON array and only deserialize it on first access. This 
+//  lets you skim a response (e.g. check `block.height`) without paying for 
+//  the transactions that it contains:
+//
+//     LazyBlock block;
+//     PhantasmaJsonAPI::ParseLazyResponse(json::Parse(doc), block, &err);
+//     if( block.height > lastHeight )
+//        for( const LazyTransaction& tx : block.txs.Get() )
+//           ...
+//
+// `ParseLazyResponse` accepts the response of any method that returns a Block 
+//  or Transaction. The JSON document must outlive the lazy structures.
+//
+// If an array is malformed, `Get(jsonError)` returns an empty vector and sets
+//  `jsonError`, on that call and every later one, and `Failed()` returns true.
+//
+//------------------------------------------------------------------------------
+// Batches
+//------------------------------------------------------------------------------
+// Each `PhantasmaAPI` method sends one HTTP request. To fetch many items in 
+//  fewer round trips, queue the requests in a `RpcBatch`, which are then sent 
+//  as JSON-RPC 2.0 batches of up to `maxSize` requests per HTTP POST:
+//
+//     RpcBatch batch(100);
+//     Block blocks[1000];
+//     PhantasmaError errors[1000];
+//     for( UInt32 i = 0; i != 1000; ++i )
+//        batch.Add(&PhantasmaJsonAPI::MakeGetBlockByHeightRequest, &PhantasmaJsonAPI::ParseGetBlockByHeightResponse, 
+//                  blocks[i], &errors[i], chainInput, first + i);
+//     phantasmaAPI.Send(batch, &error);
+//
+// Each request is given its position in the batch as its JSON-RPC id, and each
+//  element of the response is passed to its Parse*Response function by id, so
+//  the node may answer out of order. `error` reports the first failure of the
+//  HTTP requests themselves, and each output's error reports its own result.
+//  If a HTTP request fails, the rest are still sent, and only the requests of
+//  the failed one get its error.
+// The arguments, outputs and errors must remain valid until the batch is sent.
+//
+// Without a HTTP client, use `PhantasmaJsonAPI::MakeBatchRequest` and 
+//  `PhantasmaJsonAPI::ParseBatchResponse` for each of `batch.Batches()`.
+//
+//------------------------------------------------------------------------------
+// Asynchronous API
+//------------------------------------------------------------------------------
+// The methods of `AsyncPhantasmaAPI` mirror those of `PhantasmaAPI`, except that
+//  they return as soon as the request has been sent, and pass the result to a
+//  callback when the response arrives. A single thread can therefore keep many
+//  requests in flight at once:
+//
+//     AsyncPhantasmaAPI asyncAPI(asyncHttpClient);
+//     for( UInt32 height = first; height != last; ++height )
+//        asyncAPI.GetBlockByHeight(chainInput, height, [](Block& block, PhantasmaError& error)
+//        {
+//           ...
+//        });
+//
+// The callbacks are invoked by the HTTP client: on one of its worker threads
+//  (CPP REST), or from within its event loop (see `CurlMultiClient`). With 
+//  `PHANTASMA_RPC_STRINGVIEW`, the output's strings are only valid until the 
+//  callback returns.
+//
 //------------------------------------------------------------------------------
 // Extended/Advanced usage
 //------------------------------------------------------------------------------
@@ -327,11 +564,17 @@
 //  |Directory     | Features                                                              |
 //  |--------------|-----------------------------------------------------------------------|
 //  | Adapters     | Configuration for this library to communicate with 3rd party libraries|
-//  | Blockchain   | Transactions                                                          |
+//  | Blockchain   | Transactions, blocks decoded from GetRawBlockByHeight/ByHash          |
 //  | Cryptography | Public/Private keys, Signatures, Random numbers, Encryption           |
-//  | Numerics     | N-bit integer implementation. Base 16/58 ASCII encoding.              |
+//  | Numerics     | N-bit and fixed 256-bit integers. Base 16/58 ASCII encoding.          |
 //  | Security     | Practical memory protection.                                          |
 //
+// On compilers with a 128-bit integer type (GCC and Clang on 64-bit targets),
+//  BigInteger multiplies 64 bits at a time. Define `PHANTASMA_INT128_DISABLE` to
+//  use the portable 32-bit code instead. Large products use Karatsuba's method.
+//  Powers of 10 and 58 up to 79 are computed once and shared, see
+//  `BigInteger::CachedPow<Base>(exponent)`.
+//
 //------------------------------------------------------------------------------
 // - Extended/Advanced usage - Security configuration
 //------------------------------------------------------------------------------
@@ -384,6 +627,18 @@
 # include <string_view>
 #endif
 
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+# include <string_view>
+#endif
+
+#if defined(PHANTASMA_RPC_STRINGVIEW)
+# include <deque>
+#endif
+
+#if defined(PHANTASMA_PMR)
+# include <memory_resource>
+#endif
+
 #if !defined(PHANTASMA_JSONBUILDER) || !defined(PHANTASMA_STRINGBUILDER)
 # include <sstream>
 #endif
@@ -402,10 +657,29 @@
 # include <cstdint>
 #endif
 
+#if !defined(PHANTASMA_STRLEN)
+# ifdef _UNICODE
+#  include <cwchar>
+# else
+#  include <cstring>
+# endif
+#endif
+
+#include <type_traits>
+#include <functional>
+
 #if !defined(PHANTASMA_MAX) || !defined(PHANTASMA_COPY) || !defined(PHANTASMA_EQUAL) || !defined(PHANTASMA_SWAP)
 # include <algorithm>
 #endif
 
+#if !defined(PHANTASMA_JSONVALUE) && !defined(PHANTASMA_SIMD_DISABLE) && (defined(__x86_64__) || defined(_M_X64))
+# define PHANTASMA_SIMD_X64
+# include <immintrin.h>
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+#endif
+
 #if defined(_UNICODE) && !defined(PHANTASMA_EXCEPTION) && defined(PHANTASMA_EXCEPTION_ENABLE)
 # include <locale>
 # include <codecvt>
@@ -547,6 +821,40 @@ typedef std::string String;
 # endif
 #endif
 
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+typedef std::basic_string_view<Char> StringView;
+#endif
+
+#if defined(PHANTASMA_RPC_STRINGVIEW)
+typedef StringView RpcString;
+#elif defined(PHANTASMA_PMR)
+typedef std::pmr::basic_string<Char> RpcString;
+#else
+typedef String RpcString;
+#endif
+
+#ifdef PHANTASMA_PMR
+template<class T> using RpcVector = std::pmr::vector<T>;
+
+inline std::pmr::memory_resource*& RpcMemoryResourceSlot() { static thread_local std::pmr::memory_resource* resource = nullptr; return resource; }
+inline std::pmr::memory_resource*  RpcMemoryResource() { std::pmr::memory_resource* r = RpcMemoryResourceSlot(); return r ? r : std::pmr::get_default_resource(); }
+
+class RpcMemoryScope // RPC structures deserialized on this thread are allocated from `resource` until the scope ends
+{
+public:
+	explicit RpcMemoryScope(std::pmr::memory_resource* resource) : m_previous(RpcMemoryResourceSlot()) { RpcMemoryResourceSlot() = resource; }
+	~RpcMemoryScope() { RpcMemoryResourceSlot() = m_previous; }
+	RpcMemoryScope(const RpcMemoryScope&) = delete;
+	RpcMemoryScope& operator=(const RpcMemoryScope&) = delete;
+private:
+	std::pmr::memory_resource* m_previous;
+};
+# define PHANTASMA_RPC_ALLOC RpcMemoryResource()
+#else
+template<class T> using RpcVector = PHANTASMA_VECTOR<T>;
+# define PHANTASMA_RPC_ALLOC
+#endif
+
 #ifdef PHANTASMA_STRINGBUILDER
 typedef PHANTASMA_STRINGBUILDER StringBuilder;
 #else
@@ -575,6 +883,37 @@ typedef PHANTASMA_JSONARRAY JSONArray;
 typedef JSONValue JSONArray;
 #endif
 
+#ifdef PHANTASMA_JSONARRAYCURSOR
+typedef PHANTASMA_JSONARRAYCURSOR JSONArrayCursor;
+#else
+struct JSONArrayCursor
+{
+	const JSONArray* array;
+	size_t position; // built-in parser: offset of the current element. Otherwise: index of the current element
+	size_t size;     // number of elements (unused by the built-in parser)
+};
+#endif
+
+#ifdef PHANTASMA_JSONOBJECTCURSOR
+typedef PHANTASMA_JSONOBJECTCURSOR JSONObjectCursor;
+#elif !defined(PHANTASMA_JSONVALUE)
+struct JSONObjectCursor // built-in parser
+{
+	const JSONValue* object;
+	size_t keyBegin;   // offset of the current key's text, or npos after the last member
+	size_t keyEnd;
+	size_t valueBegin;
+};
+#else
+struct JSONObjectCursor // JSON libraries that only supply HasField/LookupValue
+{
+	const std::remove_reference<JSONValue>::type* object;
+	const Char* const* keys; // the fields of the RPC structure that is being deserialized
+	int numKeys;
+	int index;               // of the current key, or numKeys after the last one
+};
+#endif
+
 #ifdef PHANTASMA_JSONDOCUMENT
 typedef PHANTASMA_JSONDOCUMENT JSONDocument;
 #else
@@ -596,10 +935,12 @@ struct JSONBuilder // A VERY simple json string builder. Highly recommended that
 	template<class T> void AddValues(T arg) { s << arg; }
 	template<class T, class... Args> void AddValues(T arg0, Args... args) { AddValues(arg0); s << ", "; AddValues(args...); }
 	
-	void BeginObject() { s << "{"; }
+	void BeginObject() { if(!empty) { s << ", "; } empty = true; s << "{"; }
 	void AddString(const Char* key, const Char* value) { AddKey(key); s << '"' << value << '"'; }
 	template<class... Args> void AddArray(const Char* key, Args... args) { AddKey(key); s << '['; AddValues(args...); s << ']'; }
-	void EndObject() { s << "}"; }
+	void EndObject() { s << "}"; empty = false; }
+	void BeginArray() { s << "["; empty = true; }
+	void EndArray() { s << "]"; empty = false; }
 };
 #endif
 
@@ -608,6 +949,32 @@ typedef PHANTASMA_HTTPCLIENT HttpClient;
 //JSONDocument HttpPost(HttpClient&, const Char* uri, const JSONBuilder&, PhantasmaError* out_error);
 #endif
 
+#ifdef PHANTASMA_ASYNC_HTTPCLIENT
+typedef PHANTASMA_ASYNC_HTTPCLIENT AsyncHttpClient;
+typedef std::function<void(const JSONDocument* response, const Char* error)> HttpResponseCallback;
+//void HttpPostAsync(AsyncHttpClient&, const Char* uri, const JSONBuilder&, HttpResponseCallback onComplete);
+#endif
+
+#ifdef PHANTASMA_RPC_STRINGVIEW
+class ResponseArena // Owns the JSON documents that RpcString fields point into
+{
+public:
+	template<class Document> // JSONDocument& or JSONDocument&&, which is left empty
+	const JSONDocument& Keep(Document&& document) { m_documents.emplace_back(); PHANTASMA_SWAP(m_documents.back(), document); return m_documents.back(); }
+	void   Clear()       { m_documents.clear(); }
+	size_t Size() const  { return m_documents.size(); }
+private:
+	std::deque<JSONDocument> m_documents; // a deque never relocates its elements, so views remain valid as documents are added
+};
+# define PHANTASMA_ARENA_PARAM          ResponseArena& arena,
+# define PHANTASMA_ARENA_ARG            arena,
+# define PHANTASMA_ARENA_KEEP(document) arena.Keep(document)
+#else
+# define PHANTASMA_ARENA_PARAM
+# define PHANTASMA_ARENA_ARG
+# define PHANTASMA_ARENA_KEEP(document) document
+#endif
+
 //If providing a JSON library (highly recommended that you do!), then you must provide these functions yourself:
 namespace json
 {
@@ -637,7 +1004,65 @@ namespace json
 	template<class... Args>
 	void AddArray(JSONBuilder&, const Char* key, Args... args);
 	void EndObject(JSONBuilder&);
+	void BeginArray(JSONBuilder&);
+	void EndArray(JSONBuilder&);
+# if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+	StringView AsStringView(const JSONValue&, bool& out_error);
+# endif
+#endif
+#ifndef PHANTASMA_JSONARRAYCURSOR
+	JSONArrayCursor ArrayBegin(const JSONArray&, bool& out_error);
+	bool ArrayValid(const JSONArrayCursor&, bool& out_error);
+	void ArrayNext(JSONArrayCursor&, bool& out_error);
+	JSONValue ArrayValue(const JSONArrayCursor&, bool& out_error);
 #endif
+#ifndef PHANTASMA_JSONOBJECTCURSOR
+# ifdef PHANTASMA_JSONVALUE
+	JSONObjectCursor ObjectBegin(const JSONValue&, const Char* const* keys, int numKeys, bool& out_error);
+# else
+	JSONObjectCursor ObjectBegin(const JSONValue&, bool& out_error);
+# endif
+	bool ObjectValid(const JSONObjectCursor&, bool& out_error);
+	void ObjectNext(JSONObjectCursor&, bool& out_error);
+	const Char* ObjectKey(const JSONObjectCursor&, size_t& out_length, bool& out_error);
+	JSONValue ObjectValue(const JSONObjectCursor&, bool& out_error);
+#endif
+#if defined(PHANTASMA_JSONOBJECTCURSOR) || !defined(PHANTASMA_JSONVALUE)
+	// The Deserialize functions pass the keys of the RPC structure, which only the HasField/LookupValue cursor uses
+	inline JSONObjectCursor ObjectBegin(const JSONValue& v, const Char* const*, int, bool& out_error) { return ObjectBegin(v, out_error); }
+#endif
+#if defined(PHANTASMA_RPC_STRINGVIEW)
+	inline RpcString AsRpcString(    const JSONValue& v,                    bool& out_error) { return AsStringView(v, out_error); }
+	inline RpcString LookupRpcString(const JSONValue& v, const Char* field, bool& out_error) { return AsStringView(LookupValue(v, field, out_error), out_error); }
+#elif defined(PHANTASMA_PMR)
+	inline RpcString AsRpcString(    const JSONValue& v,                    bool& out_error) { return RpcString(AsStringView(v, out_error), RpcMemoryResource()); }
+	inline RpcString LookupRpcString(const JSONValue& v, const Char* field, bool& out_error) { return RpcString(AsStringView(LookupValue(v, field, out_error), out_error), RpcMemoryResource()); }
+#else
+	inline RpcString AsRpcString(    const JSONValue& v,                    bool& out_error) { return AsString(v, out_error); }
+	inline RpcString LookupRpcString(const JSONValue& v, const Char* field, bool& out_error) { return LookupString(v, field, out_error); }
+#endif
+
+	// FNV-1a hash of an object key. Field names are hashed at compile time, so a collision between two fields of a structure is a compile error
+	constexpr uint32_t KeyHash(const Char* key, size_t length, uint32_t hash = 2166136261u) { return length ? KeyHash(key+1, length-1, (hash ^ (uint32_t)key[0]) * 16777619u) : hash; }
+	template<size_t N> constexpr uint32_t KeyHash(const Char (&name)[N]) { return KeyHash(name, N-1); }
+	template<size_t N> inline bool KeyEquals(const Char* key, size_t length, const Char (&name)[N]) { return length == N-1 && 0 == std::char_traits<Char>::compare(key, name, N-1); }
+
+	// Stores a JSONValue, which may be a reference into its document, so it can be read after the expression that produced it
+	class JSONSlot
+	{
+		typedef typename std::remove_reference<JSONValue>::type Value;
+		typedef typename std::conditional<std::is_reference<JSONValue>::value, const Value*, Value>::type Stored;
+	public:
+		JSONSlot() {}
+		JSONSlot(const JSONValue& v) : m_value(ToStored(v, std::is_reference<JSONValue>())) {}
+		const Value& Get() const { return FromStored(m_value); }
+	private:
+		static const Value* ToStored(const Value& v, std::true_type)  { return &v; }
+		static const Value& ToStored(const Value& v, std::false_type) { return v; }
+		static const Value& FromStored(const Value* v) { static const Value empty{}; return v ? *v : empty; }
+		static const Value& FromStored(const Value& v) { return v; }
+		Stored m_value{};
+	};
 }
 
 namespace rpc
@@ -658,162 +1083,162 @@ enum class TokenSeriesMode
 
 struct Balance
 {
-	String chain;//
-	String amount;//
-	String symbol;//
+	RpcString chain;//
+	RpcString amount;//
+	RpcString symbol;//
 	UInt32 decimals;//
-	PHANTASMA_VECTOR<String> ids;//
+	RpcVector<RpcString> ids;//
 };
 
 struct Interop
 {
-	String local;//
-	String external;//
+	RpcString local;//
+	RpcString external;//
 };
 
 struct Platform
 {
-	String platform;//
-	String chain;//
-	String fuel;//
-	PHANTASMA_VECTOR<String> tokens;//
-	PHANTASMA_VECTOR<Interop> interop;//
+	RpcString platform;//
+	RpcString chain;//
+	RpcString fuel;//
+	RpcVector<RpcString> tokens;//
+	RpcVector<Interop> interop;//
 };
 
 struct Governance
 {
-	String name;//
-	String value;//
+	RpcString name;//
+	RpcString value;//
 };
 
 struct Organization
 {
-	String id;//
-	String name;//
-	PHANTASMA_VECTOR<String> members;//
+	RpcString id;//
+	RpcString name;//
+	RpcVector<RpcString> members;//
 };
 
 struct Nexus
 {
-	String name;//
-	PHANTASMA_VECTOR<Platform> platforms;//
-	PHANTASMA_VECTOR<Token> tokens;//
-	PHANTASMA_VECTOR<Chain> chains;//
-	PHANTASMA_VECTOR<Governance> governance;//
-	PHANTASMA_VECTOR<String> organizations;//
+	RpcString name;//
+	RpcVector<Platform> platforms;//
+	RpcVector<Token> tokens;//
+	RpcVector<Chain> chains;//
+	RpcVector<Governance> governance;//
+	RpcVector<RpcString> organizations;//
 };
 
 struct Stake
 {
-	String amount;//
+	RpcString amount;//
 	UInt32 time;//
-	String unclaimed;//
+	RpcString unclaimed;//
 };
 
 struct Archive
 {
-	String name;//
-	String hash;//
+	RpcString name;//
+	RpcString hash;//
 	UInt32 time;//
 	UInt32 size;//
-	String encryption;//
+	RpcString encryption;//
 	Int32 blockCount;//
-	PHANTASMA_VECTOR<Int32> missingBlocks;//
-	PHANTASMA_VECTOR<String> owners;//
+	RpcVector<Int32> missingBlocks;//
+	RpcVector<RpcString> owners;//
 };
 
 struct Storage
 {
 	UInt32 available;//
 	UInt32 used;//
-	String avatar;//
-	PHANTASMA_VECTOR<Archive> archives;//
+	RpcString avatar;//
+	RpcVector<Archive> archives;//
 };
 
 struct Account
 {
-	String address;//
-	String name;//
+	RpcString address;//
+	RpcString name;//
 	Stake stakes;//
-	String stake;//
-	String unclaimed;//
-	String relay;//
-	String validator;//
+	RpcString stake;//
+	RpcString unclaimed;//
+	RpcString relay;//
+	RpcString validator;//
 	Storage storage;//
-	PHANTASMA_VECTOR<Balance> balances;//
-	PHANTASMA_VECTOR<String> txs;//
+	RpcVector<Balance> balances;//
+	RpcVector<RpcString> txs;//
 };
 
 struct LeaderboardRow
 {
-	String address;//
-	String value;//
+	RpcString address;//
+	RpcString value;//
 };
 
 struct Leaderboard
 {
-	String name;//
-	PHANTASMA_VECTOR<LeaderboardRow> rows;//
+	RpcString name;//
+	RpcVector<LeaderboardRow> rows;//
 };
 
 struct Dapp
 {
-	String name;//
-	String address;//
-	String chain;//
+	RpcString name;//
+	RpcString address;//
+	RpcString chain;//
 };
 
 struct Chain
 {
-	String name;//
-	String address;//
-	String parent;//
+	RpcString name;//
+	RpcString address;//
+	RpcString parent;//
 	UInt32 height;//
-	String organization;//
-	PHANTASMA_VECTOR<String> contracts;//
-	PHANTASMA_VECTOR<String> dapps;//
+	RpcString organization;//
+	RpcVector<RpcString> contracts;//
+	RpcVector<RpcString> dapps;//
 };
 
 struct Event
 {
-	String address;//
-	String contract;//
-	String kind;//
-	String data;//
+	RpcString address;//
+	RpcString contract;//
+	RpcString kind;//
+	RpcString data;//
 };
 
 struct Oracle
 {
-	String url;//
-	String content;//
+	RpcString url;//
+	RpcString content;//
 };
 
 struct Signature
 {
-	String Kind;//
-	String Data;//
+	RpcString Kind;//
+	RpcString Data;//
 };
 
 struct Transaction
 {
-	String hash;//
-	String chainAddress;//
+	RpcString hash;//
+	RpcString chainAddress;//
 	UInt32 timestamp;//
 	Int32 blockHeight;//
-	String blockHash;//
-	String script;//
-	String payload;//
-	PHANTASMA_VECTOR<Event> events;//
-	String result;//
-	String fee;//
-	PHANTASMA_VECTOR<Signature> signatures;//
+	RpcString blockHash;//
+	RpcString script;//
+	RpcString payload;//
+	RpcVector<Event> events;//
+	RpcString result;//
+	RpcString fee;//
+	RpcVector<Signature> signatures;//
 	UInt32 expiration;//
 };
 
 struct AccountTransactions
 {
-	String address;//
-	PHANTASMA_VECTOR<Transaction> txs;//
+	RpcString address;//
+	RpcVector<Transaction> txs;//
 };
 
 struct Paginated
@@ -827,365 +1252,889 @@ struct Paginated
 
 struct Block
 {
-	String hash;//
-	String previousHash;//
+	RpcString hash;//
+	RpcString previousHash;//
 	UInt32 timestamp;//
 	UInt32 height;//
-	String chainAddress;//
+	RpcString chainAddress;//
 	UInt32 protocol;//
-	PHANTASMA_VECTOR<Transaction> txs;//
-	String validatorAddress;//
-	String reward;//
-	PHANTASMA_VECTOR<Event> events;//
-	PHANTASMA_VECTOR<Oracle> oracles;//
+	RpcVector<Transaction> txs;//
+	RpcString validatorAddress;//
+	RpcString reward;//
+	RpcVector<Event> events;//
+	RpcVector<Oracle> oracles;//
 };
 
 struct ABIParameter
 {
-	String name;//
-	String type;//
+	RpcString name;//
+	RpcString type;//
 };
 
 struct ABIMethod
 {
-	String name;//
-	String returnType;//
-	PHANTASMA_VECTOR<ABIParameter> parameters;//
+	RpcString name;//
+	RpcString returnType;//
+	RpcVector<ABIParameter> parameters;//
 };
 
 struct TokenSeries
 {
 	UInt32 seriesID;//
-	String currentSupply;//
-	String maxSupply;//
+	RpcString currentSupply;//
+	RpcString maxSupply;//
 	TokenSeriesMode mode;//
-	String script;//
-	PHANTASMA_VECTOR<ABIMethod> methods;//
+	RpcString script;//
+	RpcVector<ABIMethod> methods;//
 };
 
 struct Token
 {
-	String symbol;//
-	String name;//
+	RpcString symbol;//
+	RpcString name;//
 	Int32 decimals;//
-	String currentSupply;//
-	String maxSupply;//
-	String address;//
-	String owner;//
-	String flags;//
-	String script;//
-	PHANTASMA_VECTOR<TokenSeries> series;//
+	RpcString currentSupply;//
+	RpcString maxSupply;//
+	RpcString address;//
+	RpcString owner;//
+	RpcString flags;//
+	RpcString script;//
+	RpcVector<TokenSeries> series;//
 };
 
 struct TokenProperty
 {
-	String Key;//
-	String Value;//
+	RpcString Key;//
+	RpcString Value;//
 };
 
 struct TokenData
 {
-	String ID;//
-	String series;//
-	String mint;//
-	String chainName;//
-	String ownerAddress;//
-	String creatorAddress;//
-	String ram;//
-	String rom;//
-	String status;//
-	PHANTASMA_VECTOR<TokenProperty> infusion;//
-	PHANTASMA_VECTOR<TokenProperty> properties;//
+	RpcString ID;//
+	RpcString series;//
+	RpcString mint;//
+	RpcString chainName;//
+	RpcString ownerAddress;//
+	RpcString creatorAddress;//
+	RpcString ram;//
+	RpcString rom;//
+	RpcString status;//
+	RpcVector<TokenProperty> infusion;//
+	RpcVector<TokenProperty> properties;//
 };
 
 struct SendRawTx
 {
-	String hash;//
-	String error;//
+	RpcString hash;//
+	RpcString error;//
 };
 
 struct Auction
 {
-	String creatorAddress;//
-	String chainAddress;//
+	RpcString creatorAddress;//
+	RpcString chainAddress;//
 	UInt32 startDate;//
 	UInt32 endDate;//
-	String baseSymbol;//
-	String quoteSymbol;//
-	String tokenId;//
-	String price;//
-	String rom;//
-	String ram;//
+	RpcString baseSymbol;//
+	RpcString quoteSymbol;//
+	RpcString tokenId;//
+	RpcString price;//
+	RpcString rom;//
+	RpcString ram;//
 };
 
 struct Script
 {
-	PHANTASMA_VECTOR<Event> events;//
-	String result;//
-	PHANTASMA_VECTOR<String> results;//
-	PHANTASMA_VECTOR<Oracle> oracles;//
+	RpcVector<Event> events;//
+	RpcString result;//
+	RpcVector<RpcString> results;//
+	RpcVector<Oracle> oracles;//
 };
 
 struct ABIEvent
 {
 	Int32 value;//
-	String name;//
-	String returnType;//
-	String description;//
+	RpcString name;//
+	RpcString returnType;//
+	RpcString description;//
 };
 
 struct Contract
 {
-	String name;//
-	String address;//
-	String script;//
-	PHANTASMA_VECTOR<ABIMethod> methods;//
-	PHANTASMA_VECTOR<ABIEvent> events;//
+	RpcString name;//
+	RpcString address;//
+	RpcString script;//
+	RpcVector<ABIMethod> methods;//
+	RpcVector<ABIEvent> events;//
 };
 
 struct Channel
 {
-	String creatorAddress;//
-	String targetAddress;//
-	String name;//
-	String chain;//
+	RpcString creatorAddress;//
+	RpcString targetAddress;//
+	RpcString name;//
+	RpcString chain;//
 	UInt32 creationTime;//
-	String symbol;//
-	String fee;//
-	String balance;//
+	RpcString symbol;//
+	RpcString fee;//
+	RpcString balance;//
 	bool active;//
 	Int32 index;//
 };
 
 struct Receipt
 {
-	String nexus;//
-	String channel;//
-	String index;//
+	RpcString nexus;//
+	RpcString channel;//
+	RpcString index;//
 	UInt32 timestamp;//
-	String sender;//
-	String receiver;//
-	String script;//
+	RpcString sender;//
+	RpcString receiver;//
+	RpcString script;//
 };
 
 struct Peer
 {
-	String url;//
-	String version;//
-	String flags;//
-	String fee;//
+	RpcString url;//
+	RpcString version;//
+	RpcString flags;//
+	RpcString fee;//
 	UInt32 pow;//
 };
 
 struct Validator
 {
-	String address;//
-	String type;//
+	RpcString address;//
+	RpcString type;//
 };
 
 struct Swap
 {
-	String sourcePlatform;//
-	String sourceChain;//
-	String sourceHash;//
-	String sourceAddress;//
-	String destinationPlatform;//
-	String destinationChain;//
-	String destinationHash;//
-	String destinationAddress;//
-	String symbol;//
-	String value;//
+	RpcString sourcePlatform;//
+	RpcString sourceChain;//
+	RpcString sourceHash;//
+	RpcString sourceAddress;//
+	RpcString destinationPlatform;//
+	RpcString destinationChain;//
+	RpcString destinationHash;//
+	RpcString destinationAddress;//
+	RpcString symbol;//
+	RpcString value;//
 };
 
 
 //------------------------------------------------------------------------------
-// Low level RPC API:
+// Projections:
 //------------------------------------------------------------------------------
-struct PhantasmaError
-{
-	int code = 0;
-	String message;
+typedef uint64_t FieldMask;
+
+enum class RpcType
+{
+	Balance,
+	Interop,
+	Platform,
+	Governance,
+	Organization,
+	Nexus,
+	Stake,
+	Archive,
+	Storage,
+	Account,
+	LeaderboardRow,
+	Leaderboard,
+	Dapp,
+	Chain,
+	Event,
+	Oracle,
+	Signature,
+	Transaction,
+	AccountTransactions,
+	Paginated,
+	Block,
+	ABIParameter,
+	ABIMethod,
+	TokenSeries,
+	Token,
+	TokenProperty,
+	TokenData,
+	SendRawTx,
+	Auction,
+	Script,
+	ABIEvent,
+	Contract,
+	Channel,
+	Receipt,
+	Peer,
+	Validator,
+	Swap,
+	Count
+};
 
-	const static int InvalidJSON = -1;
-	const static int HttpError = -2;
-	const static int InvalidRpcResponse = -3;
-	const static int RpcMessage = -4;
+// Bit masks for the fields of each RPC structure, e.g. fields::Transaction::hash
+namespace fields
+{
+struct Balance
+{
+	enum Index { chain_index, amount_index, symbol_index, decimals_index, ids_index, Count };
+	enum : FieldMask { chain = FieldMask(1) << chain_index, amount = FieldMask(1) << amount_index, symbol = FieldMask(1) << symbol_index, decimals = FieldMask(1) << decimals_index, ids = FieldMask(1) << ids_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Balance;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("chain"), PHANTASMA_LITERAL("amount"), PHANTASMA_LITERAL("symbol"), PHANTASMA_LITERAL("decimals"), PHANTASMA_LITERAL("ids"), }; return keys; }
 };
-inline void OnHttpError(PhantasmaError& err, const Char* msg)
+struct Interop
 {
-	err.code = PhantasmaError::HttpError; 
-	if( msg )
-		err.message = String(msg);
+	enum Index { local_index, external_index, Count };
+	enum : FieldMask { local = FieldMask(1) << local_index, external = FieldMask(1) << external_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Interop;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("local"), PHANTASMA_LITERAL("external"), }; return keys; }
+};
+struct Platform
+{
+	enum Index { platform_index, chain_index, fuel_index, tokens_index, interop_index, Count };
+	enum : FieldMask { platform = FieldMask(1) << platform_index, chain = FieldMask(1) << chain_index, fuel = FieldMask(1) << fuel_index, tokens = FieldMask(1) << tokens_index, interop = FieldMask(1) << interop_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Platform;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("platform"), PHANTASMA_LITERAL("chain"), PHANTASMA_LITERAL("fuel"), PHANTASMA_LITERAL("tokens"), PHANTASMA_LITERAL("interop"), }; return keys; }
+};
+struct Governance
+{
+	enum Index { name_index, value_index, Count };
+	enum : FieldMask { name = FieldMask(1) << name_index, value = FieldMask(1) << value_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Governance;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("value"), }; return keys; }
+};
+struct Organization
+{
+	enum Index { id_index, name_index, members_index, Count };
+	enum : FieldMask { id = FieldMask(1) << id_index, name = FieldMask(1) << name_index, members = FieldMask(1) << members_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Organization;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("members"), }; return keys; }
+};
+struct Nexus
+{
+	enum Index { name_index, platforms_index, tokens_index, chains_index, governance_index, organizations_index, Count };
+	enum : FieldMask { name = FieldMask(1) << name_index, platforms = FieldMask(1) << platforms_index, tokens = FieldMask(1) << tokens_index, chains = FieldMask(1) << chains_index, governance = FieldMask(1) << governance_index, organizations = FieldMask(1) << organizations_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Nexus;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("platforms"), PHANTASMA_LITERAL("tokens"), PHANTASMA_LITERAL("chains"), PHANTASMA_LITERAL("governance"), PHANTASMA_LITERAL("organizations"), }; return keys; }
+};
+struct Stake
+{
+	enum Index { amount_index, time_index, unclaimed_index, Count };
+	enum : FieldMask { amount = FieldMask(1) << amount_index, time = FieldMask(1) << time_index, unclaimed = FieldMask(1) << unclaimed_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Stake;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("amount"), PHANTASMA_LITERAL("time"), PHANTASMA_LITERAL("unclaimed"), }; return keys; }
+};
+struct Archive
+{
+	enum Index { name_index, hash_index, time_index, size_index, encryption_index, blockCount_index, missingBlocks_index, owners_index, Count };
+	enum : FieldMask { name = FieldMask(1) << name_index, hash = FieldMask(1) << hash_index, time = FieldMask(1) << time_index, size = FieldMask(1) << size_index, encryption = FieldMask(1) << encryption_index, blockCount = FieldMask(1) << blockCount_index, missingBlocks = FieldMask(1) << missingBlocks_index, owners = FieldMask(1) << owners_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Archive;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("hash"), PHANTASMA_LITERAL("time"), PHANTASMA_LITERAL("size"), PHANTASMA_LITERAL("encryption"), PHANTASMA_LITERAL("blockCount"), PHANTASMA_LITERAL("missingBlocks"), PHANTASMA_LITERAL("owners"), }; return keys; }
+};
+struct Storage
+{
+	enum Index { available_index, used_index, avatar_index, archives_index, Count };
+	enum : FieldMask { available = FieldMask(1) << available_index, used = FieldMask(1) << used_index, avatar = FieldMask(1) << avatar_index, archives = FieldMask(1) << archives_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Storage;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("available"), PHANTASMA_LITERAL("used"), PHANTASMA_LITERAL("avatar"), PHANTASMA_LITERAL("archives"), }; return keys; }
+};
+struct Account
+{
+	enum Index { address_index, name_index, stakes_index, stake_index, unclaimed_index, relay_index, validator_index, storage_index, balances_index, txs_index, Count };
+	enum : FieldMask { address = FieldMask(1) << address_index, name = FieldMask(1) << name_index, stakes = FieldMask(1) << stakes_index, stake = FieldMask(1) << stake_index, unclaimed = FieldMask(1) << unclaimed_index, relay = FieldMask(1) << relay_index, validator = FieldMask(1) << validator_index, storage = FieldMask(1) << storage_index, balances = FieldMask(1) << balances_index, txs = FieldMask(1) << txs_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Account;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("address"), PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("stakes"), PHANTASMA_LITERAL("stake"), PHANTASMA_LITERAL("unclaimed"), PHANTASMA_LITERAL("relay"), PHANTASMA_LITERAL("validator"), PHANTASMA_LITERAL("storage"), PHANTASMA_LITERAL("balances"), PHANTASMA_LITERAL("txs"), }; return keys; }
+};
+struct LeaderboardRow
+{
+	enum Index { address_index, value_index, Count };
+	enum : FieldMask { address = FieldMask(1) << address_index, value = FieldMask(1) << value_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::LeaderboardRow;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("address"), PHANTASMA_LITERAL("value"), }; return keys; }
+};
+struct Leaderboard
+{
+	enum Index { name_index, rows_index, Count };
+	enum : FieldMask { name = FieldMask(1) << name_index, rows = FieldMask(1) << rows_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Leaderboard;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("rows"), }; return keys; }
+};
+struct Dapp
+{
+	enum Index { name_index, address_index, chain_index, Count };
+	enum : FieldMask { name = FieldMask(1) << name_index, address = FieldMask(1) << address_index, chain = FieldMask(1) << chain_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Dapp;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("address"), PHANTASMA_LITERAL("chain"), }; return keys; }
+};
+struct Chain
+{
+	enum Index { name_index, address_index, parent_index, height_index, organization_index, contracts_index, dapps_index, Count };
+	enum : FieldMask { name = FieldMask(1) << name_index, address = FieldMask(1) << address_index, parent = FieldMask(1) << parent_index, height = FieldMask(1) << height_index, organization = FieldMask(1) << organization_index, contracts = FieldMask(1) << contracts_index, dapps = FieldMask(1) << dapps_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Chain;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("address"), PHANTASMA_LITERAL("parent"), PHANTASMA_LITERAL("height"), PHANTASMA_LITERAL("organization"), PHANTASMA_LITERAL("contracts"), PHANTASMA_LITERAL("dapps"), }; return keys; }
+};
+struct Event
+{
+	enum Index { address_index, contract_index, kind_index, data_index, Count };
+	enum : FieldMask { address = FieldMask(1) << address_index, contract = FieldMask(1) << contract_index, kind = FieldMask(1) << kind_index, data = FieldMask(1) << data_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Event;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("address"), PHANTASMA_LITERAL("contract"), PHANTASMA_LITERAL("kind"), PHANTASMA_LITERAL("data"), }; return keys; }
+};
+struct Oracle
+{
+	enum Index { url_index, content_index, Count };
+	enum : FieldMask { url = FieldMask(1) << url_index, content = FieldMask(1) << content_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Oracle;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("url"), PHANTASMA_LITERAL("content"), }; return keys; }
+};
+struct Signature
+{
+	enum Index { Kind_index, Data_index, Count };
+	enum : FieldMask { Kind = FieldMask(1) << Kind_index, Data = FieldMask(1) << Data_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Signature;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("Kind"), PHANTASMA_LITERAL("Data"), }; return keys; }
+};
+struct Transaction
+{
+	enum Index { hash_index, chainAddress_index, timestamp_index, blockHeight_index, blockHash_index, script_index, payload_index, events_index, result_index, fee_index, signatures_index, expiration_index, Count };
+	enum : FieldMask { hash = FieldMask(1) << hash_index, chainAddress = FieldMask(1) << chainAddress_index, timestamp = FieldMask(1) << timestamp_index, blockHeight = FieldMask(1) << blockHeight_index, blockHash = FieldMask(1) << blockHash_index, script = FieldMask(1) << script_index, payload = FieldMask(1) << payload_index, events = FieldMask(1) << events_index, result = FieldMask(1) << result_index, fee = FieldMask(1) << fee_index, signatures = FieldMask(1) << signatures_index, expiration = FieldMask(1) << expiration_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Transaction;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("hash"), PHANTASMA_LITERAL("chainAddress"), PHANTASMA_LITERAL("timestamp"), PHANTASMA_LITERAL("blockHeight"), PHANTASMA_LITERAL("blockHash"), PHANTASMA_LITERAL("script"), PHANTASMA_LITERAL("payload"), PHANTASMA_LITERAL("events"), PHANTASMA_LITERAL("result"), PHANTASMA_LITERAL("fee"), PHANTASMA_LITERAL("signatures"), PHANTASMA_LITERAL("expiration"), }; return keys; }
+};
+struct AccountTransactions
+{
+	enum Index { address_index, txs_index, Count };
+	enum : FieldMask { address = FieldMask(1) << address_index, txs = FieldMask(1) << txs_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::AccountTransactions;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("address"), PHANTASMA_LITERAL("txs"), }; return keys; }
+};
+struct Paginated
+{
+	enum Index { page_index, pageSize_index, total_index, totalPages_index, result_index, Count };
+	enum : FieldMask { page = FieldMask(1) << page_index, pageSize = FieldMask(1) << pageSize_index, total = FieldMask(1) << total_index, totalPages = FieldMask(1) << totalPages_index, result = FieldMask(1) << result_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Paginated;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("page"), PHANTASMA_LITERAL("pageSize"), PHANTASMA_LITERAL("total"), PHANTASMA_LITERAL("totalPages"), PHANTASMA_LITERAL("result"), }; return keys; }
+};
+struct Block
+{
+	enum Index { hash_index, previousHash_index, timestamp_index, height_index, chainAddress_index, protocol_index, txs_index, validatorAddress_index, reward_index, events_index, oracles_index, Count };
+	enum : FieldMask { hash = FieldMask(1) << hash_index, previousHash = FieldMask(1) << previousHash_index, timestamp = FieldMask(1) << timestamp_index, height = FieldMask(1) << height_index, chainAddress = FieldMask(1) << chainAddress_index, protocol = FieldMask(1) << protocol_index, txs = FieldMask(1) << txs_index, validatorAddress = FieldMask(1) << validatorAddress_index, reward = FieldMask(1) << reward_index, events = FieldMask(1) << events_index, oracles = FieldMask(1) << oracles_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Block;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("hash"), PHANTASMA_LITERAL("previousHash"), PHANTASMA_LITERAL("timestamp"), PHANTASMA_LITERAL("height"), PHANTASMA_LITERAL("chainAddress"), PHANTASMA_LITERAL("protocol"), PHANTASMA_LITERAL("txs"), PHANTASMA_LITERAL("validatorAddress"), PHANTASMA_LITERAL("reward"), PHANTASMA_LITERAL("events"), PHANTASMA_LITERAL("oracles"), }; return keys; }
+};
+struct ABIParameter
+{
+	enum Index { name_index, type_index, Count };
+	enum : FieldMask { name = FieldMask(1) << name_index, type = FieldMask(1) << type_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::ABIParameter;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("type"), }; return keys; }
+};
+struct ABIMethod
+{
+	enum Index { name_index, returnType_index, parameters_index, Count };
+	enum : FieldMask { name = FieldMask(1) << name_index, returnType = FieldMask(1) << returnType_index, parameters = FieldMask(1) << parameters_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::ABIMethod;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("returnType"), PHANTASMA_LITERAL("parameters"), }; return keys; }
+};
+struct TokenSeries
+{
+	enum Index { seriesID_index, currentSupply_index, maxSupply_index, mode_index, script_index, methods_index, Count };
+	enum : FieldMask { seriesID = FieldMask(1) << seriesID_index, currentSupply = FieldMask(1) << currentSupply_index, maxSupply = FieldMask(1) << maxSupply_index, mode = FieldMask(1) << mode_index, script = FieldMask(1) << script_index, methods = FieldMask(1) << methods_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::TokenSeries;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("seriesID"), PHANTASMA_LITERAL("currentSupply"), PHANTASMA_LITERAL("maxSupply"), PHANTASMA_LITERAL("mode"), PHANTASMA_LITERAL("script"), PHANTASMA_LITERAL("methods"), }; return keys; }
+};
+struct Token
+{
+	enum Index { symbol_index, name_index, decimals_index, currentSupply_index, maxSupply_index, address_index, owner_index, flags_index, script_index, series_index, Count };
+	enum : FieldMask { symbol = FieldMask(1) << symbol_index, name = FieldMask(1) << name_index, decimals = FieldMask(1) << decimals_index, currentSupply = FieldMask(1) << currentSupply_index, maxSupply = FieldMask(1) << maxSupply_index, address = FieldMask(1) << address_index, owner = FieldMask(1) << owner_index, flags = FieldMask(1) << flags_index, script = FieldMask(1) << script_index, series = FieldMask(1) << series_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Token;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("symbol"), PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("decimals"), PHANTASMA_LITERAL("currentSupply"), PHANTASMA_LITERAL("maxSupply"), PHANTASMA_LITERAL("address"), PHANTASMA_LITERAL("owner"), PHANTASMA_LITERAL("flags"), PHANTASMA_LITERAL("script"), PHANTASMA_LITERAL("series"), }; return keys; }
+};
+struct TokenProperty
+{
+	enum Index { Key_index, Value_index, Count };
+	enum : FieldMask { Key = FieldMask(1) << Key_index, Value = FieldMask(1) << Value_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::TokenProperty;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("Key"), PHANTASMA_LITERAL("Value"), }; return keys; }
+};
+struct TokenData
+{
+	enum Index { ID_index, series_index, mint_index, chainName_index, ownerAddress_index, creatorAddress_index, ram_index, rom_index, status_index, infusion_index, properties_index, Count };
+	enum : FieldMask { ID = FieldMask(1) << ID_index, series = FieldMask(1) << series_index, mint = FieldMask(1) << mint_index, chainName = FieldMask(1) << chainName_index, ownerAddress = FieldMask(1) << ownerAddress_index, creatorAddress = FieldMask(1) << creatorAddress_index, ram = FieldMask(1) << ram_index, rom = FieldMask(1) << rom_index, status = FieldMask(1) << status_index, infusion = FieldMask(1) << infusion_index, properties = FieldMask(1) << properties_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::TokenData;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("ID"), PHANTASMA_LITERAL("series"), PHANTASMA_LITERAL("mint"), PHANTASMA_LITERAL("chainName"), PHANTASMA_LITERAL("ownerAddress"), PHANTASMA_LITERAL("creatorAddress"), PHANTASMA_LITERAL("ram"), PHANTASMA_LITERAL("rom"), PHANTASMA_LITERAL("status"), PHANTASMA_LITERAL("infusion"), PHANTASMA_LITERAL("properties"), }; return keys; }
+};
+struct SendRawTx
+{
+	enum Index { hash_index, error_index, Count };
+	enum : FieldMask { hash = FieldMask(1) << hash_index, error = FieldMask(1) << error_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::SendRawTx;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("hash"), PHANTASMA_LITERAL("error"), }; return keys; }
+};
+struct Auction
+{
+	enum Index { creatorAddress_index, chainAddress_index, startDate_index, endDate_index, baseSymbol_index, quoteSymbol_index, tokenId_index, price_index, rom_index, ram_index, Count };
+	enum : FieldMask { creatorAddress = FieldMask(1) << creatorAddress_index, chainAddress = FieldMask(1) << chainAddress_index, startDate = FieldMask(1) << startDate_index, endDate = FieldMask(1) << endDate_index, baseSymbol = FieldMask(1) << baseSymbol_index, quoteSymbol = FieldMask(1) << quoteSymbol_index, tokenId = FieldMask(1) << tokenId_index, price = FieldMask(1) << price_index, rom = FieldMask(1) << rom_index, ram = FieldMask(1) << ram_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Auction;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("creatorAddress"), PHANTASMA_LITERAL("chainAddress"), PHANTASMA_LITERAL("startDate"), PHANTASMA_LITERAL("endDate"), PHANTASMA_LITERAL("baseSymbol"), PHANTASMA_LITERAL("quoteSymbol"), PHANTASMA_LITERAL("tokenId"), PHANTASMA_LITERAL("price"), PHANTASMA_LITERAL("rom"), PHANTASMA_LITERAL("ram"), }; return keys; }
+};
+struct Script
+{
+	enum Index { events_index, result_index, results_index, oracles_index, Count };
+	enum : FieldMask { events = FieldMask(1) << events_index, result = FieldMask(1) << result_index, results = FieldMask(1) << results_index, oracles = FieldMask(1) << oracles_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Script;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("events"), PHANTASMA_LITERAL("result"), PHANTASMA_LITERAL("results"), PHANTASMA_LITERAL("oracles"), }; return keys; }
+};
+struct ABIEvent
+{
+	enum Index { value_index, name_index, returnType_index, description_index, Count };
+	enum : FieldMask { value = FieldMask(1) << value_index, name = FieldMask(1) << name_index, returnType = FieldMask(1) << returnType_index, description = FieldMask(1) << description_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::ABIEvent;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("value"), PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("returnType"), PHANTASMA_LITERAL("description"), }; return keys; }
+};
+struct Contract
+{
+	enum Index { name_index, address_index, script_index, methods_index, events_index, Count };
+	enum : FieldMask { name = FieldMask(1) << name_index, address = FieldMask(1) << address_index, script = FieldMask(1) << script_index, methods = FieldMask(1) << methods_index, events = FieldMask(1) << events_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Contract;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("address"), PHANTASMA_LITERAL("script"), PHANTASMA_LITERAL("methods"), PHANTASMA_LITERAL("events"), }; return keys; }
+};
+struct Channel
+{
+	enum Index { creatorAddress_index, targetAddress_index, name_index, chain_index, creationTime_index, symbol_index, fee_index, balance_index, active_index, index_index, Count };
+	enum : FieldMask { creatorAddress = FieldMask(1) << creatorAddress_index, targetAddress = FieldMask(1) << targetAddress_index, name = FieldMask(1) << name_index, chain = FieldMask(1) << chain_index, creationTime = FieldMask(1) << creationTime_index, symbol = FieldMask(1) << symbol_index, fee = FieldMask(1) << fee_index, balance = FieldMask(1) << balance_index, active = FieldMask(1) << active_index, index = FieldMask(1) << index_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Channel;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("creatorAddress"), PHANTASMA_LITERAL("targetAddress"), PHANTASMA_LITERAL("name"), PHANTASMA_LITERAL("chain"), PHANTASMA_LITERAL("creationTime"), PHANTASMA_LITERAL("symbol"), PHANTASMA_LITERAL("fee"), PHANTASMA_LITERAL("balance"), PHANTASMA_LITERAL("active"), PHANTASMA_LITERAL("index"), }; return keys; }
+};
+struct Receipt
+{
+	enum Index { nexus_index, channel_index, index_index, timestamp_index, sender_index, receiver_index, script_index, Count };
+	enum : FieldMask { nexus = FieldMask(1) << nexus_index, channel = FieldMask(1) << channel_index, index = FieldMask(1) << index_index, timestamp = FieldMask(1) << timestamp_index, sender = FieldMask(1) << sender_index, receiver = FieldMask(1) << receiver_index, script = FieldMask(1) << script_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Receipt;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("nexus"), PHANTASMA_LITERAL("channel"), PHANTASMA_LITERAL("index"), PHANTASMA_LITERAL("timestamp"), PHANTASMA_LITERAL("sender"), PHANTASMA_LITERAL("receiver"), PHANTASMA_LITERAL("script"), }; return keys; }
+};
+struct Peer
+{
+	enum Index { url_index, version_index, flags_index, fee_index, pow_index, Count };
+	enum : FieldMask { url = FieldMask(1) << url_index, version = FieldMask(1) << version_index, flags = FieldMask(1) << flags_index, fee = FieldMask(1) << fee_index, pow = FieldMask(1) << pow_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Peer;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("url"), PHANTASMA_LITERAL("version"), PHANTASMA_LITERAL("flags"), PHANTASMA_LITERAL("fee"), PHANTASMA_LITERAL("pow"), }; return keys; }
+};
+struct Validator
+{
+	enum Index { address_index, type_index, Count };
+	enum : FieldMask { address = FieldMask(1) << address_index, type = FieldMask(1) << type_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Validator;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("address"), PHANTASMA_LITERAL("type"), }; return keys; }
+};
+struct Swap
+{
+	enum Index { sourcePlatform_index, sourceChain_index, sourceHash_index, sourceAddress_index, destinationPlatform_index, destinationChain_index, destinationHash_index, destinationAddress_index, symbol_index, value_index, Count };
+	enum : FieldMask { sourcePlatform = FieldMask(1) << sourcePlatform_index, sourceChain = FieldMask(1) << sourceChain_index, sourceHash = FieldMask(1) << sourceHash_index, sourceAddress = FieldMask(1) << sourceAddress_index, destinationPlatform = FieldMask(1) << destinationPlatform_index, destinationChain = FieldMask(1) << destinationChain_index, destinationHash = FieldMask(1) << destinationHash_index, destinationAddress = FieldMask(1) << destinationAddress_index, symbol = FieldMask(1) << symbol_index, value = FieldMask(1) << value_index, All = ~FieldMask(0) };
+	constexpr static RpcType rpcType = RpcType::Swap;
+	static const Char* const* Keys() { static const Char* const keys[] = { PHANTASMA_LITERAL("sourcePlatform"), PHANTASMA_LITERAL("sourceChain"), PHANTASMA_LITERAL("sourceHash"), PHANTASMA_LITERAL("sourceAddress"), PHANTASMA_LITERAL("destinationPlatform"), PHANTASMA_LITERAL("destinationChain"), PHANTASMA_LITERAL("destinationHash"), PHANTASMA_LITERAL("destinationAddress"), PHANTASMA_LITERAL("symbol"), PHANTASMA_LITERAL("value"), }; return keys; }
+};
 }
 
-class PhantasmaJsonAPI
+// Selects the fields that are deserialized for each type of RPC structure.
+//  All fields are selected by default. Fields that are not selected are never
+//  looked up in the JSON, and are left empty / zero.
+class RpcProjection
 {
 public:
-	static const Char* Uri() { return PHANTASMA_LITERAL("/rpc"); }
+	RpcProjection() { for( FieldMask& mask : m_masks ) mask = ~FieldMask(0); }
+
+	template<class Fields> RpcProjection& Select(FieldMask mask) { m_masks[(int)Fields::rpcType] = mask; return *this; }
+	FieldMask Mask(RpcType type) const { return m_masks[(int)type]; }
+private:
+	FieldMask m_masks[(int)RpcType::Count];
+};
+
+//------------------------------------------------------------------------------
+// Lazy RPC structures:
+//------------------------------------------------------------------------------
+// A nested array that is kept as an unparsed JSON value, and only deserialized
+//  when it is first accessed. The JSON document must outlive this object.
+template<class T> class LazyArray
+{
+public:
+	typedef T (*Deserializer)(const JSONValue&, bool& jsonError, const RpcProjection* projection);
+
+	LazyArray() {}
+	LazyArray(const JSONValue& array, Deserializer deserialize, const RpcProjection* projection)
+		: m_json(array)
+		, m_deserialize(deserialize)
+		, m_projection(projection)
+	{}
+
+	bool Loaded() const { return !m_deserialize; }
+	// The JSON array could not be deserialized
+	bool Failed() const { return m_failed; }
+
+	// Number of elements, without deserializing them
+	int Size(bool& jsonError) const
+	{
+		if( Loaded() )
+			return (int)m_items.size();
+		return json::ArraySize(json::AsArray(m_json.Get(), jsonError), jsonError);
+	}
+
+	// Deserializes the elements on the first call. If the JSON is malformed, the
+	//  result is empty and jsonError is set, on this call and every later one.
+	const RpcVector<T>& Get(bool& jsonError) const
+	{
+		if( m_failed )
+			jsonError = true;
+		if( Loaded() || m_failed )
+			return m_items;
+		bool error = false;
+		const JSONArray& array = json::AsArray(m_json.Get(), error);
+		m_items.reserve(json::ArraySize(array, error));
+		for(JSONArrayCursor it = json::ArrayBegin(array, error); json::ArrayValid(it, error); json::ArrayNext(it, error))
+		{
+			m_items.push_back(m_deserialize(json::ArrayValue(it, error), error, m_projection));
+		}
+		if( error )
+		{
+			m_items.clear();
+			m_failed = true;
+			jsonError = true;
+			return m_items;
+		}
+		m_deserialize = nullptr;
+		return m_items;
+	}
+	// As above, but the error is reported with PHANTASMA_EXCEPTION, or by Failed()
+	const RpcVector<T>& Get() const
+	{
+		bool jsonError = false;
+		const RpcVector<T>& items = Get(jsonError);
+		if( jsonError )
+		{
+			PHANTASMA_EXCEPTION("Malformed JSON in a lazy array");
+		}
+		return items;
+	}
+private:
+	json::JSONSlot       m_json;
+	mutable Deserializer m_deserialize = nullptr;
+	const RpcProjection* m_projection = nullptr;
+	mutable RpcVector<T> m_items{PHANTASMA_RPC_ALLOC};
+	mutable bool         m_failed = false;
+};
+
+// As Transaction, but events and signatures are deserialized on first access
+struct LazyTransaction
+{
+	RpcString hash;
+	RpcString chainAddress;
+	UInt32 timestamp;
+	Int32 blockHeight;
+	RpcString blockHash;
+	RpcString script;
+	RpcString payload;
+	LazyArray<Event> events;
+	RpcString result;
+	RpcString fee;
+	LazyArray<Signature> signatures;
+	UInt32 expiration;
+};
+
+// As Block, but txs, events and oracles are deserialized on first access
+struct LazyBlock
+{
+	RpcString hash;
+	RpcString previousHash;
+	UInt32 timestamp;
+	UInt32 height;
+	RpcString chainAddress;
+	UInt32 protocol;
+	LazyArray<LazyTransaction> txs;
+	RpcString validatorAddress;
+	RpcString reward;
+	LazyArray<Event> events;
+	LazyArray<Oracle> oracles;
+};
+
+//------------------------------------------------------------------------------
+// Low level RPC API:
+//------------------------------------------------------------------------------
+struct PhantasmaError
+{
+	int code = 0;
+	String message;
+
+	const static int InvalidJSON = -1;
+	const static int HttpError = -2;
+	const static int InvalidRpcResponse = -3;
+	const static int RpcMessage = -4;
+};
+inline void OnHttpError(PhantasmaError& err, const Char* msg)
+{
+	err.code = PhantasmaError::HttpError; 
+	if( msg )
+		err.message = String(msg);
+}
+// True for errors that indicate a problem with the node or the connection to it, rather than a response from it,
+//  so the request may succeed if it is sent again, or to another node
+inline bool IsTransientError(const PhantasmaError& err)
+{
+	return err.code == PhantasmaError::HttpError
+	    || err.code == PhantasmaError::InvalidJSON
+	    || err.code == PhantasmaError::InvalidRpcResponse;
+}
+
+class RpcBatch // Queues requests to be sent as JSON-RPC 2.0 batches, see PhantasmaAPI::Send
+{
+public:
+	RpcBatch(int maxSize = 100, const RpcProjection* projection = 0)
+		: m_maxSize(maxSize > 0 ? maxSize : 1)
+		, m_projection(projection)
+	{}
+
+	// Queues a request that is made by a PhantasmaJsonAPI::Make*Request function and whose response is parsed into
+	//  output by the matching Parse*Response function. The arguments, output and error must outlive the batch.
+	template<class Output, class... Params, class... Args>
+	void Add(void(*make)(JSONBuilder&, Params...), bool(*parse)(const JSONValue&, Output&, PhantasmaError*, const RpcProjection*), 
+	         Output& output, PhantasmaError* out_error, Args... args)
+	{
+		const RpcProjection* projection = m_projection;
+		Request request;
+		request.make  = [=](JSONBuilder& builder, const Char* id) { make(builder, args..., id); };
+		request.parse = [=, &output](const JSONValue& response, PhantasmaError* err) { parse(response, output, err, projection); };
+		request.error = out_error;
+		m_requests.push_back(std::move(request));
+	}
+
+	int  Size()    const { return (int)m_requests.size(); }
+	int  MaxSize() const { return m_maxSize; }
+	int  Batches() const { return (Size() + m_maxSize - 1) / m_maxSize; }
+	int  Begin(int batchIndex) const { return batchIndex * m_maxSize; }
+	int  End(  int batchIndex) const { return PHANTASMA_MIN(Begin(batchIndex) + m_maxSize, Size()); }
+	void Clear()         { m_requests.clear(); }
+
+	// Reports an error to every request within a batch, e.g. when its HTTP request failed
+	void Fail(int batchIndex, const PhantasmaError& error)
+	{
+		for( int i = Begin(batchIndex), end = End(batchIndex); i != end; ++i )
+			if( m_requests[i].error )
+				*m_requests[i].error = error;
+	}
+private:
+	friend class PhantasmaJsonAPI;
+	struct Request
+	{
+		std::function<void(JSONBuilder&, const Char* id)> make;
+		std::function<void(const JSONValue&, PhantasmaError*)> parse;
+		PhantasmaError* error = 0;
+		bool parsed = false;
+	};
+	PHANTASMA_VECTOR<Request> m_requests;
+	int m_maxSize;
+	const RpcProjection* m_projection;
+
+	constexpr static int IdLength = 12;
+	static const Char* FormatId(Char (&buffer)[IdLength], int index)
+	{
+		Char* c = buffer + IdLength - 1;
+		*c = 0;
+		do { *--c = (Char)('0' + index % 10); index /= 10; } while( index );
+		return c;
+	}
+	static int ParseId(const String& id)
+	{
+		if( id.empty() || id.length() >= IdLength )
+			return -1;
+		int index = 0;
+		for( Char c : id )
+		{
+			if( c < '0' || c > '9' )
+				return -1;
+			index = index * 10 + (c - '0');
+		}
+		return index;
+	}
+};
+
+class PhantasmaJsonAPI
+{
+public:
+	static const Char* Uri() { return PHANTASMA_LITERAL("/rpc"); }
 
 	// Returns the account name and balance of given address. 
-	static void MakeGetAccountRequest(JSONBuilder&, const Char* account);
-	static bool ParseGetAccountResponse(const JSONValue&, Account& out, PhantasmaError* err=0);
+	static void MakeGetAccountRequest(JSONBuilder&, const Char* account, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetAccountResponse(const JSONValue&, Account& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns the address that owns a given name. 
-	static void MakeLookUpNameRequest(JSONBuilder&, const Char* name);
-	static bool ParseLookUpNameResponse(const JSONValue&, String& out, PhantasmaError* err=0);
+	static void MakeLookUpNameRequest(JSONBuilder&, const Char* name, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseLookUpNameResponse(const JSONValue&, String& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns the height of a chain. 
-	static void MakeGetBlockHeightRequest(JSONBuilder&, const Char* chainInput);
-	static bool ParseGetBlockHeightResponse(const JSONValue&, Int32& out, PhantasmaError* err=0);
+	static void MakeGetBlockHeightRequest(JSONBuilder&, const Char* chainInput, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetBlockHeightResponse(const JSONValue&, Int32& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns the number of transactions of given block hash or error if given hash is invalid or is not found. 
-	static void MakeGetBlockTransactionCountByHashRequest(JSONBuilder&, const Char* blockHash);
-	static bool ParseGetBlockTransactionCountByHashResponse(const JSONValue&, Int32& out, PhantasmaError* err=0);
+	static void MakeGetBlockTransactionCountByHashRequest(JSONBuilder&, const Char* blockHash, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetBlockTransactionCountByHashResponse(const JSONValue&, Int32& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns information about a block by hash. 
-	static void MakeGetBlockByHashRequest(JSONBuilder&, const Char* blockHash);
-	static bool ParseGetBlockByHashResponse(const JSONValue&, Block& out, PhantasmaError* err=0);
+	static void MakeGetBlockByHashRequest(JSONBuilder&, const Char* blockHash, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetBlockByHashResponse(const JSONValue&, Block& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns a serialized string, containing information about a block by hash. 
-	static void MakeGetRawBlockByHashRequest(JSONBuilder&, const Char* blockHash);
-	static bool ParseGetRawBlockByHashResponse(const JSONValue&, String& out, PhantasmaError* err=0);
+	static void MakeGetRawBlockByHashRequest(JSONBuilder&, const Char* blockHash, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetRawBlockByHashResponse(const JSONValue&, String& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns information about a block by height and chain. 
-	static void MakeGetBlockByHeightRequest(JSONBuilder&, const Char* chainInput, UInt32 height);
-	static bool ParseGetBlockByHeightResponse(const JSONValue&, Block& out, PhantasmaError* err=0);
+	static void MakeGetBlockByHeightRequest(JSONBuilder&, const Char* chainInput, UInt32 height, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetBlockByHeightResponse(const JSONValue&, Block& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns a serialized string, in hex format, containing information about a block by height and chain. 
-	static void MakeGetRawBlockByHeightRequest(JSONBuilder&, const Char* chainInput, UInt32 height);
-	static bool ParseGetRawBlockByHeightResponse(const JSONValue&, String& out, PhantasmaError* err=0);
+	static void MakeGetRawBlockByHeightRequest(JSONBuilder&, const Char* chainInput, UInt32 height, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetRawBlockByHeightResponse(const JSONValue&, String& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns the information about a transaction requested by a block hash and transaction index. 
-	static void MakeGetTransactionByBlockHashAndIndexRequest(JSONBuilder&, const Char* blockHash, Int32 index);
-	static bool ParseGetTransactionByBlockHashAndIndexResponse(const JSONValue&, Transaction& out, PhantasmaError* err=0);
+	static void MakeGetTransactionByBlockHashAndIndexRequest(JSONBuilder&, const Char* blockHash, Int32 index, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetTransactionByBlockHashAndIndexResponse(const JSONValue&, Transaction& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns last X transactions of given address. (paginated call)
-	static void MakeGetAddressTransactionsRequest(JSONBuilder&, const Char* account, UInt32 page, UInt32 pageSize);
-	static bool ParseGetAddressTransactionsResponse(const JSONValue&, AccountTransactions& out, PhantasmaError* err=0);
+	static void MakeGetAddressTransactionsRequest(JSONBuilder&, const Char* account, UInt32 page, UInt32 pageSize, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetAddressTransactionsResponse(const JSONValue&, AccountTransactions& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Get number of transactions in a specific address and chain 
-	static void MakeGetAddressTransactionCountRequest(JSONBuilder&, const Char* account, const Char* chainInput);
-	static bool ParseGetAddressTransactionCountResponse(const JSONValue&, Int32& out, PhantasmaError* err=0);
+	static void MakeGetAddressTransactionCountRequest(JSONBuilder&, const Char* account, const Char* chainInput, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetAddressTransactionCountResponse(const JSONValue&, Int32& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Allows to broadcast a signed operation on the network, but it&apos;s required to build it manually. 
-	static void MakeSendRawTransactionRequest(JSONBuilder&, const Char* txData);
-	static bool ParseSendRawTransactionResponse(const JSONValue&, String& out, PhantasmaError* err=0);
+	static void MakeSendRawTransactionRequest(JSONBuilder&, const Char* txData, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseSendRawTransactionResponse(const JSONValue&, String& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Allows to invoke script based on network state, without state changes. 
-	static void MakeInvokeRawScriptRequest(JSONBuilder&, const Char* chainInput, const Char* scriptData);
-	static bool ParseInvokeRawScriptResponse(const JSONValue&, Script& out, PhantasmaError* err=0);
+	static void MakeInvokeRawScriptRequest(JSONBuilder&, const Char* chainInput, const Char* scriptData, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseInvokeRawScriptResponse(const JSONValue&, Script& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns information about a transaction by hash. 
-	static void MakeGetTransactionRequest(JSONBuilder&, const Char* hashText);
-	static bool ParseGetTransactionResponse(const JSONValue&, Transaction& out, PhantasmaError* err=0);
+	static void MakeGetTransactionRequest(JSONBuilder&, const Char* hashText, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetTransactionResponse(const JSONValue&, Transaction& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Removes a pending transaction from the mempool. 
-	static void MakeCancelTransactionRequest(JSONBuilder&, const Char* hashText);
-	static bool ParseCancelTransactionResponse(const JSONValue&, String& out, PhantasmaError* err=0);
+	static void MakeCancelTransactionRequest(JSONBuilder&, const Char* hashText, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseCancelTransactionResponse(const JSONValue&, String& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns an array of all chains deployed in Phantasma. 
-	static void MakeGetChainsRequest(JSONBuilder&);
-	static bool ParseGetChainsResponse(const JSONValue&, PHANTASMA_VECTOR<Chain>& out, PhantasmaError* err=0);
+	static void MakeGetChainsRequest(JSONBuilder&, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetChainsResponse(const JSONValue&, PHANTASMA_VECTOR<Chain>& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns info about the nexus. 
-	static void MakeGetNexusRequest(JSONBuilder&, bool extended);
-	static bool ParseGetNexusResponse(const JSONValue&, Nexus& out, PhantasmaError* err=0);
+	static void MakeGetNexusRequest(JSONBuilder&, bool extended, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetNexusResponse(const JSONValue&, Nexus& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns info about an organization. 
-	static void MakeGetOrganizationRequest(JSONBuilder&, const Char* ID);
-	static bool ParseGetOrganizationResponse(const JSONValue&, Organization& out, PhantasmaError* err=0);
+	static void MakeGetOrganizationRequest(JSONBuilder&, const Char* ID, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetOrganizationResponse(const JSONValue&, Organization& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns content of a Phantasma leaderboard. 
-	static void MakeGetLeaderboardRequest(JSONBuilder&, const Char* name);
-	static bool ParseGetLeaderboardResponse(const JSONValue&, Leaderboard& out, PhantasmaError* err=0);
+	static void MakeGetLeaderboardRequest(JSONBuilder&, const Char* name, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetLeaderboardResponse(const JSONValue&, Leaderboard& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns an array of tokens deployed in Phantasma. 
-	static void MakeGetTokensRequest(JSONBuilder&, bool extended);
-	static bool ParseGetTokensResponse(const JSONValue&, PHANTASMA_VECTOR<Token>& out, PhantasmaError* err=0);
+	static void MakeGetTokensRequest(JSONBuilder&, bool extended, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetTokensResponse(const JSONValue&, PHANTASMA_VECTOR<Token>& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns info about a specific token deployed in Phantasma. 
-	static void MakeGetTokenRequest(JSONBuilder&, const Char* symbol, bool extended);
-	static bool ParseGetTokenResponse(const JSONValue&, Token& out, PhantasmaError* err=0);
+	static void MakeGetTokenRequest(JSONBuilder&, const Char* symbol, bool extended, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetTokenResponse(const JSONValue&, Token& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns data of a non-fungible token, in hexadecimal format. 
-	static void MakeGetTokenDataRequest(JSONBuilder&, const Char* symbol, const Char* IDtext);
-	static bool ParseGetTokenDataResponse(const JSONValue&, TokenData& out, PhantasmaError* err=0);
+	static void MakeGetTokenDataRequest(JSONBuilder&, const Char* symbol, const Char* IDtext, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetTokenDataResponse(const JSONValue&, TokenData& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns data of a non-fungible token, in hexadecimal format. 
-	static void MakeGetNFTRequest(JSONBuilder&, const Char* symbol, const Char* IDtext, bool extended);
-	static bool ParseGetNFTResponse(const JSONValue&, TokenData& out, PhantasmaError* err=0);
+	static void MakeGetNFTRequest(JSONBuilder&, const Char* symbol, const Char* IDtext, bool extended, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetNFTResponse(const JSONValue&, TokenData& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns the balance for a specific token and chain, given an address. 
-	static void MakeGetTokenBalanceRequest(JSONBuilder&, const Char* account, const Char* tokenSymbol, const Char* chainInput);
-	static bool ParseGetTokenBalanceResponse(const JSONValue&, Balance& out, PhantasmaError* err=0);
+	static void MakeGetTokenBalanceRequest(JSONBuilder&, const Char* account, const Char* tokenSymbol, const Char* chainInput, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetTokenBalanceResponse(const JSONValue&, Balance& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns the number of active auctions. 
-	static void MakeGetAuctionsCountRequest(JSONBuilder&, const Char* chainAddressOrName, const Char* symbol);
-	static bool ParseGetAuctionsCountResponse(const JSONValue&, Int32& out, PhantasmaError* err=0);
+	static void MakeGetAuctionsCountRequest(JSONBuilder&, const Char* chainAddressOrName, const Char* symbol, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetAuctionsCountResponse(const JSONValue&, Int32& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns the auctions available in the market. (paginated call)
-	static void MakeGetAuctionsRequest(JSONBuilder&, const Char* chainAddressOrName, const Char* symbol, UInt32 page, UInt32 pageSize);
-	static bool ParseGetAuctionsResponse(const JSONValue&, PHANTASMA_VECTOR<Auction>& out, PhantasmaError* err=0);
+	static void MakeGetAuctionsRequest(JSONBuilder&, const Char* chainAddressOrName, const Char* symbol, UInt32 page, UInt32 pageSize, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetAuctionsResponse(const JSONValue&, PHANTASMA_VECTOR<Auction>& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns the auction for a specific token. 
-	static void MakeGetAuctionRequest(JSONBuilder&, const Char* chainAddressOrName, const Char* symbol, const Char* IDtext);
-	static bool ParseGetAuctionResponse(const JSONValue&, Auction& out, PhantasmaError* err=0);
+	static void MakeGetAuctionRequest(JSONBuilder&, const Char* chainAddressOrName, const Char* symbol, const Char* IDtext, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetAuctionResponse(const JSONValue&, Auction& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns info about a specific archive. 
-	static void MakeGetArchiveRequest(JSONBuilder&, const Char* hashText);
-	static bool ParseGetArchiveResponse(const JSONValue&, Archive& out, PhantasmaError* err=0);
+	static void MakeGetArchiveRequest(JSONBuilder&, const Char* hashText, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetArchiveResponse(const JSONValue&, Archive& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Writes the contents of an incomplete archive. 
-	static void MakeWriteArchiveRequest(JSONBuilder&, const Char* hashText, Int32 blockIndex, const Char* blockContent);
-	static bool ParseWriteArchiveResponse(const JSONValue&, bool& out, PhantasmaError* err=0);
+	static void MakeWriteArchiveRequest(JSONBuilder&, const Char* hashText, Int32 blockIndex, const Char* blockContent, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseWriteArchiveResponse(const JSONValue&, bool& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Reads given archive block. 
-	static void MakeReadArchiveRequest(JSONBuilder&, const Char* hashText, Int32 blockIndex);
-	static bool ParseReadArchiveResponse(const JSONValue&, String& out, PhantasmaError* err=0);
+	static void MakeReadArchiveRequest(JSONBuilder&, const Char* hashText, Int32 blockIndex, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseReadArchiveResponse(const JSONValue&, String& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns the ABI interface of specific contract. 
-	static void MakeGetContractRequest(JSONBuilder&, const Char* chainAddressOrName, const Char* contractName);
-	static bool ParseGetContractResponse(const JSONValue&, Contract& out, PhantasmaError* err=0);
+	static void MakeGetContractRequest(JSONBuilder&, const Char* chainAddressOrName, const Char* contractName, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetContractResponse(const JSONValue&, Contract& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns list of known peers. 
-	static void MakeGetPeersRequest(JSONBuilder&);
-	static bool ParseGetPeersResponse(const JSONValue&, PHANTASMA_VECTOR<Peer>& out, PhantasmaError* err=0);
+	static void MakeGetPeersRequest(JSONBuilder&, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetPeersResponse(const JSONValue&, PHANTASMA_VECTOR<Peer>& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Writes a message to the relay network. 
-	static void MakeRelaySendRequest(JSONBuilder&, const Char* receiptHex);
-	static bool ParseRelaySendResponse(const JSONValue&, bool& out, PhantasmaError* err=0);
+	static void MakeRelaySendRequest(JSONBuilder&, const Char* receiptHex, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseRelaySendResponse(const JSONValue&, bool& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Receives messages from the relay network. 
-	static void MakeRelayReceiveRequest(JSONBuilder&, const Char* account);
-	static bool ParseRelayReceiveResponse(const JSONValue&, PHANTASMA_VECTOR<Receipt>& out, PhantasmaError* err=0);
+	static void MakeRelayReceiveRequest(JSONBuilder&, const Char* account, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseRelayReceiveResponse(const JSONValue&, PHANTASMA_VECTOR<Receipt>& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Reads pending messages from the relay network. 
-	static void MakeGetEventsRequest(JSONBuilder&, const Char* account);
-	static bool ParseGetEventsResponse(const JSONValue&, PHANTASMA_VECTOR<Event>& out, PhantasmaError* err=0);
+	static void MakeGetEventsRequest(JSONBuilder&, const Char* account, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetEventsResponse(const JSONValue&, PHANTASMA_VECTOR<Event>& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns an array of available interop platforms. 
-	static void MakeGetPlatformsRequest(JSONBuilder&);
-	static bool ParseGetPlatformsResponse(const JSONValue&, PHANTASMA_VECTOR<Platform>& out, PhantasmaError* err=0);
+	static void MakeGetPlatformsRequest(JSONBuilder&, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetPlatformsResponse(const JSONValue&, PHANTASMA_VECTOR<Platform>& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns an array of available validators. 
-	static void MakeGetValidatorsRequest(JSONBuilder&);
-	static bool ParseGetValidatorsResponse(const JSONValue&, PHANTASMA_VECTOR<Validator>& out, PhantasmaError* err=0);
+	static void MakeGetValidatorsRequest(JSONBuilder&, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetValidatorsResponse(const JSONValue&, PHANTASMA_VECTOR<Validator>& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Tries to settle a pending swap for a specific hash. 
-	static void MakeSettleSwapRequest(JSONBuilder&, const Char* sourcePlatform, const Char* destPlatform, const Char* hashText);
-	static bool ParseSettleSwapResponse(const JSONValue&, String& out, PhantasmaError* err=0);
+	static void MakeSettleSwapRequest(JSONBuilder&, const Char* sourcePlatform, const Char* destPlatform, const Char* hashText, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseSettleSwapResponse(const JSONValue&, String& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	// Returns platform swaps for a specific address. 
-	static void MakeGetSwapsForAddressRequest(JSONBuilder&, const Char* account);
-	static bool ParseGetSwapsForAddressResponse(const JSONValue&, PHANTASMA_VECTOR<Swap>& out, PhantasmaError* err=0);
+	static void MakeGetSwapsForAddressRequest(JSONBuilder&, const Char* account, const Char* id=PHANTASMA_LITERAL("1"));
+	static bool ParseGetSwapsForAddressResponse(const JSONValue&, PHANTASMA_VECTOR<Swap>& out, PhantasmaError* err=0, const RpcProjection* projection=0);
 	
 
-//private:
+	// Lazy variants of the responses that return a Block or Transaction, e.g. GetBlockByHeight or GetTransaction
+	static bool ParseLazyResponse(const JSONValue&, LazyBlock& out, PhantasmaError* err=0, const RpcProjection* projection=0);
+	static bool ParseLazyResponse(const JSONValue&, LazyTransaction& out, PhantasmaError* err=0, const RpcProjection* projection=0);
+
+	// The requests of one JSON-RPC 2.0 batch, in [0, batch.Batches()), and the routing of its response to each request's output
+	static void MakeBatchRequest(JSONBuilder&, const RpcBatch& batch, int batchIndex);
+	static bool ParseBatchResponse(const JSONValue&, RpcBatch& batch, int batchIndex, PhantasmaError* err=0);
+
+	// Reports the RPC error of a response, or returns its result. ParsePageInfo (Utils/PaginatedFetcher.h) uses it.
 	static JSONValue CheckResponse(JSONValue response, PhantasmaError& out_error);
-	static TokenSeriesMode DeserializeTokenSeriesMode(const JSONValue& json, bool& jsonError);
-	static Int32 DeserializeInt32(const JSONValue& json, bool& jsonError);
-	static Balance DeserializeBalance(const JSONValue& json, bool& jsonError);
-	static Interop DeserializeInterop(const JSONValue& json, bool& jsonError);
-	static Platform DeserializePlatform(const JSONValue& json, bool& jsonError);
-	static Governance DeserializeGovernance(const JSONValue& json, bool& jsonError);
-	static Organization DeserializeOrganization(const JSONValue& json, bool& jsonError);
-	static Nexus DeserializeNexus(const JSONValue& json, bool& jsonError);
-	static Stake DeserializeStake(const JSONValue& json, bool& jsonError);
-	static Storage DeserializeStorage(const JSONValue& json, bool& jsonError);
-	static Account DeserializeAccount(const JSONValue& json, bool& jsonError);
-	static LeaderboardRow DeserializeLeaderboardRow(const JSONValue& json, bool& jsonError);
-	static Leaderboard DeserializeLeaderboard(const JSONValue& json, bool& jsonError);
-	static Dapp DeserializeDapp(const JSONValue& json, bool& jsonError);
-	static Chain DeserializeChain(const JSONValue& json, bool& jsonError);
-	static Event DeserializeEvent(const JSONValue& json, bool& jsonError);
-	static Oracle DeserializeOracle(const JSONValue& json, bool& jsonError);
-	static Signature DeserializeSignature(const JSONValue& json, bool& jsonError);
-	static Transaction DeserializeTransaction(const JSONValue& json, bool& jsonError);
-	static AccountTransactions DeserializeAccountTransactions(const JSONValue& json, bool& jsonError);
-	static Paginated DeserializePaginated(const JSONValue& json, bool& jsonError);
-	static Block DeserializeBlock(const JSONValue& json, bool& jsonError);
-	static Token DeserializeToken(const JSONValue& json, bool& jsonError);
-	static TokenSeries DeserializeTokenSeries(const JSONValue& json, bool& jsonError);
-	static TokenProperty DeserializeTokenProperty(const JSONValue& json, bool& jsonError);
-	static TokenData DeserializeTokenData(const JSONValue& json, bool& jsonError);
-	static SendRawTx DeserializeSendRawTx(const JSONValue& json, bool& jsonError);
-	static Auction DeserializeAuction(const JSONValue& json, bool& jsonError);
-	static Script DeserializeScript(const JSONValue& json, bool& jsonError);
-	static Archive DeserializeArchive(const JSONValue& json, bool& jsonError);
-	static ABIParameter DeserializeABIParameter(const JSONValue& json, bool& jsonError);
-	static ABIMethod DeserializeABIMethod(const JSONValue& json, bool& jsonError);
-	static ABIEvent DeserializeABIEvent(const JSONValue& json, bool& jsonError);
-	static Contract DeserializeContract(const JSONValue& json, bool& jsonError);
-	static Channel DeserializeChannel(const JSONValue& json, bool& jsonError);
-	static Receipt DeserializeReceipt(const JSONValue& json, bool& jsonError);
-	static Peer DeserializePeer(const JSONValue& json, bool& jsonError);
-	static Validator DeserializeValidator(const JSONValue& json, bool& jsonError);
-	static Swap DeserializeSwap(const JSONValue& json, bool& jsonError);
+
+private:
+	friend class RpcStreamParser; // deserializes each streamed transaction and event (Utils/RpcStream.h)
+	static TokenSeriesMode DeserializeTokenSeriesMode(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Int32 DeserializeInt32(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Balance DeserializeBalance(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Interop DeserializeInterop(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Platform DeserializePlatform(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Governance DeserializeGovernance(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Organization DeserializeOrganization(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Nexus DeserializeNexus(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Stake DeserializeStake(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Storage DeserializeStorage(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Account DeserializeAccount(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static LeaderboardRow DeserializeLeaderboardRow(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Leaderboard DeserializeLeaderboard(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Dapp DeserializeDapp(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Chain DeserializeChain(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Event DeserializeEvent(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Oracle DeserializeOracle(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Signature DeserializeSignature(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Transaction DeserializeTransaction(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static AccountTransactions DeserializeAccountTransactions(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Paginated DeserializePaginated(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Block DeserializeBlock(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Token DeserializeToken(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static TokenSeries DeserializeTokenSeries(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static TokenProperty DeserializeTokenProperty(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static TokenData DeserializeTokenData(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static SendRawTx DeserializeSendRawTx(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Auction DeserializeAuction(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Script DeserializeScript(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Archive DeserializeArchive(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static ABIParameter DeserializeABIParameter(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static ABIMethod DeserializeABIMethod(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static ABIEvent DeserializeABIEvent(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Contract DeserializeContract(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Channel DeserializeChannel(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Receipt DeserializeReceipt(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Peer DeserializePeer(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Validator DeserializeValidator(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static Swap DeserializeSwap(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
 	
 
-	static bool Deserializebool(const JSONValue& json, bool& jsonError);
+	static bool Deserializebool(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static LazyBlock DeserializeLazyBlock(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
+	static LazyTransaction DeserializeLazyTransaction(const JSONValue& json, bool& jsonError, const RpcProjection* projection=0);
 };
 
 #if defined(PHANTASMA_HTTPCLIENT)
@@ -1200,888 +2149,1765 @@ public:
 	{}
 
 	// Returns the account name and balance of given address. 
-	Account GetAccount(const Char* account, PhantasmaError* out_error = nullptr);
+	Account GetAccount(PHANTASMA_ARENA_PARAM const Char* account, PhantasmaError* out_error = nullptr);
 	// Returns the address that owns a given name. 
-	String LookUpName(const Char* name, PhantasmaError* out_error = nullptr);
+	String LookUpName(PHANTASMA_ARENA_PARAM const Char* name, PhantasmaError* out_error = nullptr);
 	// Returns the height of a chain. 
-	Int32 GetBlockHeight(const Char* chainInput, PhantasmaError* out_error = nullptr);
+	Int32 GetBlockHeight(PHANTASMA_ARENA_PARAM const Char* chainInput, PhantasmaError* out_error = nullptr);
 	// Returns the number of transactions of given block hash or error if given hash is invalid or is not found. 
-	Int32 GetBlockTransactionCountByHash(const Char* blockHash, PhantasmaError* out_error = nullptr);
+	Int32 GetBlockTransactionCountByHash(PHANTASMA_ARENA_PARAM const Char* blockHash, PhantasmaError* out_error = nullptr);
 	// Returns information about a block by hash. 
-	Block GetBlockByHash(const Char* blockHash, PhantasmaError* out_error = nullptr);
+	Block GetBlockByHash(PHANTASMA_ARENA_PARAM const Char* blockHash, PhantasmaError* out_error = nullptr);
 	// Returns a serialized string, containing information about a block by hash. 
-	String GetRawBlockByHash(const Char* blockHash, PhantasmaError* out_error = nullptr);
+	String GetRawBlockByHash(PHANTASMA_ARENA_PARAM const Char* blockHash, PhantasmaError* out_error = nullptr);
 	// Returns information about a block by height and chain. 
-	Block GetBlockByHeight(const Char* chainInput, UInt32 height, PhantasmaError* out_error = nullptr);
+	Block GetBlockByHeight(PHANTASMA_ARENA_PARAM const Char* chainInput, UInt32 height, PhantasmaError* out_error = nullptr);
 	// Returns a serialized string, in hex format, containing information about a block by height and chain. 
-	String GetRawBlockByHeight(const Char* chainInput, UInt32 height, PhantasmaError* out_error = nullptr);
+	String GetRawBlockByHeight(PHANTASMA_ARENA_PARAM const Char* chainInput, UInt32 height, PhantasmaError* out_error = nullptr);
 	// Returns the information about a transaction requested by a block hash and transaction index. 
-	Transaction GetTransactionByBlockHashAndIndex(const Char* blockHash, Int32 index, PhantasmaError* out_error = nullptr);
+	Transaction GetTransactionByBlockHashAndIndex(PHANTASMA_ARENA_PARAM const Char* blockHash, Int32 index, PhantasmaError* out_error = nullptr);
 	// Returns last X transactions of given address. (paginated call)
-	AccountTransactions GetAddressTransactions(const Char* account, UInt32 page, UInt32 pageSize, PhantasmaError* out_error = nullptr);
+	AccountTransactions GetAddressTransactions(PHANTASMA_ARENA_PARAM const Char* account, UInt32 page, UInt32 pageSize, PhantasmaError* out_error = nullptr);
 	// Get number of transactions in a specific address and chain 
-	Int32 GetAddressTransactionCount(const Char* account, const Char* chainInput, PhantasmaError* out_error = nullptr);
+	Int32 GetAddressTransactionCount(PHANTASMA_ARENA_PARAM const Char* account, const Char* chainInput, PhantasmaError* out_error = nullptr);
 	// Allows to broadcast a signed operation on the network, but it&apos;s required to build it manually. 
-	String SendRawTransaction(const Char* txData, PhantasmaError* out_error = nullptr);
+	String SendRawTransaction(PHANTASMA_ARENA_PARAM const Char* txData, PhantasmaError* out_error = nullptr);
 	// Allows to invoke script based on network state, without state changes. 
-	Script InvokeRawScript(const Char* chainInput, const Char* scriptData, PhantasmaError* out_error = nullptr);
+	Script InvokeRawScript(PHANTASMA_ARENA_PARAM const Char* chainInput, const Char* scriptData, PhantasmaError* out_error = nullptr);
 	// Returns information about a transaction by hash. 
-	Transaction GetTransaction(const Char* hashText, PhantasmaError* out_error = nullptr);
+	Transaction GetTransaction(PHANTASMA_ARENA_PARAM const Char* hashText, PhantasmaError* out_error = nullptr);
 	// Removes a pending transaction from the mempool. 
-	String CancelTransaction(const Char* hashText, PhantasmaError* out_error = nullptr);
+	String CancelTransaction(PHANTASMA_ARENA_PARAM const Char* hashText, PhantasmaError* out_error = nullptr);
 	// Returns an array of all chains deployed in Phantasma. 
-	PHANTASMA_VECTOR<Chain> GetChains(PhantasmaError* out_error = nullptr);
+	PHANTASMA_VECTOR<Chain> GetChains(PHANTASMA_ARENA_PARAM PhantasmaError* out_error = nullptr);
 	// Returns info about the nexus. 
-	Nexus GetNexus(bool extended, PhantasmaError* out_error = nullptr);
+	Nexus GetNexus(PHANTASMA_ARENA_PARAM bool extended, PhantasmaError* out_error = nullptr);
 	// Returns info about an organization. 
-	Organization GetOrganization(const Char* ID, PhantasmaError* out_error = nullptr);
+	Organization GetOrganization(PHANTASMA_ARENA_PARAM const Char* ID, PhantasmaError* out_error = nullptr);
 	// Returns content of a Phantasma leaderboard. 
-	Leaderboard GetLeaderboard(const Char* name, PhantasmaError* out_error = nullptr);
+	Leaderboard GetLeaderboard(PHANTASMA_ARENA_PARAM const Char* name, PhantasmaError* out_error = nullptr);
 	// Returns an array of tokens deployed in Phantasma. 
-	PHANTASMA_VECTOR<Token> GetTokens(bool extended, PhantasmaError* out_error = nullptr);
+	PHANTASMA_VECTOR<Token> GetTokens(PHANTASMA_ARENA_PARAM bool extended, PhantasmaError* out_error = nullptr);
 	// Returns info about a specific token deployed in Phantasma. 
-	Token GetToken(const Char* symbol, bool extended, PhantasmaError* out_error = nullptr);
+	Token GetToken(PHANTASMA_ARENA_PARAM const Char* symbol, bool extended, PhantasmaError* out_error = nullptr);
 	// Returns data of a non-fungible token, in hexadecimal format. 
-	TokenData GetTokenData(const Char* symbol, const Char* IDtext, PhantasmaError* out_error = nullptr);
+	TokenData GetTokenData(PHANTASMA_ARENA_PARAM const Char* symbol, const Char* IDtext, PhantasmaError* out_error = nullptr);
 	// Returns data of a non-fungible token, in hexadecimal format. 
-	TokenData GetNFT(const Char* symbol, const Char* IDtext, bool extended, PhantasmaError* out_error = nullptr);
+	TokenData GetNFT(PHANTASMA_ARENA_PARAM const Char* symbol, const Char* IDtext, bool extended, PhantasmaError* out_error = nullptr);
 	// Returns the balance for a specific token and chain, given an address. 
-	Balance GetTokenBalance(const Char* account, const Char* tokenSymbol, const Char* chainInput, PhantasmaError* out_error = nullptr);
+	Balance GetTokenBalance(PHANTASMA_ARENA_PARAM const Char* account, const Char* tokenSymbol, const Char* chainInput, PhantasmaError* out_error = nullptr);
 	// Returns the number of active auctions. 
-	Int32 GetAuctionsCount(const Char* chainAddressOrName, const Char* symbol, PhantasmaError* out_error = nullptr);
+	Int32 GetAuctionsCount(PHANTASMA_ARENA_PARAM const Char* chainAddressOrName, const Char* symbol, PhantasmaError* out_error = nullptr);
 	// Returns the auctions available in the market. (paginated call)
-	PHANTASMA_VECTOR<Auction> GetAuctions(const Char* chainAddressOrName, const Char* symbol, UInt32 page, UInt32 pageSize, PhantasmaError* out_error = nullptr);
+	PHANTASMA_VECTOR<Auction> GetAuctions(PHANTASMA_ARENA_PARAM const Char* chainAddressOrName, const Char* symbol, UInt32 page, UInt32 pageSize, PhantasmaError* out_error = nullptr);
 	// Returns the auction for a specific token. 
-	Auction GetAuction(const Char* chainAddressOrName, const Char* symbol, const Char* IDtext, PhantasmaError* out_error = nullptr);
+	Auction GetAuction(PHANTASMA_ARENA_PARAM const Char* chainAddressOrName, const Char* symbol, const Char* IDtext, PhantasmaError* out_error = nullptr);
 	// Returns info about a specific archive. 
-	Archive GetArchive(const Char* hashText, PhantasmaError* out_error = nullptr);
+	Archive GetArchive(PHANTASMA_ARENA_PARAM const Char* hashText, PhantasmaError* out_error = nullptr);
 	// Writes the contents of an incomplete archive. 
-	bool WriteArchive(const Char* hashText, Int32 blockIndex, const Char* blockContent, PhantasmaError* out_error = nullptr);
+	bool WriteArchive(PHANTASMA_ARENA_PARAM const Char* hashText, Int32 blockIndex, const Char* blockContent, PhantasmaError* out_error = nullptr);
 	// Reads given archive block. 
-	String ReadArchive(const Char* hashText, Int32 blockIndex, PhantasmaError* out_error = nullptr);
+	String ReadArchive(PHANTASMA_ARENA_PARAM const Char* hashText, Int32 blockIndex, PhantasmaError* out_error = nullptr);
 	// Returns the ABI interface of specific contract. 
-	Contract GetContract(const Char* chainAddressOrName, const Char* contractName, PhantasmaError* out_error = nullptr);
+	Contract GetContract(PHANTASMA_ARENA_PARAM const Char* chainAddressOrName, const Char* contractName, PhantasmaError* out_error = nullptr);
 	// Returns list of known peers. 
-	PHANTASMA_VECTOR<Peer> GetPeers(PhantasmaError* out_error = nullptr);
+	PHANTASMA_VECTOR<Peer> GetPeers(PHANTASMA_ARENA_PARAM PhantasmaError* out_error = nullptr);
 	// Writes a message to the relay network. 
-	bool RelaySend(const Char* receiptHex, PhantasmaError* out_error = nullptr);
+	bool RelaySend(PHANTASMA_ARENA_PARAM const Char* receiptHex, PhantasmaError* out_error = nullptr);
 	// Receives messages from the relay network. 
-	PHANTASMA_VECTOR<Receipt> RelayReceive(const Char* account, PhantasmaError* out_error = nullptr);
+	PHANTASMA_VECTOR<Receipt> RelayReceive(PHANTASMA_ARENA_PARAM const Char* account, PhantasmaError* out_error = nullptr);
 	// Reads pending messages from the relay network. 
-	PHANTASMA_VECTOR<Event> GetEvents(const Char* account, PhantasmaError* out_error = nullptr);
+	PHANTASMA_VECTOR<Event> GetEvents(PHANTASMA_ARENA_PARAM const Char* account, PhantasmaError* out_error = nullptr);
 	// Returns an array of available interop platforms. 
-	PHANTASMA_VECTOR<Platform> GetPlatforms(PhantasmaError* out_error = nullptr);
+	PHANTASMA_VECTOR<Platform> GetPlatforms(PHANTASMA_ARENA_PARAM PhantasmaError* out_error = nullptr);
 	// Returns an array of available validators. 
-	PHANTASMA_VECTOR<Validator> GetValidators(PhantasmaError* out_error = nullptr);
+	PHANTASMA_VECTOR<Validator> GetValidators(PHANTASMA_ARENA_PARAM PhantasmaError* out_error = nullptr);
 	// Tries to settle a pending swap for a specific hash. 
-	String SettleSwap(const Char* sourcePlatform, const Char* destPlatform, const Char* hashText, PhantasmaError* out_error = nullptr);
+	String SettleSwap(PHANTASMA_ARENA_PARAM const Char* sourcePlatform, const Char* destPlatform, const Char* hashText, PhantasmaError* out_error = nullptr);
 	// Returns platform swaps for a specific address. 
-	PHANTASMA_VECTOR<Swap> GetSwapsForAddress(const Char* account, PhantasmaError* out_error = nullptr);
+	PHANTASMA_VECTOR<Swap> GetSwapsForAddress(PHANTASMA_ARENA_PARAM const Char* account, PhantasmaError* out_error = nullptr);
 	
+
+	// Sends the requests that are queued in the batch, with one HTTP request per batch.MaxSize() requests
+	//  Every HTTP request is sent, even after one fails, and out_error reports the first failure
+	bool Send(PHANTASMA_ARENA_PARAM RpcBatch& batch, PhantasmaError* out_error = nullptr);
 private:
 	HttpClient& m_httpClient;
 };
 #endif
+
+#if defined(PHANTASMA_ASYNC_HTTPCLIENT)
+//------------------------------------------------------------------------------
+// Asynchronous RPC API:
+//------------------------------------------------------------------------------
+class AsyncPhantasmaAPI
+{
+public:
+	AsyncPhantasmaAPI(AsyncHttpClient& client) // client must have a longer lifetime than this API object
+		: m_httpClient(client)
+	{}
+
+	// Returns the account name and balance of given address. 
+	void GetAccount(const Char* account, std::function<void(Account& output, PhantasmaError& error)> onComplete);
+	// Returns the address that owns a given name. 
+	void LookUpName(const Char* name, std::function<void(String& output, PhantasmaError& error)> onComplete);
+	// Returns the height of a chain. 
+	void GetBlockHeight(const Char* chainInput, std::function<void(Int32& output, PhantasmaError& error)> onComplete);
+	// Returns the number of transactions of given block hash or error if given hash is invalid or is not found. 
+	void GetBlockTransactionCountByHash(const Char* blockHash, std::function<void(Int32& output, PhantasmaError& error)> onComplete);
+	// Returns information about a block by hash. 
+	void GetBlockByHash(const Char* blockHash, std::function<void(Block& output, PhantasmaError& error)> onComplete);
+	// Returns a serialized string, containing information about a block by hash. 
+	void GetRawBlockByHash(const Char* blockHash, std::function<void(String& output, PhantasmaError& error)> onComplete);
+	// Returns information about a block by height and chain. 
+	void GetBlockByHeight(const Char* chainInput, UInt32 height, std::function<void(Block& output, PhantasmaError& error)> onComplete);
+	// Returns a serialized string, in hex format, containing information about a block by height and chain. 
+	void GetRawBlockByHeight(const Char* chainInput, UInt32 height, std::function<void(String& output, PhantasmaError& error)> onComplete);
+	// Returns the information about a transaction requested by a block hash and transaction index. 
+	void GetTransactionByBlockHashAndIndex(const Char* blockHash, Int32 index, std::function<void(Transaction& output, PhantasmaError& error)> onComplete);
+	// Returns last X transactions of given address. (paginated call)
+	void GetAddressTransactions(const Char* account, UInt32 page, UInt32 pageSize, std::function<void(AccountTransactions& output, PhantasmaError& error)> onComplete);
+	// Get number of transactions in a specific address and chain 
+	void GetAddressTransactionCount(const Char* account, const Char* chainInput, std::function<void(Int32& output, PhantasmaError& error)> onComplete);
+	// Allows to broadcast a signed operation on the network, but it&apos;s required to build it manually. 
+	void SendRawTransaction(const Char* txData, std::function<void(String& output, PhantasmaError& error)> onComplete);
+	// Allows to invoke script based on network state, without state changes. 
+	void InvokeRawScript(const Char* chainInput, const Char* scriptData, std::function<void(Script& output, PhantasmaError& error)> onComplete);
+	// Returns information about a transaction by hash. 
+	void GetTransaction(const Char* hashText, std::function<void(Transaction& output, PhantasmaError& error)> onComplete);
+	// Removes a pending transaction from the mempool. 
+	void CancelTransaction(const Char* hashText, std::function<void(String& output, PhantasmaError& error)> onComplete);
+	// Returns an array of all chains deployed in Phantasma. 
+	void GetChains(std::function<void(PHANTASMA_VECTOR<Chain>& output, PhantasmaError& error)> onComplete);
+	// Returns info about the nexus. 
+	void GetNexus(bool extended, std::function<void(Nexus& output, PhantasmaError& error)> onComplete);
+	// Returns info about an organization. 
+	void GetOrganization(const Char* ID, std::function<void(Organization& output, PhantasmaError& error)> onComplete);
+	// Returns content of a Phantasma leaderboard. 
+	void GetLeaderboard(const Char* name, std::function<void(Leaderboard& output, PhantasmaError& error)> onComplete);
+	// Returns an array of tokens deployed in Phantasma. 
+	void GetTokens(bool extended, std::function<void(PHANTASMA_VECTOR<Token>& output, PhantasmaError& error)> onComplete);
+	// Returns info about a specific token deployed in Phantasma. 
+	void GetToken(const Char* symbol, bool extended, std::function<void(Token& output, PhantasmaError& error)> onComplete);
+	// Returns data of a non-fungible token, in hexadecimal format. 
+	void GetTokenData(const Char* symbol, const Char* IDtext, std::function<void(TokenData& output, PhantasmaError& error)> onComplete);
+	// Returns data of a non-fungible token, in hexadecimal format. 
+	void GetNFT(const Char* symbol, const Char* IDtext, bool extended, std::function<void(TokenData& output, PhantasmaError& error)> onComplete);
+	// Returns the balance for a specific token and chain, given an address. 
+	void GetTokenBalance(const Char* account, const Char* tokenSymbol, const Char* chainInput, std::function<void(Balance& output, PhantasmaError& error)> onComplete);
+	// Returns the number of active auctions. 
+	void GetAuctionsCount(const Char* chainAddressOrName, const Char* symbol, std::function<void(Int32& output, PhantasmaError& error)> onComplete);
+	// Returns the auctions available in the market. (paginated call)
+	void GetAuctions(const Char* chainAddressOrName, const Char* symbol, UInt32 page, UInt32 pageSize, std::function<void(PHANTASMA_VECTOR<Auction>& output, PhantasmaError& error)> onComplete);
+	// Returns the auction for a specific token. 
+	void GetAuction(const Char* chainAddressOrName, const Char* symbol, const Char* IDtext, std::function<void(Auction& output, PhantasmaError& error)> onComplete);
+	// Returns info about a specific archive. 
+	void GetArchive(const Char* hashText, std::function<void(Archive& output, PhantasmaError& error)> onComplete);
+	// Writes the contents of an incomplete archive. 
+	void WriteArchive(const Char* hashText, Int32 blockIndex, const Char* blockContent, std::function<void(bool& output, PhantasmaError& error)> onComplete);
+	// Reads given archive block. 
+	void ReadArchive(const Char* hashText, Int32 blockIndex, std::function<void(String& output, PhantasmaError& error)> onComplete);
+	// Returns the ABI interface of specific contract. 
+	void GetContract(const Char* chainAddressOrName, const Char* contractName, std::function<void(Contract& output, PhantasmaError& error)> onComplete);
+	// Returns list of known peers. 
+	void GetPeers(std::function<void(PHANTASMA_VECTOR<Peer>& output, PhantasmaError& error)> onComplete);
+	// Writes a message to the relay network. 
+	void RelaySend(const Char* receiptHex, std::function<void(bool& output, PhantasmaError& error)> onComplete);
+	// Receives messages from the relay network. 
+	void RelayReceive(const Char* account, std::function<void(PHANTASMA_VECTOR<Receipt>& output, PhantasmaError& error)> onComplete);
+	// Reads pending messages from the relay network. 
+	void GetEvents(const Char* account, std::function<void(PHANTASMA_VECTOR<Event>& output, PhantasmaError& error)> onComplete);
+	// Returns an array of available interop platforms. 
+	void GetPlatforms(std::function<void(PHANTASMA_VECTOR<Platform>& output, PhantasmaError& error)> onComplete);
+	// Returns an array of available validators. 
+	void GetValidators(std::function<void(PHANTASMA_VECTOR<Validator>& output, PhantasmaError& error)> onComplete);
+	// Tries to settle a pending swap for a specific hash. 
+	void SettleSwap(const Char* sourcePlatform, const Char* destPlatform, const Char* hashText, std::function<void(String& output, PhantasmaError& error)> onComplete);
+	// Returns platform swaps for a specific address. 
+	void GetSwapsForAddress(const Char* account, std::function<void(PHANTASMA_VECTOR<Swap>& output, PhantasmaError& error)> onComplete);
+	
+private:
+	AsyncHttpClient& m_httpClient;
+};
+#endif
 	
 #if defined(PHANTASMA_IMPLEMENTATION)
 //------------------------------------------------------------------------------
 // RPC API implementation details:
 //------------------------------------------------------------------------------
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::Deserializebool(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::Deserializebool(const JSONValue& value, bool& jsonErr, const RpcProjection*)
 {
 	return json::AsBool(value, jsonErr);
 }
 
 
-PHANTASMA_FUNCTION TokenSeriesMode PhantasmaJsonAPI::DeserializeTokenSeriesMode(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION TokenSeriesMode PhantasmaJsonAPI::DeserializeTokenSeriesMode(const JSONValue& value, bool& jsonErr, const RpcProjection*)
 {
 	return (TokenSeriesMode)json::AsInt32(value, jsonErr);
 }
 
-PHANTASMA_FUNCTION Int32 PhantasmaJsonAPI::DeserializeInt32(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Int32 PhantasmaJsonAPI::DeserializeInt32(const JSONValue& value, bool& jsonErr, const RpcProjection*)
 {
 	return json::AsInt32(value, jsonErr);
 }
 
-PHANTASMA_FUNCTION Balance PhantasmaJsonAPI::DeserializeBalance(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Balance PhantasmaJsonAPI::DeserializeBalance(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<String> idsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("ids"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Balance) : fields::Balance::All;
+	json::JSONSlot slot[fields::Balance::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Balance::Keys(), fields::Balance::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("chain")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("chain")) ) { slot[fields::Balance::chain_index] = json::ObjectValue(it, jsonErr); found |= fields::Balance::chain; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("amount")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("amount")) ) { slot[fields::Balance::amount_index] = json::ObjectValue(it, jsonErr); found |= fields::Balance::amount; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("symbol")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("symbol")) ) { slot[fields::Balance::symbol_index] = json::ObjectValue(it, jsonErr); found |= fields::Balance::symbol; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("decimals")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("decimals")) ) { slot[fields::Balance::decimals_index] = json::ObjectValue(it, jsonErr); found |= fields::Balance::decimals; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("ids")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("ids")) ) { slot[fields::Balance::ids_index] = json::ObjectValue(it, jsonErr); found |= fields::Balance::ids; } break;
+		}
+	}
+	RpcVector<RpcString> idsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Balance::ids) && json::IsArray(slot[fields::Balance::ids_index].Get(), jsonErr))
 	{
-		const JSONArray& idsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("ids"), jsonErr);
+		const JSONArray& idsJsonArray = json::AsArray(slot[fields::Balance::ids_index].Get(), jsonErr);
 		int size = json::ArraySize(idsJsonArray, jsonErr);
 		idsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(idsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			idsVector.push_back(json::AsString(json::IndexArray(idsJsonArray, i, jsonErr), jsonErr));
+			idsVector.push_back(json::AsRpcString(json::ArrayValue(it, jsonErr), jsonErr));
 		}
 	}	
 	return Balance { 
-		json::LookupString(value, PHANTASMA_LITERAL("chain"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("amount"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("symbol"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("decimals"), jsonErr), 
-		idsVector
+		(selected & fields::Balance::chain) ? json::AsRpcString(slot[fields::Balance::chain_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Balance::amount) ? json::AsRpcString(slot[fields::Balance::amount_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Balance::symbol) ? json::AsRpcString(slot[fields::Balance::symbol_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Balance::decimals) ? json::AsUInt32(slot[fields::Balance::decimals_index].Get(), jsonErr) : 0, 
+		std::move(idsVector)
 	};
 }
 
-PHANTASMA_FUNCTION Interop PhantasmaJsonAPI::DeserializeInterop(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION Interop PhantasmaJsonAPI::DeserializeInterop(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Interop) : fields::Interop::All;
+	json::JSONSlot slot[fields::Interop::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Interop::Keys(), fields::Interop::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("local")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("local")) ) { slot[fields::Interop::local_index] = json::ObjectValue(it, jsonErr); found |= fields::Interop::local; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("external")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("external")) ) { slot[fields::Interop::external_index] = json::ObjectValue(it, jsonErr); found |= fields::Interop::external; } break;
+		}
+	}	
 	return Interop { 
-		json::LookupString(value, PHANTASMA_LITERAL("local"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("external"), jsonErr)
+		(selected & fields::Interop::local) ? json::AsRpcString(slot[fields::Interop::local_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Interop::external) ? json::AsRpcString(slot[fields::Interop::external_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION Platform PhantasmaJsonAPI::DeserializePlatform(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Platform PhantasmaJsonAPI::DeserializePlatform(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<String> tokensVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("tokens"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Platform) : fields::Platform::All;
+	json::JSONSlot slot[fields::Platform::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Platform::Keys(), fields::Platform::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("platform")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("platform")) ) { slot[fields::Platform::platform_index] = json::ObjectValue(it, jsonErr); found |= fields::Platform::platform; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("chain")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("chain")) ) { slot[fields::Platform::chain_index] = json::ObjectValue(it, jsonErr); found |= fields::Platform::chain; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("fuel")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("fuel")) ) { slot[fields::Platform::fuel_index] = json::ObjectValue(it, jsonErr); found |= fields::Platform::fuel; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("tokens")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("tokens")) ) { slot[fields::Platform::tokens_index] = json::ObjectValue(it, jsonErr); found |= fields::Platform::tokens; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("interop")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("interop")) ) { slot[fields::Platform::interop_index] = json::ObjectValue(it, jsonErr); found |= fields::Platform::interop; } break;
+		}
+	}
+	RpcVector<RpcString> tokensVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Platform::tokens) && json::IsArray(slot[fields::Platform::tokens_index].Get(), jsonErr))
 	{
-		const JSONArray& tokensJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("tokens"), jsonErr);
+		const JSONArray& tokensJsonArray = json::AsArray(slot[fields::Platform::tokens_index].Get(), jsonErr);
 		int size = json::ArraySize(tokensJsonArray, jsonErr);
 		tokensVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(tokensJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			tokensVector.push_back(json::AsString(json::IndexArray(tokensJsonArray, i, jsonErr), jsonErr));
+			tokensVector.push_back(json::AsRpcString(json::ArrayValue(it, jsonErr), jsonErr));
 		}
 	}
-	PHANTASMA_VECTOR<Interop> interopVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("interop"), jsonErr))
+	RpcVector<Interop> interopVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Platform::interop) && json::IsArray(slot[fields::Platform::interop_index].Get(), jsonErr))
 	{
-		const JSONArray& interopJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("interop"), jsonErr);
+		const JSONArray& interopJsonArray = json::AsArray(slot[fields::Platform::interop_index].Get(), jsonErr);
 		int size = json::ArraySize(interopJsonArray, jsonErr);
 		interopVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(interopJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			interopVector.push_back(DeserializeInterop(json::IndexArray(interopJsonArray, i, jsonErr), jsonErr));
+			interopVector.push_back(DeserializeInterop(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}	
 	return Platform { 
-		json::LookupString(value, PHANTASMA_LITERAL("platform"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("chain"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("fuel"), jsonErr), 
-		tokensVector, 
-		interopVector
+		(selected & fields::Platform::platform) ? json::AsRpcString(slot[fields::Platform::platform_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Platform::chain) ? json::AsRpcString(slot[fields::Platform::chain_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Platform::fuel) ? json::AsRpcString(slot[fields::Platform::fuel_index].Get(), jsonErr) : RpcString(), 
+		std::move(tokensVector), 
+		std::move(interopVector)
 	};
 }
 
-PHANTASMA_FUNCTION Governance PhantasmaJsonAPI::DeserializeGovernance(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION Governance PhantasmaJsonAPI::DeserializeGovernance(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Governance) : fields::Governance::All;
+	json::JSONSlot slot[fields::Governance::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Governance::Keys(), fields::Governance::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::Governance::name_index] = json::ObjectValue(it, jsonErr); found |= fields::Governance::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("value")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("value")) ) { slot[fields::Governance::value_index] = json::ObjectValue(it, jsonErr); found |= fields::Governance::value; } break;
+		}
+	}	
 	return Governance { 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("value"), jsonErr)
+		(selected & fields::Governance::name) ? json::AsRpcString(slot[fields::Governance::name_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Governance::value) ? json::AsRpcString(slot[fields::Governance::value_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION Organization PhantasmaJsonAPI::DeserializeOrganization(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Organization PhantasmaJsonAPI::DeserializeOrganization(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<String> membersVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("members"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Organization) : fields::Organization::All;
+	json::JSONSlot slot[fields::Organization::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Organization::Keys(), fields::Organization::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("id")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("id")) ) { slot[fields::Organization::id_index] = json::ObjectValue(it, jsonErr); found |= fields::Organization::id; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::Organization::name_index] = json::ObjectValue(it, jsonErr); found |= fields::Organization::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("members")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("members")) ) { slot[fields::Organization::members_index] = json::ObjectValue(it, jsonErr); found |= fields::Organization::members; } break;
+		}
+	}
+	RpcVector<RpcString> membersVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Organization::members) && json::IsArray(slot[fields::Organization::members_index].Get(), jsonErr))
 	{
-		const JSONArray& membersJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("members"), jsonErr);
+		const JSONArray& membersJsonArray = json::AsArray(slot[fields::Organization::members_index].Get(), jsonErr);
 		int size = json::ArraySize(membersJsonArray, jsonErr);
 		membersVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(membersJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			membersVector.push_back(json::AsString(json::IndexArray(membersJsonArray, i, jsonErr), jsonErr));
+			membersVector.push_back(json::AsRpcString(json::ArrayValue(it, jsonErr), jsonErr));
 		}
 	}	
 	return Organization { 
-		json::LookupString(value, PHANTASMA_LITERAL("id"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		membersVector
+		(selected & fields::Organization::id) ? json::AsRpcString(slot[fields::Organization::id_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Organization::name) ? json::AsRpcString(slot[fields::Organization::name_index].Get(), jsonErr) : RpcString(), 
+		std::move(membersVector)
 	};
 }
 
-PHANTASMA_FUNCTION Nexus PhantasmaJsonAPI::DeserializeNexus(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Nexus PhantasmaJsonAPI::DeserializeNexus(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<Platform> platformsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("platforms"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Nexus) : fields::Nexus::All;
+	json::JSONSlot slot[fields::Nexus::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Nexus::Keys(), fields::Nexus::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::Nexus::name_index] = json::ObjectValue(it, jsonErr); found |= fields::Nexus::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("platforms")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("platforms")) ) { slot[fields::Nexus::platforms_index] = json::ObjectValue(it, jsonErr); found |= fields::Nexus::platforms; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("tokens")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("tokens")) ) { slot[fields::Nexus::tokens_index] = json::ObjectValue(it, jsonErr); found |= fields::Nexus::tokens; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("chains")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("chains")) ) { slot[fields::Nexus::chains_index] = json::ObjectValue(it, jsonErr); found |= fields::Nexus::chains; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("governance")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("governance")) ) { slot[fields::Nexus::governance_index] = json::ObjectValue(it, jsonErr); found |= fields::Nexus::governance; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("organizations")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("organizations")) ) { slot[fields::Nexus::organizations_index] = json::ObjectValue(it, jsonErr); found |= fields::Nexus::organizations; } break;
+		}
+	}
+	RpcVector<Platform> platformsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Nexus::platforms) && json::IsArray(slot[fields::Nexus::platforms_index].Get(), jsonErr))
 	{
-		const JSONArray& platformsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("platforms"), jsonErr);
+		const JSONArray& platformsJsonArray = json::AsArray(slot[fields::Nexus::platforms_index].Get(), jsonErr);
 		int size = json::ArraySize(platformsJsonArray, jsonErr);
 		platformsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(platformsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			platformsVector.push_back(DeserializePlatform(json::IndexArray(platformsJsonArray, i, jsonErr), jsonErr));
+			platformsVector.push_back(DeserializePlatform(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}
-	PHANTASMA_VECTOR<Token> tokensVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("tokens"), jsonErr))
+	RpcVector<Token> tokensVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Nexus::tokens) && json::IsArray(slot[fields::Nexus::tokens_index].Get(), jsonErr))
 	{
-		const JSONArray& tokensJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("tokens"), jsonErr);
+		const JSONArray& tokensJsonArray = json::AsArray(slot[fields::Nexus::tokens_index].Get(), jsonErr);
 		int size = json::ArraySize(tokensJsonArray, jsonErr);
 		tokensVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(tokensJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			tokensVector.push_back(DeserializeToken(json::IndexArray(tokensJsonArray, i, jsonErr), jsonErr));
+			tokensVector.push_back(DeserializeToken(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}
-	PHANTASMA_VECTOR<Chain> chainsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("chains"), jsonErr))
+	RpcVector<Chain> chainsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Nexus::chains) && json::IsArray(slot[fields::Nexus::chains_index].Get(), jsonErr))
 	{
-		const JSONArray& chainsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("chains"), jsonErr);
+		const JSONArray& chainsJsonArray = json::AsArray(slot[fields::Nexus::chains_index].Get(), jsonErr);
 		int size = json::ArraySize(chainsJsonArray, jsonErr);
 		chainsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(chainsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			chainsVector.push_back(DeserializeChain(json::IndexArray(chainsJsonArray, i, jsonErr), jsonErr));
+			chainsVector.push_back(DeserializeChain(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}
-	PHANTASMA_VECTOR<Governance> governanceVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("governance"), jsonErr))
+	RpcVector<Governance> governanceVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Nexus::governance) && json::IsArray(slot[fields::Nexus::governance_index].Get(), jsonErr))
 	{
-		const JSONArray& governanceJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("governance"), jsonErr);
+		const JSONArray& governanceJsonArray = json::AsArray(slot[fields::Nexus::governance_index].Get(), jsonErr);
 		int size = json::ArraySize(governanceJsonArray, jsonErr);
 		governanceVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(governanceJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			governanceVector.push_back(DeserializeGovernance(json::IndexArray(governanceJsonArray, i, jsonErr), jsonErr));
+			governanceVector.push_back(DeserializeGovernance(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}
-	PHANTASMA_VECTOR<String> organizationsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("organizations"), jsonErr))
+	RpcVector<RpcString> organizationsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Nexus::organizations) && json::IsArray(slot[fields::Nexus::organizations_index].Get(), jsonErr))
 	{
-		const JSONArray& organizationsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("organizations"), jsonErr);
+		const JSONArray& organizationsJsonArray = json::AsArray(slot[fields::Nexus::organizations_index].Get(), jsonErr);
 		int size = json::ArraySize(organizationsJsonArray, jsonErr);
 		organizationsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(organizationsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			organizationsVector.push_back(json::AsString(json::IndexArray(organizationsJsonArray, i, jsonErr), jsonErr));
+			organizationsVector.push_back(json::AsRpcString(json::ArrayValue(it, jsonErr), jsonErr));
 		}
 	}	
 	return Nexus { 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		platformsVector, 
-		tokensVector, 
-		chainsVector, 
-		governanceVector, 
-		organizationsVector
+		(selected & fields::Nexus::name) ? json::AsRpcString(slot[fields::Nexus::name_index].Get(), jsonErr) : RpcString(), 
+		std::move(platformsVector), 
+		std::move(tokensVector), 
+		std::move(chainsVector), 
+		std::move(governanceVector), 
+		std::move(organizationsVector)
 	};
 }
 
-PHANTASMA_FUNCTION Stake PhantasmaJsonAPI::DeserializeStake(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION Stake PhantasmaJsonAPI::DeserializeStake(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Stake) : fields::Stake::All;
+	json::JSONSlot slot[fields::Stake::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Stake::Keys(), fields::Stake::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("amount")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("amount")) ) { slot[fields::Stake::amount_index] = json::ObjectValue(it, jsonErr); found |= fields::Stake::amount; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("time")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("time")) ) { slot[fields::Stake::time_index] = json::ObjectValue(it, jsonErr); found |= fields::Stake::time; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("unclaimed")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("unclaimed")) ) { slot[fields::Stake::unclaimed_index] = json::ObjectValue(it, jsonErr); found |= fields::Stake::unclaimed; } break;
+		}
+	}	
 	return Stake { 
-		json::LookupString(value, PHANTASMA_LITERAL("amount"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("time"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("unclaimed"), jsonErr)
+		(selected & fields::Stake::amount) ? json::AsRpcString(slot[fields::Stake::amount_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Stake::time) ? json::AsUInt32(slot[fields::Stake::time_index].Get(), jsonErr) : 0, 
+		(selected & fields::Stake::unclaimed) ? json::AsRpcString(slot[fields::Stake::unclaimed_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION Storage PhantasmaJsonAPI::DeserializeStorage(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Storage PhantasmaJsonAPI::DeserializeStorage(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<Archive> archivesVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("archives"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Storage) : fields::Storage::All;
+	json::JSONSlot slot[fields::Storage::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Storage::Keys(), fields::Storage::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("available")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("available")) ) { slot[fields::Storage::available_index] = json::ObjectValue(it, jsonErr); found |= fields::Storage::available; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("used")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("used")) ) { slot[fields::Storage::used_index] = json::ObjectValue(it, jsonErr); found |= fields::Storage::used; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("avatar")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("avatar")) ) { slot[fields::Storage::avatar_index] = json::ObjectValue(it, jsonErr); found |= fields::Storage::avatar; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("archives")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("archives")) ) { slot[fields::Storage::archives_index] = json::ObjectValue(it, jsonErr); found |= fields::Storage::archives; } break;
+		}
+	}
+	RpcVector<Archive> archivesVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Storage::archives) && json::IsArray(slot[fields::Storage::archives_index].Get(), jsonErr))
 	{
-		const JSONArray& archivesJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("archives"), jsonErr);
+		const JSONArray& archivesJsonArray = json::AsArray(slot[fields::Storage::archives_index].Get(), jsonErr);
 		int size = json::ArraySize(archivesJsonArray, jsonErr);
 		archivesVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(archivesJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			archivesVector.push_back(DeserializeArchive(json::IndexArray(archivesJsonArray, i, jsonErr), jsonErr));
+			archivesVector.push_back(DeserializeArchive(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}	
 	return Storage { 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("available"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("used"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("avatar"), jsonErr), 
-		archivesVector
+		(selected & fields::Storage::available) ? json::AsUInt32(slot[fields::Storage::available_index].Get(), jsonErr) : 0, 
+		(selected & fields::Storage::used) ? json::AsUInt32(slot[fields::Storage::used_index].Get(), jsonErr) : 0, 
+		(selected & fields::Storage::avatar) ? json::AsRpcString(slot[fields::Storage::avatar_index].Get(), jsonErr) : RpcString(), 
+		std::move(archivesVector)
 	};
 }
 
-PHANTASMA_FUNCTION Account PhantasmaJsonAPI::DeserializeAccount(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Account PhantasmaJsonAPI::DeserializeAccount(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<Balance> balancesVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("balances"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Account) : fields::Account::All;
+	json::JSONSlot slot[fields::Account::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Account::Keys(), fields::Account::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("address")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("address")) ) { slot[fields::Account::address_index] = json::ObjectValue(it, jsonErr); found |= fields::Account::address; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::Account::name_index] = json::ObjectValue(it, jsonErr); found |= fields::Account::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("stakes")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("stakes")) ) { slot[fields::Account::stakes_index] = json::ObjectValue(it, jsonErr); found |= fields::Account::stakes; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("stake")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("stake")) ) { slot[fields::Account::stake_index] = json::ObjectValue(it, jsonErr); found |= fields::Account::stake; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("unclaimed")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("unclaimed")) ) { slot[fields::Account::unclaimed_index] = json::ObjectValue(it, jsonErr); found |= fields::Account::unclaimed; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("relay")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("relay")) ) { slot[fields::Account::relay_index] = json::ObjectValue(it, jsonErr); found |= fields::Account::relay; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("validator")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("validator")) ) { slot[fields::Account::validator_index] = json::ObjectValue(it, jsonErr); found |= fields::Account::validator; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("storage")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("storage")) ) { slot[fields::Account::storage_index] = json::ObjectValue(it, jsonErr); found |= fields::Account::storage; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("balances")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("balances")) ) { slot[fields::Account::balances_index] = json::ObjectValue(it, jsonErr); found |= fields::Account::balances; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("txs")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("txs")) ) { slot[fields::Account::txs_index] = json::ObjectValue(it, jsonErr); found |= fields::Account::txs; } break;
+		}
+	}
+	RpcVector<Balance> balancesVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Account::balances) && json::IsArray(slot[fields::Account::balances_index].Get(), jsonErr))
 	{
-		const JSONArray& balancesJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("balances"), jsonErr);
+		const JSONArray& balancesJsonArray = json::AsArray(slot[fields::Account::balances_index].Get(), jsonErr);
 		int size = json::ArraySize(balancesJsonArray, jsonErr);
 		balancesVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(balancesJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			balancesVector.push_back(DeserializeBalance(json::IndexArray(balancesJsonArray, i, jsonErr), jsonErr));
+			balancesVector.push_back(DeserializeBalance(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}
-	PHANTASMA_VECTOR<String> txsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("txs"), jsonErr))
+	RpcVector<RpcString> txsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Account::txs) && json::IsArray(slot[fields::Account::txs_index].Get(), jsonErr))
 	{
-		const JSONArray& txsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("txs"), jsonErr);
+		const JSONArray& txsJsonArray = json::AsArray(slot[fields::Account::txs_index].Get(), jsonErr);
 		int size = json::ArraySize(txsJsonArray, jsonErr);
 		txsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(txsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			txsVector.push_back(json::AsString(json::IndexArray(txsJsonArray, i, jsonErr), jsonErr));
+			txsVector.push_back(json::AsRpcString(json::ArrayValue(it, jsonErr), jsonErr));
 		}
 	}	
 	return Account { 
-		json::LookupString(value, PHANTASMA_LITERAL("address"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		DeserializeStake(json::LookupValue(value, PHANTASMA_LITERAL("stakes"), jsonErr), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("stake"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("unclaimed"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("relay"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("validator"), jsonErr), 
-		DeserializeStorage(json::LookupValue(value, PHANTASMA_LITERAL("storage"), jsonErr), jsonErr), 
-		balancesVector, 
-		txsVector
+		(selected & fields::Account::address) ? json::AsRpcString(slot[fields::Account::address_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Account::name) ? json::AsRpcString(slot[fields::Account::name_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Account::stakes) ? DeserializeStake(slot[fields::Account::stakes_index].Get(), jsonErr, projection) : Stake(), 
+		(selected & fields::Account::stake) ? json::AsRpcString(slot[fields::Account::stake_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Account::unclaimed) ? json::AsRpcString(slot[fields::Account::unclaimed_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Account::relay) ? json::AsRpcString(slot[fields::Account::relay_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Account::validator) ? json::AsRpcString(slot[fields::Account::validator_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Account::storage) ? DeserializeStorage(slot[fields::Account::storage_index].Get(), jsonErr, projection) : Storage(), 
+		std::move(balancesVector), 
+		std::move(txsVector)
 	};
 }
 
-PHANTASMA_FUNCTION LeaderboardRow PhantasmaJsonAPI::DeserializeLeaderboardRow(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION LeaderboardRow PhantasmaJsonAPI::DeserializeLeaderboardRow(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::LeaderboardRow) : fields::LeaderboardRow::All;
+	json::JSONSlot slot[fields::LeaderboardRow::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::LeaderboardRow::Keys(), fields::LeaderboardRow::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("address")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("address")) ) { slot[fields::LeaderboardRow::address_index] = json::ObjectValue(it, jsonErr); found |= fields::LeaderboardRow::address; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("value")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("value")) ) { slot[fields::LeaderboardRow::value_index] = json::ObjectValue(it, jsonErr); found |= fields::LeaderboardRow::value; } break;
+		}
+	}	
 	return LeaderboardRow { 
-		json::LookupString(value, PHANTASMA_LITERAL("address"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("value"), jsonErr)
+		(selected & fields::LeaderboardRow::address) ? json::AsRpcString(slot[fields::LeaderboardRow::address_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::LeaderboardRow::value) ? json::AsRpcString(slot[fields::LeaderboardRow::value_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION Leaderboard PhantasmaJsonAPI::DeserializeLeaderboard(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Leaderboard PhantasmaJsonAPI::DeserializeLeaderboard(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<LeaderboardRow> rowsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("rows"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Leaderboard) : fields::Leaderboard::All;
+	json::JSONSlot slot[fields::Leaderboard::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Leaderboard::Keys(), fields::Leaderboard::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::Leaderboard::name_index] = json::ObjectValue(it, jsonErr); found |= fields::Leaderboard::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("rows")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("rows")) ) { slot[fields::Leaderboard::rows_index] = json::ObjectValue(it, jsonErr); found |= fields::Leaderboard::rows; } break;
+		}
+	}
+	RpcVector<LeaderboardRow> rowsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Leaderboard::rows) && json::IsArray(slot[fields::Leaderboard::rows_index].Get(), jsonErr))
 	{
-		const JSONArray& rowsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("rows"), jsonErr);
+		const JSONArray& rowsJsonArray = json::AsArray(slot[fields::Leaderboard::rows_index].Get(), jsonErr);
 		int size = json::ArraySize(rowsJsonArray, jsonErr);
 		rowsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(rowsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			rowsVector.push_back(DeserializeLeaderboardRow(json::IndexArray(rowsJsonArray, i, jsonErr), jsonErr));
+			rowsVector.push_back(DeserializeLeaderboardRow(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}	
 	return Leaderboard { 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		rowsVector
+		(selected & fields::Leaderboard::name) ? json::AsRpcString(slot[fields::Leaderboard::name_index].Get(), jsonErr) : RpcString(), 
+		std::move(rowsVector)
 	};
 }
 
-PHANTASMA_FUNCTION Dapp PhantasmaJsonAPI::DeserializeDapp(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION Dapp PhantasmaJsonAPI::DeserializeDapp(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Dapp) : fields::Dapp::All;
+	json::JSONSlot slot[fields::Dapp::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Dapp::Keys(), fields::Dapp::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::Dapp::name_index] = json::ObjectValue(it, jsonErr); found |= fields::Dapp::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("address")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("address")) ) { slot[fields::Dapp::address_index] = json::ObjectValue(it, jsonErr); found |= fields::Dapp::address; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("chain")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("chain")) ) { slot[fields::Dapp::chain_index] = json::ObjectValue(it, jsonErr); found |= fields::Dapp::chain; } break;
+		}
+	}	
 	return Dapp { 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("address"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("chain"), jsonErr)
+		(selected & fields::Dapp::name) ? json::AsRpcString(slot[fields::Dapp::name_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Dapp::address) ? json::AsRpcString(slot[fields::Dapp::address_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Dapp::chain) ? json::AsRpcString(slot[fields::Dapp::chain_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION Chain PhantasmaJsonAPI::DeserializeChain(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Chain PhantasmaJsonAPI::DeserializeChain(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<String> contractsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("contracts"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Chain) : fields::Chain::All;
+	json::JSONSlot slot[fields::Chain::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Chain::Keys(), fields::Chain::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::Chain::name_index] = json::ObjectValue(it, jsonErr); found |= fields::Chain::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("address")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("address")) ) { slot[fields::Chain::address_index] = json::ObjectValue(it, jsonErr); found |= fields::Chain::address; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("parent")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("parent")) ) { slot[fields::Chain::parent_index] = json::ObjectValue(it, jsonErr); found |= fields::Chain::parent; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("height")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("height")) ) { slot[fields::Chain::height_index] = json::ObjectValue(it, jsonErr); found |= fields::Chain::height; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("organization")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("organization")) ) { slot[fields::Chain::organization_index] = json::ObjectValue(it, jsonErr); found |= fields::Chain::organization; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("contracts")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("contracts")) ) { slot[fields::Chain::contracts_index] = json::ObjectValue(it, jsonErr); found |= fields::Chain::contracts; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("dapps")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("dapps")) ) { slot[fields::Chain::dapps_index] = json::ObjectValue(it, jsonErr); found |= fields::Chain::dapps; } break;
+		}
+	}
+	RpcVector<RpcString> contractsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Chain::contracts) && json::IsArray(slot[fields::Chain::contracts_index].Get(), jsonErr))
 	{
-		const JSONArray& contractsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("contracts"), jsonErr);
+		const JSONArray& contractsJsonArray = json::AsArray(slot[fields::Chain::contracts_index].Get(), jsonErr);
 		int size = json::ArraySize(contractsJsonArray, jsonErr);
 		contractsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(contractsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			contractsVector.push_back(json::AsString(json::IndexArray(contractsJsonArray, i, jsonErr), jsonErr));
+			contractsVector.push_back(json::AsRpcString(json::ArrayValue(it, jsonErr), jsonErr));
 		}
 	}
-	PHANTASMA_VECTOR<String> dappsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("dapps"), jsonErr))
+	RpcVector<RpcString> dappsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Chain::dapps) && json::IsArray(slot[fields::Chain::dapps_index].Get(), jsonErr))
 	{
-		const JSONArray& dappsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("dapps"), jsonErr);
+		const JSONArray& dappsJsonArray = json::AsArray(slot[fields::Chain::dapps_index].Get(), jsonErr);
 		int size = json::ArraySize(dappsJsonArray, jsonErr);
 		dappsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(dappsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			dappsVector.push_back(json::AsString(json::IndexArray(dappsJsonArray, i, jsonErr), jsonErr));
+			dappsVector.push_back(json::AsRpcString(json::ArrayValue(it, jsonErr), jsonErr));
 		}
 	}	
 	return Chain { 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("address"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("parent"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("height"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("organization"), jsonErr), 
-		contractsVector, 
-		dappsVector
+		(selected & fields::Chain::name) ? json::AsRpcString(slot[fields::Chain::name_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Chain::address) ? json::AsRpcString(slot[fields::Chain::address_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Chain::parent) ? json::AsRpcString(slot[fields::Chain::parent_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Chain::height) ? json::AsUInt32(slot[fields::Chain::height_index].Get(), jsonErr) : 0, 
+		(selected & fields::Chain::organization) ? json::AsRpcString(slot[fields::Chain::organization_index].Get(), jsonErr) : RpcString(), 
+		std::move(contractsVector), 
+		std::move(dappsVector)
 	};
 }
 
-PHANTASMA_FUNCTION Event PhantasmaJsonAPI::DeserializeEvent(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION Event PhantasmaJsonAPI::DeserializeEvent(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Event) : fields::Event::All;
+	json::JSONSlot slot[fields::Event::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Event::Keys(), fields::Event::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("address")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("address")) ) { slot[fields::Event::address_index] = json::ObjectValue(it, jsonErr); found |= fields::Event::address; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("contract")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("contract")) ) { slot[fields::Event::contract_index] = json::ObjectValue(it, jsonErr); found |= fields::Event::contract; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("kind")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("kind")) ) { slot[fields::Event::kind_index] = json::ObjectValue(it, jsonErr); found |= fields::Event::kind; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("data")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("data")) ) { slot[fields::Event::data_index] = json::ObjectValue(it, jsonErr); found |= fields::Event::data; } break;
+		}
+	}	
 	return Event { 
-		json::LookupString(value, PHANTASMA_LITERAL("address"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("contract"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("kind"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("data"), jsonErr)
+		(selected & fields::Event::address) ? json::AsRpcString(slot[fields::Event::address_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Event::contract) ? json::AsRpcString(slot[fields::Event::contract_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Event::kind) ? json::AsRpcString(slot[fields::Event::kind_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Event::data) ? json::AsRpcString(slot[fields::Event::data_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION Oracle PhantasmaJsonAPI::DeserializeOracle(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION Oracle PhantasmaJsonAPI::DeserializeOracle(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Oracle) : fields::Oracle::All;
+	json::JSONSlot slot[fields::Oracle::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Oracle::Keys(), fields::Oracle::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("url")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("url")) ) { slot[fields::Oracle::url_index] = json::ObjectValue(it, jsonErr); found |= fields::Oracle::url; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("content")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("content")) ) { slot[fields::Oracle::content_index] = json::ObjectValue(it, jsonErr); found |= fields::Oracle::content; } break;
+		}
+	}	
 	return Oracle { 
-		json::LookupString(value, PHANTASMA_LITERAL("url"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("content"), jsonErr)
+		(selected & fields::Oracle::url) ? json::AsRpcString(slot[fields::Oracle::url_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Oracle::content) ? json::AsRpcString(slot[fields::Oracle::content_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION Signature PhantasmaJsonAPI::DeserializeSignature(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION Signature PhantasmaJsonAPI::DeserializeSignature(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Signature) : fields::Signature::All;
+	json::JSONSlot slot[fields::Signature::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Signature::Keys(), fields::Signature::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("Kind")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("Kind")) ) { slot[fields::Signature::Kind_index] = json::ObjectValue(it, jsonErr); found |= fields::Signature::Kind; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("Data")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("Data")) ) { slot[fields::Signature::Data_index] = json::ObjectValue(it, jsonErr); found |= fields::Signature::Data; } break;
+		}
+	}	
 	return Signature { 
-		json::LookupString(value, PHANTASMA_LITERAL("Kind"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("Data"), jsonErr)
+		(selected & fields::Signature::Kind) ? json::AsRpcString(slot[fields::Signature::Kind_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Signature::Data) ? json::AsRpcString(slot[fields::Signature::Data_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION Transaction PhantasmaJsonAPI::DeserializeTransaction(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Transaction PhantasmaJsonAPI::DeserializeTransaction(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<Event> eventsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("events"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Transaction) : fields::Transaction::All;
+	json::JSONSlot slot[fields::Transaction::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Transaction::Keys(), fields::Transaction::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("hash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("hash")) ) { slot[fields::Transaction::hash_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::hash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("chainAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("chainAddress")) ) { slot[fields::Transaction::chainAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::chainAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("timestamp")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("timestamp")) ) { slot[fields::Transaction::timestamp_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::timestamp; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("blockHeight")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("blockHeight")) ) { slot[fields::Transaction::blockHeight_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::blockHeight; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("blockHash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("blockHash")) ) { slot[fields::Transaction::blockHash_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::blockHash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("script")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("script")) ) { slot[fields::Transaction::script_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::script; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("payload")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("payload")) ) { slot[fields::Transaction::payload_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::payload; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("events")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("events")) ) { slot[fields::Transaction::events_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::events; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("result")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("result")) ) { slot[fields::Transaction::result_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::result; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("fee")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("fee")) ) { slot[fields::Transaction::fee_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::fee; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("signatures")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("signatures")) ) { slot[fields::Transaction::signatures_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::signatures; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("expiration")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("expiration")) ) { slot[fields::Transaction::expiration_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::expiration; } break;
+		}
+	}
+	RpcVector<Event> eventsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Transaction::events) && json::IsArray(slot[fields::Transaction::events_index].Get(), jsonErr))
 	{
-		const JSONArray& eventsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("events"), jsonErr);
+		const JSONArray& eventsJsonArray = json::AsArray(slot[fields::Transaction::events_index].Get(), jsonErr);
 		int size = json::ArraySize(eventsJsonArray, jsonErr);
 		eventsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(eventsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			eventsVector.push_back(DeserializeEvent(json::IndexArray(eventsJsonArray, i, jsonErr), jsonErr));
+			eventsVector.push_back(DeserializeEvent(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}
-	PHANTASMA_VECTOR<Signature> signaturesVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("signatures"), jsonErr))
+	RpcVector<Signature> signaturesVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Transaction::signatures) && json::IsArray(slot[fields::Transaction::signatures_index].Get(), jsonErr))
 	{
-		const JSONArray& signaturesJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("signatures"), jsonErr);
+		const JSONArray& signaturesJsonArray = json::AsArray(slot[fields::Transaction::signatures_index].Get(), jsonErr);
 		int size = json::ArraySize(signaturesJsonArray, jsonErr);
 		signaturesVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(signaturesJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			signaturesVector.push_back(DeserializeSignature(json::IndexArray(signaturesJsonArray, i, jsonErr), jsonErr));
+			signaturesVector.push_back(DeserializeSignature(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}	
 	return Transaction { 
-		json::LookupString(value, PHANTASMA_LITERAL("hash"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("chainAddress"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("timestamp"), jsonErr), 
-		json::LookupInt32(value, PHANTASMA_LITERAL("blockHeight"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("blockHash"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("script"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("payload"), jsonErr), 
-		eventsVector, 
-		json::LookupString(value, PHANTASMA_LITERAL("result"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("fee"), jsonErr), 
-		signaturesVector, 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("expiration"), jsonErr)
+		(selected & fields::Transaction::hash) ? json::AsRpcString(slot[fields::Transaction::hash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::chainAddress) ? json::AsRpcString(slot[fields::Transaction::chainAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::timestamp) ? json::AsUInt32(slot[fields::Transaction::timestamp_index].Get(), jsonErr) : 0, 
+		(selected & fields::Transaction::blockHeight) ? json::AsInt32(slot[fields::Transaction::blockHeight_index].Get(), jsonErr) : 0, 
+		(selected & fields::Transaction::blockHash) ? json::AsRpcString(slot[fields::Transaction::blockHash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::script) ? json::AsRpcString(slot[fields::Transaction::script_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::payload) ? json::AsRpcString(slot[fields::Transaction::payload_index].Get(), jsonErr) : RpcString(), 
+		std::move(eventsVector), 
+		(selected & fields::Transaction::result) ? json::AsRpcString(slot[fields::Transaction::result_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::fee) ? json::AsRpcString(slot[fields::Transaction::fee_index].Get(), jsonErr) : RpcString(), 
+		std::move(signaturesVector), 
+		(selected & fields::Transaction::expiration) ? json::AsUInt32(slot[fields::Transaction::expiration_index].Get(), jsonErr) : 0
 	};
 }
 
-PHANTASMA_FUNCTION AccountTransactions PhantasmaJsonAPI::DeserializeAccountTransactions(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION AccountTransactions PhantasmaJsonAPI::DeserializeAccountTransactions(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<Transaction> txsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("txs"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::AccountTransactions) : fields::AccountTransactions::All;
+	json::JSONSlot slot[fields::AccountTransactions::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::AccountTransactions::Keys(), fields::AccountTransactions::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("address")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("address")) ) { slot[fields::AccountTransactions::address_index] = json::ObjectValue(it, jsonErr); found |= fields::AccountTransactions::address; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("txs")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("txs")) ) { slot[fields::AccountTransactions::txs_index] = json::ObjectValue(it, jsonErr); found |= fields::AccountTransactions::txs; } break;
+		}
+	}
+	RpcVector<Transaction> txsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::AccountTransactions::txs) && json::IsArray(slot[fields::AccountTransactions::txs_index].Get(), jsonErr))
 	{
-		const JSONArray& txsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("txs"), jsonErr);
+		const JSONArray& txsJsonArray = json::AsArray(slot[fields::AccountTransactions::txs_index].Get(), jsonErr);
 		int size = json::ArraySize(txsJsonArray, jsonErr);
 		txsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(txsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			txsVector.push_back(DeserializeTransaction(json::IndexArray(txsJsonArray, i, jsonErr), jsonErr));
+			txsVector.push_back(DeserializeTransaction(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}	
 	return AccountTransactions { 
-		json::LookupString(value, PHANTASMA_LITERAL("address"), jsonErr), 
-		txsVector
+		(selected & fields::AccountTransactions::address) ? json::AsRpcString(slot[fields::AccountTransactions::address_index].Get(), jsonErr) : RpcString(), 
+		std::move(txsVector)
 	};
 }
 
-PHANTASMA_FUNCTION Paginated PhantasmaJsonAPI::DeserializePaginated(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION Paginated PhantasmaJsonAPI::DeserializePaginated(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Paginated) : fields::Paginated::All;
+	json::JSONSlot slot[fields::Paginated::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Paginated::Keys(), fields::Paginated::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("page")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("page")) ) { slot[fields::Paginated::page_index] = json::ObjectValue(it, jsonErr); found |= fields::Paginated::page; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("pageSize")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("pageSize")) ) { slot[fields::Paginated::pageSize_index] = json::ObjectValue(it, jsonErr); found |= fields::Paginated::pageSize; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("total")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("total")) ) { slot[fields::Paginated::total_index] = json::ObjectValue(it, jsonErr); found |= fields::Paginated::total; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("totalPages")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("totalPages")) ) { slot[fields::Paginated::totalPages_index] = json::ObjectValue(it, jsonErr); found |= fields::Paginated::totalPages; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("result")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("result")) ) { slot[fields::Paginated::result_index] = json::ObjectValue(it, jsonErr); found |= fields::Paginated::result; } break;
+		}
+	}	
 	return Paginated { 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("page"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("pageSize"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("total"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("totalPages"), jsonErr), 
-		json::LookupValue(value, PHANTASMA_LITERAL("result"), jsonErr)
+		(selected & fields::Paginated::page) ? json::AsUInt32(slot[fields::Paginated::page_index].Get(), jsonErr) : 0, 
+		(selected & fields::Paginated::pageSize) ? json::AsUInt32(slot[fields::Paginated::pageSize_index].Get(), jsonErr) : 0, 
+		(selected & fields::Paginated::total) ? json::AsUInt32(slot[fields::Paginated::total_index].Get(), jsonErr) : 0, 
+		(selected & fields::Paginated::totalPages) ? json::AsUInt32(slot[fields::Paginated::totalPages_index].Get(), jsonErr) : 0, 
+		slot[fields::Paginated::result_index].Get()
 	};
 }
 
-PHANTASMA_FUNCTION Block PhantasmaJsonAPI::DeserializeBlock(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Block PhantasmaJsonAPI::DeserializeBlock(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<Transaction> txsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("txs"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Block) : fields::Block::All;
+	json::JSONSlot slot[fields::Block::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Block::Keys(), fields::Block::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("hash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("hash")) ) { slot[fields::Block::hash_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::hash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("previousHash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("previousHash")) ) { slot[fields::Block::previousHash_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::previousHash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("timestamp")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("timestamp")) ) { slot[fields::Block::timestamp_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::timestamp; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("height")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("height")) ) { slot[fields::Block::height_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::height; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("chainAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("chainAddress")) ) { slot[fields::Block::chainAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::chainAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("protocol")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("protocol")) ) { slot[fields::Block::protocol_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::protocol; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("txs")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("txs")) ) { slot[fields::Block::txs_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::txs; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("validatorAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("validatorAddress")) ) { slot[fields::Block::validatorAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::validatorAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("reward")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("reward")) ) { slot[fields::Block::reward_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::reward; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("events")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("events")) ) { slot[fields::Block::events_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::events; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("oracles")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("oracles")) ) { slot[fields::Block::oracles_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::oracles; } break;
+		}
+	}
+	RpcVector<Transaction> txsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Block::txs) && json::IsArray(slot[fields::Block::txs_index].Get(), jsonErr))
 	{
-		const JSONArray& txsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("txs"), jsonErr);
+		const JSONArray& txsJsonArray = json::AsArray(slot[fields::Block::txs_index].Get(), jsonErr);
 		int size = json::ArraySize(txsJsonArray, jsonErr);
 		txsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(txsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			txsVector.push_back(DeserializeTransaction(json::IndexArray(txsJsonArray, i, jsonErr), jsonErr));
+			txsVector.push_back(DeserializeTransaction(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}
-	PHANTASMA_VECTOR<Event> eventsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("events"), jsonErr))
+	RpcVector<Event> eventsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Block::events) && json::IsArray(slot[fields::Block::events_index].Get(), jsonErr))
 	{
-		const JSONArray& eventsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("events"), jsonErr);
+		const JSONArray& eventsJsonArray = json::AsArray(slot[fields::Block::events_index].Get(), jsonErr);
 		int size = json::ArraySize(eventsJsonArray, jsonErr);
 		eventsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(eventsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			eventsVector.push_back(DeserializeEvent(json::IndexArray(eventsJsonArray, i, jsonErr), jsonErr));
+			eventsVector.push_back(DeserializeEvent(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}
-	PHANTASMA_VECTOR<Oracle> oraclesVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("oracles"), jsonErr))
+	RpcVector<Oracle> oraclesVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Block::oracles) && json::IsArray(slot[fields::Block::oracles_index].Get(), jsonErr))
 	{
-		const JSONArray& oraclesJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("oracles"), jsonErr);
+		const JSONArray& oraclesJsonArray = json::AsArray(slot[fields::Block::oracles_index].Get(), jsonErr);
 		int size = json::ArraySize(oraclesJsonArray, jsonErr);
 		oraclesVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(oraclesJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			oraclesVector.push_back(DeserializeOracle(json::IndexArray(oraclesJsonArray, i, jsonErr), jsonErr));
+			oraclesVector.push_back(DeserializeOracle(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}	
 	return Block { 
-		json::LookupString(value, PHANTASMA_LITERAL("hash"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("previousHash"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("timestamp"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("height"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("chainAddress"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("protocol"), jsonErr), 
-		txsVector, 
-		json::LookupString(value, PHANTASMA_LITERAL("validatorAddress"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("reward"), jsonErr), 
-		eventsVector, 
-		oraclesVector
+		(selected & fields::Block::hash) ? json::AsRpcString(slot[fields::Block::hash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Block::previousHash) ? json::AsRpcString(slot[fields::Block::previousHash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Block::timestamp) ? json::AsUInt32(slot[fields::Block::timestamp_index].Get(), jsonErr) : 0, 
+		(selected & fields::Block::height) ? json::AsUInt32(slot[fields::Block::height_index].Get(), jsonErr) : 0, 
+		(selected & fields::Block::chainAddress) ? json::AsRpcString(slot[fields::Block::chainAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Block::protocol) ? json::AsUInt32(slot[fields::Block::protocol_index].Get(), jsonErr) : 0, 
+		std::move(txsVector), 
+		(selected & fields::Block::validatorAddress) ? json::AsRpcString(slot[fields::Block::validatorAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Block::reward) ? json::AsRpcString(slot[fields::Block::reward_index].Get(), jsonErr) : RpcString(), 
+		std::move(eventsVector), 
+		std::move(oraclesVector)
 	};
 }
 
-PHANTASMA_FUNCTION Token PhantasmaJsonAPI::DeserializeToken(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Token PhantasmaJsonAPI::DeserializeToken(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<TokenSeries> seriesVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("series"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Token) : fields::Token::All;
+	json::JSONSlot slot[fields::Token::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Token::Keys(), fields::Token::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("symbol")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("symbol")) ) { slot[fields::Token::symbol_index] = json::ObjectValue(it, jsonErr); found |= fields::Token::symbol; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::Token::name_index] = json::ObjectValue(it, jsonErr); found |= fields::Token::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("decimals")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("decimals")) ) { slot[fields::Token::decimals_index] = json::ObjectValue(it, jsonErr); found |= fields::Token::decimals; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("currentSupply")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("currentSupply")) ) { slot[fields::Token::currentSupply_index] = json::ObjectValue(it, jsonErr); found |= fields::Token::currentSupply; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("maxSupply")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("maxSupply")) ) { slot[fields::Token::maxSupply_index] = json::ObjectValue(it, jsonErr); found |= fields::Token::maxSupply; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("address")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("address")) ) { slot[fields::Token::address_index] = json::ObjectValue(it, jsonErr); found |= fields::Token::address; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("owner")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("owner")) ) { slot[fields::Token::owner_index] = json::ObjectValue(it, jsonErr); found |= fields::Token::owner; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("flags")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("flags")) ) { slot[fields::Token::flags_index] = json::ObjectValue(it, jsonErr); found |= fields::Token::flags; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("script")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("script")) ) { slot[fields::Token::script_index] = json::ObjectValue(it, jsonErr); found |= fields::Token::script; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("series")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("series")) ) { slot[fields::Token::series_index] = json::ObjectValue(it, jsonErr); found |= fields::Token::series; } break;
+		}
+	}
+	RpcVector<TokenSeries> seriesVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Token::series) && json::IsArray(slot[fields::Token::series_index].Get(), jsonErr))
 	{
-		const JSONArray& seriesJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("series"), jsonErr);
+		const JSONArray& seriesJsonArray = json::AsArray(slot[fields::Token::series_index].Get(), jsonErr);
 		int size = json::ArraySize(seriesJsonArray, jsonErr);
 		seriesVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(seriesJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			seriesVector.push_back(DeserializeTokenSeries(json::IndexArray(seriesJsonArray, i, jsonErr), jsonErr));
+			seriesVector.push_back(DeserializeTokenSeries(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}	
 	return Token { 
-		json::LookupString(value, PHANTASMA_LITERAL("symbol"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		json::LookupInt32(value, PHANTASMA_LITERAL("decimals"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("currentSupply"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("maxSupply"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("address"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("owner"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("flags"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("script"), jsonErr), 
-		seriesVector
+		(selected & fields::Token::symbol) ? json::AsRpcString(slot[fields::Token::symbol_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Token::name) ? json::AsRpcString(slot[fields::Token::name_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Token::decimals) ? json::AsInt32(slot[fields::Token::decimals_index].Get(), jsonErr) : 0, 
+		(selected & fields::Token::currentSupply) ? json::AsRpcString(slot[fields::Token::currentSupply_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Token::maxSupply) ? json::AsRpcString(slot[fields::Token::maxSupply_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Token::address) ? json::AsRpcString(slot[fields::Token::address_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Token::owner) ? json::AsRpcString(slot[fields::Token::owner_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Token::flags) ? json::AsRpcString(slot[fields::Token::flags_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Token::script) ? json::AsRpcString(slot[fields::Token::script_index].Get(), jsonErr) : RpcString(), 
+		std::move(seriesVector)
 	};
 }
 
-PHANTASMA_FUNCTION TokenSeries PhantasmaJsonAPI::DeserializeTokenSeries(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION TokenSeries PhantasmaJsonAPI::DeserializeTokenSeries(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<ABIMethod> methodsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("methods"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::TokenSeries) : fields::TokenSeries::All;
+	json::JSONSlot slot[fields::TokenSeries::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::TokenSeries::Keys(), fields::TokenSeries::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("seriesID")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("seriesID")) ) { slot[fields::TokenSeries::seriesID_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenSeries::seriesID; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("currentSupply")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("currentSupply")) ) { slot[fields::TokenSeries::currentSupply_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenSeries::currentSupply; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("maxSupply")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("maxSupply")) ) { slot[fields::TokenSeries::maxSupply_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenSeries::maxSupply; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("mode")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("mode")) ) { slot[fields::TokenSeries::mode_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenSeries::mode; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("script")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("script")) ) { slot[fields::TokenSeries::script_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenSeries::script; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("methods")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("methods")) ) { slot[fields::TokenSeries::methods_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenSeries::methods; } break;
+		}
+	}
+	RpcVector<ABIMethod> methodsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::TokenSeries::methods) && json::IsArray(slot[fields::TokenSeries::methods_index].Get(), jsonErr))
 	{
-		const JSONArray& methodsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("methods"), jsonErr);
+		const JSONArray& methodsJsonArray = json::AsArray(slot[fields::TokenSeries::methods_index].Get(), jsonErr);
 		int size = json::ArraySize(methodsJsonArray, jsonErr);
 		methodsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(methodsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			methodsVector.push_back(DeserializeABIMethod(json::IndexArray(methodsJsonArray, i, jsonErr), jsonErr));
+			methodsVector.push_back(DeserializeABIMethod(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}	
 	return TokenSeries { 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("seriesID"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("currentSupply"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("maxSupply"), jsonErr), 
-		DeserializeTokenSeriesMode(json::LookupValue(value, PHANTASMA_LITERAL("mode"), jsonErr), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("script"), jsonErr), 
-		methodsVector
+		(selected & fields::TokenSeries::seriesID) ? json::AsUInt32(slot[fields::TokenSeries::seriesID_index].Get(), jsonErr) : 0, 
+		(selected & fields::TokenSeries::currentSupply) ? json::AsRpcString(slot[fields::TokenSeries::currentSupply_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::TokenSeries::maxSupply) ? json::AsRpcString(slot[fields::TokenSeries::maxSupply_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::TokenSeries::mode) ? DeserializeTokenSeriesMode(slot[fields::TokenSeries::mode_index].Get(), jsonErr, projection) : TokenSeriesMode(), 
+		(selected & fields::TokenSeries::script) ? json::AsRpcString(slot[fields::TokenSeries::script_index].Get(), jsonErr) : RpcString(), 
+		std::move(methodsVector)
 	};
 }
 
-PHANTASMA_FUNCTION TokenProperty PhantasmaJsonAPI::DeserializeTokenProperty(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION TokenProperty PhantasmaJsonAPI::DeserializeTokenProperty(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::TokenProperty) : fields::TokenProperty::All;
+	json::JSONSlot slot[fields::TokenProperty::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::TokenProperty::Keys(), fields::TokenProperty::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("Key")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("Key")) ) { slot[fields::TokenProperty::Key_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenProperty::Key; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("Value")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("Value")) ) { slot[fields::TokenProperty::Value_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenProperty::Value; } break;
+		}
+	}	
 	return TokenProperty { 
-		json::LookupString(value, PHANTASMA_LITERAL("Key"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("Value"), jsonErr)
+		(selected & fields::TokenProperty::Key) ? json::AsRpcString(slot[fields::TokenProperty::Key_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::TokenProperty::Value) ? json::AsRpcString(slot[fields::TokenProperty::Value_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION TokenData PhantasmaJsonAPI::DeserializeTokenData(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION TokenData PhantasmaJsonAPI::DeserializeTokenData(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<TokenProperty> infusionVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("infusion"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::TokenData) : fields::TokenData::All;
+	json::JSONSlot slot[fields::TokenData::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::TokenData::Keys(), fields::TokenData::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("ID")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("ID")) ) { slot[fields::TokenData::ID_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenData::ID; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("series")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("series")) ) { slot[fields::TokenData::series_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenData::series; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("mint")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("mint")) ) { slot[fields::TokenData::mint_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenData::mint; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("chainName")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("chainName")) ) { slot[fields::TokenData::chainName_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenData::chainName; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("ownerAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("ownerAddress")) ) { slot[fields::TokenData::ownerAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenData::ownerAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("creatorAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("creatorAddress")) ) { slot[fields::TokenData::creatorAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenData::creatorAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("ram")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("ram")) ) { slot[fields::TokenData::ram_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenData::ram; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("rom")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("rom")) ) { slot[fields::TokenData::rom_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenData::rom; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("status")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("status")) ) { slot[fields::TokenData::status_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenData::status; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("infusion")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("infusion")) ) { slot[fields::TokenData::infusion_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenData::infusion; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("properties")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("properties")) ) { slot[fields::TokenData::properties_index] = json::ObjectValue(it, jsonErr); found |= fields::TokenData::properties; } break;
+		}
+	}
+	RpcVector<TokenProperty> infusionVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::TokenData::infusion) && json::IsArray(slot[fields::TokenData::infusion_index].Get(), jsonErr))
 	{
-		const JSONArray& infusionJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("infusion"), jsonErr);
+		const JSONArray& infusionJsonArray = json::AsArray(slot[fields::TokenData::infusion_index].Get(), jsonErr);
 		int size = json::ArraySize(infusionJsonArray, jsonErr);
 		infusionVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(infusionJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			infusionVector.push_back(DeserializeTokenProperty(json::IndexArray(infusionJsonArray, i, jsonErr), jsonErr));
+			infusionVector.push_back(DeserializeTokenProperty(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}
-	PHANTASMA_VECTOR<TokenProperty> propertiesVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("properties"), jsonErr))
+	RpcVector<TokenProperty> propertiesVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::TokenData::properties) && json::IsArray(slot[fields::TokenData::properties_index].Get(), jsonErr))
 	{
-		const JSONArray& propertiesJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("properties"), jsonErr);
+		const JSONArray& propertiesJsonArray = json::AsArray(slot[fields::TokenData::properties_index].Get(), jsonErr);
 		int size = json::ArraySize(propertiesJsonArray, jsonErr);
 		propertiesVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(propertiesJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			propertiesVector.push_back(DeserializeTokenProperty(json::IndexArray(propertiesJsonArray, i, jsonErr), jsonErr));
+			propertiesVector.push_back(DeserializeTokenProperty(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}	
 	return TokenData { 
-		json::LookupString(value, PHANTASMA_LITERAL("ID"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("series"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("mint"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("chainName"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("ownerAddress"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("creatorAddress"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("ram"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("rom"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("status"), jsonErr), 
-		infusionVector, 
-		propertiesVector
+		(selected & fields::TokenData::ID) ? json::AsRpcString(slot[fields::TokenData::ID_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::TokenData::series) ? json::AsRpcString(slot[fields::TokenData::series_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::TokenData::mint) ? json::AsRpcString(slot[fields::TokenData::mint_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::TokenData::chainName) ? json::AsRpcString(slot[fields::TokenData::chainName_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::TokenData::ownerAddress) ? json::AsRpcString(slot[fields::TokenData::ownerAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::TokenData::creatorAddress) ? json::AsRpcString(slot[fields::TokenData::creatorAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::TokenData::ram) ? json::AsRpcString(slot[fields::TokenData::ram_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::TokenData::rom) ? json::AsRpcString(slot[fields::TokenData::rom_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::TokenData::status) ? json::AsRpcString(slot[fields::TokenData::status_index].Get(), jsonErr) : RpcString(), 
+		std::move(infusionVector), 
+		std::move(propertiesVector)
 	};
 }
 
-PHANTASMA_FUNCTION SendRawTx PhantasmaJsonAPI::DeserializeSendRawTx(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION SendRawTx PhantasmaJsonAPI::DeserializeSendRawTx(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::SendRawTx) : fields::SendRawTx::All;
+	json::JSONSlot slot[fields::SendRawTx::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::SendRawTx::Keys(), fields::SendRawTx::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("hash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("hash")) ) { slot[fields::SendRawTx::hash_index] = json::ObjectValue(it, jsonErr); found |= fields::SendRawTx::hash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("error")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("error")) ) { slot[fields::SendRawTx::error_index] = json::ObjectValue(it, jsonErr); found |= fields::SendRawTx::error; } break;
+		}
+	}	
 	return SendRawTx { 
-		json::LookupString(value, PHANTASMA_LITERAL("hash"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("error"), jsonErr)
+		(selected & fields::SendRawTx::hash) ? json::AsRpcString(slot[fields::SendRawTx::hash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::SendRawTx::error) ? json::AsRpcString(slot[fields::SendRawTx::error_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION Auction PhantasmaJsonAPI::DeserializeAuction(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION Auction PhantasmaJsonAPI::DeserializeAuction(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Auction) : fields::Auction::All;
+	json::JSONSlot slot[fields::Auction::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Auction::Keys(), fields::Auction::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("creatorAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("creatorAddress")) ) { slot[fields::Auction::creatorAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Auction::creatorAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("chainAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("chainAddress")) ) { slot[fields::Auction::chainAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Auction::chainAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("startDate")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("startDate")) ) { slot[fields::Auction::startDate_index] = json::ObjectValue(it, jsonErr); found |= fields::Auction::startDate; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("endDate")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("endDate")) ) { slot[fields::Auction::endDate_index] = json::ObjectValue(it, jsonErr); found |= fields::Auction::endDate; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("baseSymbol")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("baseSymbol")) ) { slot[fields::Auction::baseSymbol_index] = json::ObjectValue(it, jsonErr); found |= fields::Auction::baseSymbol; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("quoteSymbol")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("quoteSymbol")) ) { slot[fields::Auction::quoteSymbol_index] = json::ObjectValue(it, jsonErr); found |= fields::Auction::quoteSymbol; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("tokenId")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("tokenId")) ) { slot[fields::Auction::tokenId_index] = json::ObjectValue(it, jsonErr); found |= fields::Auction::tokenId; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("price")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("price")) ) { slot[fields::Auction::price_index] = json::ObjectValue(it, jsonErr); found |= fields::Auction::price; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("rom")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("rom")) ) { slot[fields::Auction::rom_index] = json::ObjectValue(it, jsonErr); found |= fields::Auction::rom; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("ram")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("ram")) ) { slot[fields::Auction::ram_index] = json::ObjectValue(it, jsonErr); found |= fields::Auction::ram; } break;
+		}
+	}	
 	return Auction { 
-		json::LookupString(value, PHANTASMA_LITERAL("creatorAddress"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("chainAddress"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("startDate"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("endDate"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("baseSymbol"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("quoteSymbol"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("tokenId"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("price"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("rom"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("ram"), jsonErr)
+		(selected & fields::Auction::creatorAddress) ? json::AsRpcString(slot[fields::Auction::creatorAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Auction::chainAddress) ? json::AsRpcString(slot[fields::Auction::chainAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Auction::startDate) ? json::AsUInt32(slot[fields::Auction::startDate_index].Get(), jsonErr) : 0, 
+		(selected & fields::Auction::endDate) ? json::AsUInt32(slot[fields::Auction::endDate_index].Get(), jsonErr) : 0, 
+		(selected & fields::Auction::baseSymbol) ? json::AsRpcString(slot[fields::Auction::baseSymbol_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Auction::quoteSymbol) ? json::AsRpcString(slot[fields::Auction::quoteSymbol_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Auction::tokenId) ? json::AsRpcString(slot[fields::Auction::tokenId_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Auction::price) ? json::AsRpcString(slot[fields::Auction::price_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Auction::rom) ? json::AsRpcString(slot[fields::Auction::rom_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Auction::ram) ? json::AsRpcString(slot[fields::Auction::ram_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION Script PhantasmaJsonAPI::DeserializeScript(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Script PhantasmaJsonAPI::DeserializeScript(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<Event> eventsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("events"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Script) : fields::Script::All;
+	json::JSONSlot slot[fields::Script::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Script::Keys(), fields::Script::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("events")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("events")) ) { slot[fields::Script::events_index] = json::ObjectValue(it, jsonErr); found |= fields::Script::events; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("result")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("result")) ) { slot[fields::Script::result_index] = json::ObjectValue(it, jsonErr); found |= fields::Script::result; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("results")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("results")) ) { slot[fields::Script::results_index] = json::ObjectValue(it, jsonErr); found |= fields::Script::results; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("oracles")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("oracles")) ) { slot[fields::Script::oracles_index] = json::ObjectValue(it, jsonErr); found |= fields::Script::oracles; } break;
+		}
+	}
+	RpcVector<Event> eventsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Script::events) && json::IsArray(slot[fields::Script::events_index].Get(), jsonErr))
 	{
-		const JSONArray& eventsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("events"), jsonErr);
+		const JSONArray& eventsJsonArray = json::AsArray(slot[fields::Script::events_index].Get(), jsonErr);
 		int size = json::ArraySize(eventsJsonArray, jsonErr);
 		eventsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(eventsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			eventsVector.push_back(DeserializeEvent(json::IndexArray(eventsJsonArray, i, jsonErr), jsonErr));
+			eventsVector.push_back(DeserializeEvent(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}
-	PHANTASMA_VECTOR<String> resultsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("results"), jsonErr))
+	RpcVector<RpcString> resultsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Script::results) && json::IsArray(slot[fields::Script::results_index].Get(), jsonErr))
 	{
-		const JSONArray& resultsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("results"), jsonErr);
+		const JSONArray& resultsJsonArray = json::AsArray(slot[fields::Script::results_index].Get(), jsonErr);
 		int size = json::ArraySize(resultsJsonArray, jsonErr);
 		resultsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(resultsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			resultsVector.push_back(json::AsString(json::IndexArray(resultsJsonArray, i, jsonErr), jsonErr));
+			resultsVector.push_back(json::AsRpcString(json::ArrayValue(it, jsonErr), jsonErr));
 		}
 	}
-	PHANTASMA_VECTOR<Oracle> oraclesVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("oracles"), jsonErr))
+	RpcVector<Oracle> oraclesVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Script::oracles) && json::IsArray(slot[fields::Script::oracles_index].Get(), jsonErr))
 	{
-		const JSONArray& oraclesJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("oracles"), jsonErr);
+		const JSONArray& oraclesJsonArray = json::AsArray(slot[fields::Script::oracles_index].Get(), jsonErr);
 		int size = json::ArraySize(oraclesJsonArray, jsonErr);
 		oraclesVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(oraclesJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			oraclesVector.push_back(DeserializeOracle(json::IndexArray(oraclesJsonArray, i, jsonErr), jsonErr));
+			oraclesVector.push_back(DeserializeOracle(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}	
 	return Script { 
-		eventsVector, 
-		json::LookupString(value, PHANTASMA_LITERAL("result"), jsonErr), 
-		resultsVector, 
-		oraclesVector
+		std::move(eventsVector), 
+		(selected & fields::Script::result) ? json::AsRpcString(slot[fields::Script::result_index].Get(), jsonErr) : RpcString(), 
+		std::move(resultsVector), 
+		std::move(oraclesVector)
 	};
 }
 
-PHANTASMA_FUNCTION Archive PhantasmaJsonAPI::DeserializeArchive(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Archive PhantasmaJsonAPI::DeserializeArchive(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<Int32> missingBlocksVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("missingBlocks"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Archive) : fields::Archive::All;
+	json::JSONSlot slot[fields::Archive::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Archive::Keys(), fields::Archive::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::Archive::name_index] = json::ObjectValue(it, jsonErr); found |= fields::Archive::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("hash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("hash")) ) { slot[fields::Archive::hash_index] = json::ObjectValue(it, jsonErr); found |= fields::Archive::hash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("time")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("time")) ) { slot[fields::Archive::time_index] = json::ObjectValue(it, jsonErr); found |= fields::Archive::time; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("size")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("size")) ) { slot[fields::Archive::size_index] = json::ObjectValue(it, jsonErr); found |= fields::Archive::size; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("encryption")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("encryption")) ) { slot[fields::Archive::encryption_index] = json::ObjectValue(it, jsonErr); found |= fields::Archive::encryption; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("blockCount")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("blockCount")) ) { slot[fields::Archive::blockCount_index] = json::ObjectValue(it, jsonErr); found |= fields::Archive::blockCount; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("missingBlocks")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("missingBlocks")) ) { slot[fields::Archive::missingBlocks_index] = json::ObjectValue(it, jsonErr); found |= fields::Archive::missingBlocks; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("owners")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("owners")) ) { slot[fields::Archive::owners_index] = json::ObjectValue(it, jsonErr); found |= fields::Archive::owners; } break;
+		}
+	}
+	RpcVector<Int32> missingBlocksVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Archive::missingBlocks) && json::IsArray(slot[fields::Archive::missingBlocks_index].Get(), jsonErr))
 	{
-		const JSONArray& missingBlocksJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("missingBlocks"), jsonErr);
+		const JSONArray& missingBlocksJsonArray = json::AsArray(slot[fields::Archive::missingBlocks_index].Get(), jsonErr);
 		int size = json::ArraySize(missingBlocksJsonArray, jsonErr);
 		missingBlocksVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(missingBlocksJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			missingBlocksVector.push_back(DeserializeInt32(json::IndexArray(missingBlocksJsonArray, i, jsonErr), jsonErr));
+			missingBlocksVector.push_back(DeserializeInt32(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}
-	PHANTASMA_VECTOR<String> ownersVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("owners"), jsonErr))
+	RpcVector<RpcString> ownersVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Archive::owners) && json::IsArray(slot[fields::Archive::owners_index].Get(), jsonErr))
 	{
-		const JSONArray& ownersJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("owners"), jsonErr);
+		const JSONArray& ownersJsonArray = json::AsArray(slot[fields::Archive::owners_index].Get(), jsonErr);
 		int size = json::ArraySize(ownersJsonArray, jsonErr);
 		ownersVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(ownersJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			ownersVector.push_back(json::AsString(json::IndexArray(ownersJsonArray, i, jsonErr), jsonErr));
+			ownersVector.push_back(json::AsRpcString(json::ArrayValue(it, jsonErr), jsonErr));
 		}
 	}	
 	return Archive { 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("hash"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("time"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("size"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("encryption"), jsonErr), 
-		json::LookupInt32(value, PHANTASMA_LITERAL("blockCount"), jsonErr), 
-		missingBlocksVector, 
-		ownersVector
+		(selected & fields::Archive::name) ? json::AsRpcString(slot[fields::Archive::name_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Archive::hash) ? json::AsRpcString(slot[fields::Archive::hash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Archive::time) ? json::AsUInt32(slot[fields::Archive::time_index].Get(), jsonErr) : 0, 
+		(selected & fields::Archive::size) ? json::AsUInt32(slot[fields::Archive::size_index].Get(), jsonErr) : 0, 
+		(selected & fields::Archive::encryption) ? json::AsRpcString(slot[fields::Archive::encryption_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Archive::blockCount) ? json::AsInt32(slot[fields::Archive::blockCount_index].Get(), jsonErr) : 0, 
+		std::move(missingBlocksVector), 
+		std::move(ownersVector)
 	};
 }
 
-PHANTASMA_FUNCTION ABIParameter PhantasmaJsonAPI::DeserializeABIParameter(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION ABIParameter PhantasmaJsonAPI::DeserializeABIParameter(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::ABIParameter) : fields::ABIParameter::All;
+	json::JSONSlot slot[fields::ABIParameter::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::ABIParameter::Keys(), fields::ABIParameter::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::ABIParameter::name_index] = json::ObjectValue(it, jsonErr); found |= fields::ABIParameter::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("type")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("type")) ) { slot[fields::ABIParameter::type_index] = json::ObjectValue(it, jsonErr); found |= fields::ABIParameter::type; } break;
+		}
+	}	
 	return ABIParameter { 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("type"), jsonErr)
+		(selected & fields::ABIParameter::name) ? json::AsRpcString(slot[fields::ABIParameter::name_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::ABIParameter::type) ? json::AsRpcString(slot[fields::ABIParameter::type_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION ABIMethod PhantasmaJsonAPI::DeserializeABIMethod(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION ABIMethod PhantasmaJsonAPI::DeserializeABIMethod(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<ABIParameter> parametersVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("parameters"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::ABIMethod) : fields::ABIMethod::All;
+	json::JSONSlot slot[fields::ABIMethod::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::ABIMethod::Keys(), fields::ABIMethod::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::ABIMethod::name_index] = json::ObjectValue(it, jsonErr); found |= fields::ABIMethod::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("returnType")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("returnType")) ) { slot[fields::ABIMethod::returnType_index] = json::ObjectValue(it, jsonErr); found |= fields::ABIMethod::returnType; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("parameters")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("parameters")) ) { slot[fields::ABIMethod::parameters_index] = json::ObjectValue(it, jsonErr); found |= fields::ABIMethod::parameters; } break;
+		}
+	}
+	RpcVector<ABIParameter> parametersVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::ABIMethod::parameters) && json::IsArray(slot[fields::ABIMethod::parameters_index].Get(), jsonErr))
 	{
-		const JSONArray& parametersJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("parameters"), jsonErr);
+		const JSONArray& parametersJsonArray = json::AsArray(slot[fields::ABIMethod::parameters_index].Get(), jsonErr);
 		int size = json::ArraySize(parametersJsonArray, jsonErr);
 		parametersVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(parametersJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			parametersVector.push_back(DeserializeABIParameter(json::IndexArray(parametersJsonArray, i, jsonErr), jsonErr));
+			parametersVector.push_back(DeserializeABIParameter(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}	
 	return ABIMethod { 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("returnType"), jsonErr), 
-		parametersVector
+		(selected & fields::ABIMethod::name) ? json::AsRpcString(slot[fields::ABIMethod::name_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::ABIMethod::returnType) ? json::AsRpcString(slot[fields::ABIMethod::returnType_index].Get(), jsonErr) : RpcString(), 
+		std::move(parametersVector)
 	};
 }
 
-PHANTASMA_FUNCTION ABIEvent PhantasmaJsonAPI::DeserializeABIEvent(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION ABIEvent PhantasmaJsonAPI::DeserializeABIEvent(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::ABIEvent) : fields::ABIEvent::All;
+	json::JSONSlot slot[fields::ABIEvent::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::ABIEvent::Keys(), fields::ABIEvent::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("value")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("value")) ) { slot[fields::ABIEvent::value_index] = json::ObjectValue(it, jsonErr); found |= fields::ABIEvent::value; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::ABIEvent::name_index] = json::ObjectValue(it, jsonErr); found |= fields::ABIEvent::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("returnType")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("returnType")) ) { slot[fields::ABIEvent::returnType_index] = json::ObjectValue(it, jsonErr); found |= fields::ABIEvent::returnType; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("description")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("description")) ) { slot[fields::ABIEvent::description_index] = json::ObjectValue(it, jsonErr); found |= fields::ABIEvent::description; } break;
+		}
+	}	
 	return ABIEvent { 
-		json::LookupInt32(value, PHANTASMA_LITERAL("value"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("returnType"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("description"), jsonErr)
+		(selected & fields::ABIEvent::value) ? json::AsInt32(slot[fields::ABIEvent::value_index].Get(), jsonErr) : 0, 
+		(selected & fields::ABIEvent::name) ? json::AsRpcString(slot[fields::ABIEvent::name_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::ABIEvent::returnType) ? json::AsRpcString(slot[fields::ABIEvent::returnType_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::ABIEvent::description) ? json::AsRpcString(slot[fields::ABIEvent::description_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION Contract PhantasmaJsonAPI::DeserializeContract(const JSONValue& value, bool& jsonErr)
+PHANTASMA_FUNCTION Contract PhantasmaJsonAPI::DeserializeContract(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
 { 
-	PHANTASMA_VECTOR<ABIMethod> methodsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("methods"), jsonErr))
+	const FieldMask selected = projection ? projection->Mask(RpcType::Contract) : fields::Contract::All;
+	json::JSONSlot slot[fields::Contract::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Contract::Keys(), fields::Contract::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::Contract::name_index] = json::ObjectValue(it, jsonErr); found |= fields::Contract::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("address")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("address")) ) { slot[fields::Contract::address_index] = json::ObjectValue(it, jsonErr); found |= fields::Contract::address; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("script")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("script")) ) { slot[fields::Contract::script_index] = json::ObjectValue(it, jsonErr); found |= fields::Contract::script; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("methods")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("methods")) ) { slot[fields::Contract::methods_index] = json::ObjectValue(it, jsonErr); found |= fields::Contract::methods; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("events")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("events")) ) { slot[fields::Contract::events_index] = json::ObjectValue(it, jsonErr); found |= fields::Contract::events; } break;
+		}
+	}
+	RpcVector<ABIMethod> methodsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Contract::methods) && json::IsArray(slot[fields::Contract::methods_index].Get(), jsonErr))
 	{
-		const JSONArray& methodsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("methods"), jsonErr);
+		const JSONArray& methodsJsonArray = json::AsArray(slot[fields::Contract::methods_index].Get(), jsonErr);
 		int size = json::ArraySize(methodsJsonArray, jsonErr);
 		methodsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(methodsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			methodsVector.push_back(DeserializeABIMethod(json::IndexArray(methodsJsonArray, i, jsonErr), jsonErr));
+			methodsVector.push_back(DeserializeABIMethod(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}
-	PHANTASMA_VECTOR<ABIEvent> eventsVector;
-	if(json::HasArrayField(value, PHANTASMA_LITERAL("events"), jsonErr))
+	RpcVector<ABIEvent> eventsVector{PHANTASMA_RPC_ALLOC};
+	if((selected & found & fields::Contract::events) && json::IsArray(slot[fields::Contract::events_index].Get(), jsonErr))
 	{
-		const JSONArray& eventsJsonArray = json::LookupArray(value, PHANTASMA_LITERAL("events"), jsonErr);
+		const JSONArray& eventsJsonArray = json::AsArray(slot[fields::Contract::events_index].Get(), jsonErr);
 		int size = json::ArraySize(eventsJsonArray, jsonErr);
 		eventsVector.reserve(size);
-		for(int i = 0; i < size; ++i)
+		for(JSONArrayCursor it = json::ArrayBegin(eventsJsonArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 		{
-			eventsVector.push_back(DeserializeABIEvent(json::IndexArray(eventsJsonArray, i, jsonErr), jsonErr));
+			eventsVector.push_back(DeserializeABIEvent(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		}
 	}	
 	return Contract { 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("address"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("script"), jsonErr), 
-		methodsVector, 
-		eventsVector
+		(selected & fields::Contract::name) ? json::AsRpcString(slot[fields::Contract::name_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Contract::address) ? json::AsRpcString(slot[fields::Contract::address_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Contract::script) ? json::AsRpcString(slot[fields::Contract::script_index].Get(), jsonErr) : RpcString(), 
+		std::move(methodsVector), 
+		std::move(eventsVector)
 	};
 }
 
-PHANTASMA_FUNCTION Channel PhantasmaJsonAPI::DeserializeChannel(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION Channel PhantasmaJsonAPI::DeserializeChannel(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Channel) : fields::Channel::All;
+	json::JSONSlot slot[fields::Channel::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Channel::Keys(), fields::Channel::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("creatorAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("creatorAddress")) ) { slot[fields::Channel::creatorAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Channel::creatorAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("targetAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("targetAddress")) ) { slot[fields::Channel::targetAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Channel::targetAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("name")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("name")) ) { slot[fields::Channel::name_index] = json::ObjectValue(it, jsonErr); found |= fields::Channel::name; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("chain")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("chain")) ) { slot[fields::Channel::chain_index] = json::ObjectValue(it, jsonErr); found |= fields::Channel::chain; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("creationTime")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("creationTime")) ) { slot[fields::Channel::creationTime_index] = json::ObjectValue(it, jsonErr); found |= fields::Channel::creationTime; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("symbol")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("symbol")) ) { slot[fields::Channel::symbol_index] = json::ObjectValue(it, jsonErr); found |= fields::Channel::symbol; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("fee")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("fee")) ) { slot[fields::Channel::fee_index] = json::ObjectValue(it, jsonErr); found |= fields::Channel::fee; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("balance")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("balance")) ) { slot[fields::Channel::balance_index] = json::ObjectValue(it, jsonErr); found |= fields::Channel::balance; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("active")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("active")) ) { slot[fields::Channel::active_index] = json::ObjectValue(it, jsonErr); found |= fields::Channel::active; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("index")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("index")) ) { slot[fields::Channel::index_index] = json::ObjectValue(it, jsonErr); found |= fields::Channel::index; } break;
+		}
+	}	
 	return Channel { 
-		json::LookupString(value, PHANTASMA_LITERAL("creatorAddress"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("targetAddress"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("name"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("chain"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("creationTime"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("symbol"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("fee"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("balance"), jsonErr), 
-		json::LookupBool(value, PHANTASMA_LITERAL("active"), jsonErr), 
-		json::LookupInt32(value, PHANTASMA_LITERAL("index"), jsonErr)
+		(selected & fields::Channel::creatorAddress) ? json::AsRpcString(slot[fields::Channel::creatorAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Channel::targetAddress) ? json::AsRpcString(slot[fields::Channel::targetAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Channel::name) ? json::AsRpcString(slot[fields::Channel::name_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Channel::chain) ? json::AsRpcString(slot[fields::Channel::chain_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Channel::creationTime) ? json::AsUInt32(slot[fields::Channel::creationTime_index].Get(), jsonErr) : 0, 
+		(selected & fields::Channel::symbol) ? json::AsRpcString(slot[fields::Channel::symbol_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Channel::fee) ? json::AsRpcString(slot[fields::Channel::fee_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Channel::balance) ? json::AsRpcString(slot[fields::Channel::balance_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Channel::active) ? json::AsBool(slot[fields::Channel::active_index].Get(), jsonErr) : false, 
+		(selected & fields::Channel::index) ? json::AsInt32(slot[fields::Channel::index_index].Get(), jsonErr) : 0
 	};
 }
 
-PHANTASMA_FUNCTION Receipt PhantasmaJsonAPI::DeserializeReceipt(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION Receipt PhantasmaJsonAPI::DeserializeReceipt(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Receipt) : fields::Receipt::All;
+	json::JSONSlot slot[fields::Receipt::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Receipt::Keys(), fields::Receipt::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("nexus")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("nexus")) ) { slot[fields::Receipt::nexus_index] = json::ObjectValue(it, jsonErr); found |= fields::Receipt::nexus; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("channel")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("channel")) ) { slot[fields::Receipt::channel_index] = json::ObjectValue(it, jsonErr); found |= fields::Receipt::channel; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("index")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("index")) ) { slot[fields::Receipt::index_index] = json::ObjectValue(it, jsonErr); found |= fields::Receipt::index; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("timestamp")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("timestamp")) ) { slot[fields::Receipt::timestamp_index] = json::ObjectValue(it, jsonErr); found |= fields::Receipt::timestamp; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("sender")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("sender")) ) { slot[fields::Receipt::sender_index] = json::ObjectValue(it, jsonErr); found |= fields::Receipt::sender; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("receiver")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("receiver")) ) { slot[fields::Receipt::receiver_index] = json::ObjectValue(it, jsonErr); found |= fields::Receipt::receiver; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("script")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("script")) ) { slot[fields::Receipt::script_index] = json::ObjectValue(it, jsonErr); found |= fields::Receipt::script; } break;
+		}
+	}	
 	return Receipt { 
-		json::LookupString(value, PHANTASMA_LITERAL("nexus"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("channel"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("index"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("timestamp"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("sender"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("receiver"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("script"), jsonErr)
+		(selected & fields::Receipt::nexus) ? json::AsRpcString(slot[fields::Receipt::nexus_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Receipt::channel) ? json::AsRpcString(slot[fields::Receipt::channel_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Receipt::index) ? json::AsRpcString(slot[fields::Receipt::index_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Receipt::timestamp) ? json::AsUInt32(slot[fields::Receipt::timestamp_index].Get(), jsonErr) : 0, 
+		(selected & fields::Receipt::sender) ? json::AsRpcString(slot[fields::Receipt::sender_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Receipt::receiver) ? json::AsRpcString(slot[fields::Receipt::receiver_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Receipt::script) ? json::AsRpcString(slot[fields::Receipt::script_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION Peer PhantasmaJsonAPI::DeserializePeer(const JSONValue& value, bool& jsonErr)
-{ 	
-	return Peer { 
-		json::LookupString(value, PHANTASMA_LITERAL("url"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("version"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("flags"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("fee"), jsonErr), 
-		json::LookupUInt32(value, PHANTASMA_LITERAL("pow"), jsonErr)
-	};
+PHANTASMA_FUNCTION Peer PhantasmaJsonAPI::DeserializePeer(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Peer) : fields::Peer::All;
+	json::JSONSlot slot[fields::Peer::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Peer::Keys(), fields::Peer::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("url")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("url")) ) { slot[fields::Peer::url_index] = json::ObjectValue(it, jsonErr); found |= fields::Peer::url; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("version")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("version")) ) { slot[fields::Peer::version_index] = json::ObjectValue(it, jsonErr); found |= fields::Peer::version; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("flags")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("flags")) ) { slot[fields::Peer::flags_index] = json::ObjectValue(it, jsonErr); found |= fields::Peer::flags; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("fee")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("fee")) ) { slot[fields::Peer::fee_index] = json::ObjectValue(it, jsonErr); found |= fields::Peer::fee; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("pow")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("pow")) ) { slot[fields::Peer::pow_index] = json::ObjectValue(it, jsonErr); found |= fields::Peer::pow; } break;
+		}
+	}	
+	return Peer { 
+		(selected & fields::Peer::url) ? json::AsRpcString(slot[fields::Peer::url_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Peer::version) ? json::AsRpcString(slot[fields::Peer::version_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Peer::flags) ? json::AsRpcString(slot[fields::Peer::flags_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Peer::fee) ? json::AsRpcString(slot[fields::Peer::fee_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Peer::pow) ? json::AsUInt32(slot[fields::Peer::pow_index].Get(), jsonErr) : 0
+	};
 }
 
-PHANTASMA_FUNCTION Validator PhantasmaJsonAPI::DeserializeValidator(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION Validator PhantasmaJsonAPI::DeserializeValidator(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Validator) : fields::Validator::All;
+	json::JSONSlot slot[fields::Validator::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Validator::Keys(), fields::Validator::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("address")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("address")) ) { slot[fields::Validator::address_index] = json::ObjectValue(it, jsonErr); found |= fields::Validator::address; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("type")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("type")) ) { slot[fields::Validator::type_index] = json::ObjectValue(it, jsonErr); found |= fields::Validator::type; } break;
+		}
+	}	
 	return Validator { 
-		json::LookupString(value, PHANTASMA_LITERAL("address"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("type"), jsonErr)
+		(selected & fields::Validator::address) ? json::AsRpcString(slot[fields::Validator::address_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Validator::type) ? json::AsRpcString(slot[fields::Validator::type_index].Get(), jsonErr) : RpcString()
 	};
 }
 
-PHANTASMA_FUNCTION Swap PhantasmaJsonAPI::DeserializeSwap(const JSONValue& value, bool& jsonErr)
-{ 	
+PHANTASMA_FUNCTION Swap PhantasmaJsonAPI::DeserializeSwap(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{ 
+	const FieldMask selected = projection ? projection->Mask(RpcType::Swap) : fields::Swap::All;
+	json::JSONSlot slot[fields::Swap::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Swap::Keys(), fields::Swap::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{ 
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{ 
+		case json::KeyHash(PHANTASMA_LITERAL("sourcePlatform")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("sourcePlatform")) ) { slot[fields::Swap::sourcePlatform_index] = json::ObjectValue(it, jsonErr); found |= fields::Swap::sourcePlatform; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("sourceChain")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("sourceChain")) ) { slot[fields::Swap::sourceChain_index] = json::ObjectValue(it, jsonErr); found |= fields::Swap::sourceChain; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("sourceHash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("sourceHash")) ) { slot[fields::Swap::sourceHash_index] = json::ObjectValue(it, jsonErr); found |= fields::Swap::sourceHash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("sourceAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("sourceAddress")) ) { slot[fields::Swap::sourceAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Swap::sourceAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("destinationPlatform")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("destinationPlatform")) ) { slot[fields::Swap::destinationPlatform_index] = json::ObjectValue(it, jsonErr); found |= fields::Swap::destinationPlatform; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("destinationChain")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("destinationChain")) ) { slot[fields::Swap::destinationChain_index] = json::ObjectValue(it, jsonErr); found |= fields::Swap::destinationChain; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("destinationHash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("destinationHash")) ) { slot[fields::Swap::destinationHash_index] = json::ObjectValue(it, jsonErr); found |= fields::Swap::destinationHash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("destinationAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("destinationAddress")) ) { slot[fields::Swap::destinationAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Swap::destinationAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("symbol")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("symbol")) ) { slot[fields::Swap::symbol_index] = json::ObjectValue(it, jsonErr); found |= fields::Swap::symbol; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("value")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("value")) ) { slot[fields::Swap::value_index] = json::ObjectValue(it, jsonErr); found |= fields::Swap::value; } break;
+		}
+	}	
 	return Swap { 
-		json::LookupString(value, PHANTASMA_LITERAL("sourcePlatform"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("sourceChain"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("sourceHash"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("sourceAddress"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("destinationPlatform"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("destinationChain"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("destinationHash"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("destinationAddress"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("symbol"), jsonErr), 
-		json::LookupString(value, PHANTASMA_LITERAL("value"), jsonErr)
+		(selected & fields::Swap::sourcePlatform) ? json::AsRpcString(slot[fields::Swap::sourcePlatform_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Swap::sourceChain) ? json::AsRpcString(slot[fields::Swap::sourceChain_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Swap::sourceHash) ? json::AsRpcString(slot[fields::Swap::sourceHash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Swap::sourceAddress) ? json::AsRpcString(slot[fields::Swap::sourceAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Swap::destinationPlatform) ? json::AsRpcString(slot[fields::Swap::destinationPlatform_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Swap::destinationChain) ? json::AsRpcString(slot[fields::Swap::destinationChain_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Swap::destinationHash) ? json::AsRpcString(slot[fields::Swap::destinationHash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Swap::destinationAddress) ? json::AsRpcString(slot[fields::Swap::destinationAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Swap::symbol) ? json::AsRpcString(slot[fields::Swap::symbol_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Swap::value) ? json::AsRpcString(slot[fields::Swap::value_index].Get(), jsonErr) : RpcString()
+	};
+}
+
+
+
+PHANTASMA_FUNCTION LazyTransaction PhantasmaJsonAPI::DeserializeLazyTransaction(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{
+	const FieldMask selected = projection ? projection->Mask(RpcType::Transaction) : fields::Transaction::All;
+	json::JSONSlot slot[fields::Transaction::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Transaction::Keys(), fields::Transaction::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{
+		case json::KeyHash(PHANTASMA_LITERAL("hash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("hash")) ) { slot[fields::Transaction::hash_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::hash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("chainAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("chainAddress")) ) { slot[fields::Transaction::chainAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::chainAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("timestamp")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("timestamp")) ) { slot[fields::Transaction::timestamp_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::timestamp; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("blockHeight")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("blockHeight")) ) { slot[fields::Transaction::blockHeight_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::blockHeight; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("blockHash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("blockHash")) ) { slot[fields::Transaction::blockHash_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::blockHash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("script")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("script")) ) { slot[fields::Transaction::script_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::script; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("payload")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("payload")) ) { slot[fields::Transaction::payload_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::payload; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("events")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("events")) ) { slot[fields::Transaction::events_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::events; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("result")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("result")) ) { slot[fields::Transaction::result_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::result; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("fee")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("fee")) ) { slot[fields::Transaction::fee_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::fee; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("signatures")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("signatures")) ) { slot[fields::Transaction::signatures_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::signatures; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("expiration")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("expiration")) ) { slot[fields::Transaction::expiration_index] = json::ObjectValue(it, jsonErr); found |= fields::Transaction::expiration; } break;
+		}
+	}
+	LazyArray<Event> events;
+	if((selected & found & fields::Transaction::events) && json::IsArray(slot[fields::Transaction::events_index].Get(), jsonErr))
+		events = LazyArray<Event>(slot[fields::Transaction::events_index].Get(), &DeserializeEvent, projection);
+	LazyArray<Signature> signatures;
+	if((selected & found & fields::Transaction::signatures) && json::IsArray(slot[fields::Transaction::signatures_index].Get(), jsonErr))
+		signatures = LazyArray<Signature>(slot[fields::Transaction::signatures_index].Get(), &DeserializeSignature, projection);
+	return LazyTransaction { 
+		(selected & fields::Transaction::hash) ? json::AsRpcString(slot[fields::Transaction::hash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::chainAddress) ? json::AsRpcString(slot[fields::Transaction::chainAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::timestamp) ? json::AsUInt32(slot[fields::Transaction::timestamp_index].Get(), jsonErr) : 0, 
+		(selected & fields::Transaction::blockHeight) ? json::AsInt32(slot[fields::Transaction::blockHeight_index].Get(), jsonErr) : 0, 
+		(selected & fields::Transaction::blockHash) ? json::AsRpcString(slot[fields::Transaction::blockHash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::script) ? json::AsRpcString(slot[fields::Transaction::script_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::payload) ? json::AsRpcString(slot[fields::Transaction::payload_index].Get(), jsonErr) : RpcString(), 
+		std::move(events), 
+		(selected & fields::Transaction::result) ? json::AsRpcString(slot[fields::Transaction::result_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Transaction::fee) ? json::AsRpcString(slot[fields::Transaction::fee_index].Get(), jsonErr) : RpcString(), 
+		std::move(signatures), 
+		(selected & fields::Transaction::expiration) ? json::AsUInt32(slot[fields::Transaction::expiration_index].Get(), jsonErr) : 0
+	};
+}
+
+PHANTASMA_FUNCTION LazyBlock PhantasmaJsonAPI::DeserializeLazyBlock(const JSONValue& value, bool& jsonErr, const RpcProjection* projection)
+{
+	const FieldMask selected = projection ? projection->Mask(RpcType::Block) : fields::Block::All;
+	json::JSONSlot slot[fields::Block::Count];
+	FieldMask found = 0;
+	for(JSONObjectCursor it = json::ObjectBegin(value, fields::Block::Keys(), fields::Block::Count, jsonErr); json::ObjectValid(it, jsonErr); json::ObjectNext(it, jsonErr))
+	{
+		size_t keyLength = 0;
+		const Char* key = json::ObjectKey(it, keyLength, jsonErr);
+		switch( json::KeyHash(key, keyLength) )
+		{
+		case json::KeyHash(PHANTASMA_LITERAL("hash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("hash")) ) { slot[fields::Block::hash_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::hash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("previousHash")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("previousHash")) ) { slot[fields::Block::previousHash_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::previousHash; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("timestamp")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("timestamp")) ) { slot[fields::Block::timestamp_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::timestamp; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("height")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("height")) ) { slot[fields::Block::height_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::height; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("chainAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("chainAddress")) ) { slot[fields::Block::chainAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::chainAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("protocol")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("protocol")) ) { slot[fields::Block::protocol_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::protocol; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("txs")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("txs")) ) { slot[fields::Block::txs_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::txs; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("validatorAddress")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("validatorAddress")) ) { slot[fields::Block::validatorAddress_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::validatorAddress; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("reward")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("reward")) ) { slot[fields::Block::reward_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::reward; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("events")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("events")) ) { slot[fields::Block::events_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::events; } break;
+		case json::KeyHash(PHANTASMA_LITERAL("oracles")): if( json::KeyEquals(key, keyLength, PHANTASMA_LITERAL("oracles")) ) { slot[fields::Block::oracles_index] = json::ObjectValue(it, jsonErr); found |= fields::Block::oracles; } break;
+		}
+	}
+	LazyArray<LazyTransaction> txs;
+	if((selected & found & fields::Block::txs) && json::IsArray(slot[fields::Block::txs_index].Get(), jsonErr))
+		txs = LazyArray<LazyTransaction>(slot[fields::Block::txs_index].Get(), &DeserializeLazyTransaction, projection);
+	LazyArray<Event> events;
+	if((selected & found & fields::Block::events) && json::IsArray(slot[fields::Block::events_index].Get(), jsonErr))
+		events = LazyArray<Event>(slot[fields::Block::events_index].Get(), &DeserializeEvent, projection);
+	LazyArray<Oracle> oracles;
+	if((selected & found & fields::Block::oracles) && json::IsArray(slot[fields::Block::oracles_index].Get(), jsonErr))
+		oracles = LazyArray<Oracle>(slot[fields::Block::oracles_index].Get(), &DeserializeOracle, projection);
+	return LazyBlock { 
+		(selected & fields::Block::hash) ? json::AsRpcString(slot[fields::Block::hash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Block::previousHash) ? json::AsRpcString(slot[fields::Block::previousHash_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Block::timestamp) ? json::AsUInt32(slot[fields::Block::timestamp_index].Get(), jsonErr) : 0, 
+		(selected & fields::Block::height) ? json::AsUInt32(slot[fields::Block::height_index].Get(), jsonErr) : 0, 
+		(selected & fields::Block::chainAddress) ? json::AsRpcString(slot[fields::Block::chainAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Block::protocol) ? json::AsUInt32(slot[fields::Block::protocol_index].Get(), jsonErr) : 0, 
+		std::move(txs), 
+		(selected & fields::Block::validatorAddress) ? json::AsRpcString(slot[fields::Block::validatorAddress_index].Get(), jsonErr) : RpcString(), 
+		(selected & fields::Block::reward) ? json::AsRpcString(slot[fields::Block::reward_index].Get(), jsonErr) : RpcString(), 
+		std::move(events), 
+		std::move(oracles)
 	};
 }
 
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseLazyResponse(const JSONValue& _jsonResponse, LazyBlock& output, PhantasmaError* pout_err, const RpcProjection* projection)
+{
+	PhantasmaError err_dummy;
+	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
+	JSONValue jsonResponse = PhantasmaJsonAPI::CheckResponse(_jsonResponse, out_error);
+	if( out_error.code )
+		return false;
+	bool jsonErr = false;
+	output = DeserializeLazyBlock(jsonResponse, jsonErr, projection);
+	if( !out_error.code && jsonErr )
+		out_error.code = PhantasmaError::InvalidJSON;
+	return out_error.code == 0;
+}
+
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseLazyResponse(const JSONValue& _jsonResponse, LazyTransaction& output, PhantasmaError* pout_err, const RpcProjection* projection)
+{
+	PhantasmaError err_dummy;
+	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
+	JSONValue jsonResponse = PhantasmaJsonAPI::CheckResponse(_jsonResponse, out_error);
+	if( out_error.code )
+		return false;
+	bool jsonErr = false;
+	output = DeserializeLazyTransaction(jsonResponse, jsonErr, projection);
+	if( !out_error.code && jsonErr )
+		out_error.code = PhantasmaError::InvalidJSON;
+	return out_error.code == 0;
+}
+
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeBatchRequest(JSONBuilder& request, const RpcBatch& batch, int batchIndex)
+{
+	json::BeginArray(request);
+	for( int i = batch.Begin(batchIndex), end = batch.End(batchIndex); i < end; ++i )
+	{
+		Char id[RpcBatch::IdLength];
+		batch.m_requests[i].make(request, RpcBatch::FormatId(id, i));
+	}
+	json::EndArray(request);
+}
 
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseBatchResponse(const JSONValue& response, RpcBatch& batch, int batchIndex, PhantasmaError* pout_err)
+{
+	PhantasmaError err_dummy;
+	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
+	const int begin = batch.Begin(batchIndex), end = batch.End(batchIndex);
+	bool jsonErr = false;
+	if( !json::IsArray(response, jsonErr) || jsonErr )
+	{
+		// Nodes reply to a batch that they can't process with a single error object
+		PhantasmaJsonAPI::CheckResponse(response, out_error);
+		if( !out_error.code )
+			out_error.code = PhantasmaError::InvalidRpcResponse;
+		batch.Fail(batchIndex, out_error);
+		return false;
+	}
+	for( int i = begin; i < end; ++i )
+		batch.m_requests[i].parsed = false;
+	const JSONArray& responses = json::AsArray(response, jsonErr);
+	for(JSONArrayCursor it = json::ArrayBegin(responses, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
+	{
+		const JSONValue& element = json::ArrayValue(it, jsonErr);
+		if( !json::IsObject(element, jsonErr) || !json::HasField(element, PHANTASMA_LITERAL("id"), jsonErr) )
+			continue;
+		int index = RpcBatch::ParseId(json::LookupString(element, PHANTASMA_LITERAL("id"), jsonErr));
+		if( index < begin || index >= end || batch.m_requests[index].parsed )
+			continue;
+		RpcBatch::Request& request = batch.m_requests[index];
+		request.parsed = true;
+		request.parse(element, request.error);
+	}
+	if( !out_error.code && jsonErr )
+		out_error.code = PhantasmaError::InvalidJSON;
+	for( int i = begin; i < end; ++i )
+	{
+		RpcBatch::Request& request = batch.m_requests[i];
+		if( !request.parsed && request.error )
+		{
+			request.error->code = PhantasmaError::InvalidRpcResponse;
+			request.error->message = String(PHANTASMA_LITERAL("Malformed response: No response with a matching id in the batch"));
+		}
+	}
+	return out_error.code == 0;
+}
 
 PHANTASMA_FUNCTION JSONValue PhantasmaJsonAPI::CheckResponse(JSONValue response, PhantasmaError& out_error)
 {
@@ -2145,17 +3971,17 @@ PHANTASMA_FUNCTION JSONValue PhantasmaJsonAPI::CheckResponse(JSONValue response,
 
 
 // Returns the account name and balance of given address. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetAccountRequest(JSONBuilder& request, const Char* account)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetAccountRequest(JSONBuilder& request, const Char* account, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getAccount"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), account);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAccountResponse(const JSONValue& _jsonResponse, Account& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAccountResponse(const JSONValue& _jsonResponse, Account& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2163,7 +3989,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAccountResponse(const JSONValu
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeAccount(jsonResponse, jsonErr);
+	output = DeserializeAccount(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2171,17 +3997,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAccountResponse(const JSONValu
 
 
 // Returns the address that owns a given name. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeLookUpNameRequest(JSONBuilder& request, const Char* name)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeLookUpNameRequest(JSONBuilder& request, const Char* name, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("lookUpName"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), name);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseLookUpNameResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseLookUpNameResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2189,6 +4015,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseLookUpNameResponse(const JSONValu
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
+	(void)projection; // nothing to project in a String
 	output = json::AsString(jsonResponse, jsonErr);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
@@ -2197,17 +4024,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseLookUpNameResponse(const JSONValu
 
 
 // Returns the height of a chain. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetBlockHeightRequest(JSONBuilder& request, const Char* chainInput)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetBlockHeightRequest(JSONBuilder& request, const Char* chainInput, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getBlockHeight"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), chainInput);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockHeightResponse(const JSONValue& _jsonResponse, Int32& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockHeightResponse(const JSONValue& _jsonResponse, Int32& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2215,6 +4042,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockHeightResponse(const JSON
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
+	(void)projection; // nothing to project in a Int32
 	output = json::AsInt32(jsonResponse, jsonErr);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
@@ -2223,17 +4051,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockHeightResponse(const JSON
 
 
 // Returns the number of transactions of given block hash or error if given hash is invalid or is not found. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetBlockTransactionCountByHashRequest(JSONBuilder& request, const Char* blockHash)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetBlockTransactionCountByHashRequest(JSONBuilder& request, const Char* blockHash, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getBlockTransactionCountByHash"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), blockHash);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockTransactionCountByHashResponse(const JSONValue& _jsonResponse, Int32& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockTransactionCountByHashResponse(const JSONValue& _jsonResponse, Int32& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2241,6 +4069,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockTransactionCountByHashRes
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
+	(void)projection; // nothing to project in a Int32
 	output = json::AsInt32(jsonResponse, jsonErr);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
@@ -2249,17 +4078,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockTransactionCountByHashRes
 
 
 // Returns information about a block by hash. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetBlockByHashRequest(JSONBuilder& request, const Char* blockHash)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetBlockByHashRequest(JSONBuilder& request, const Char* blockHash, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getBlockByHash"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), blockHash);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockByHashResponse(const JSONValue& _jsonResponse, Block& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockByHashResponse(const JSONValue& _jsonResponse, Block& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2267,7 +4096,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockByHashResponse(const JSON
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeBlock(jsonResponse, jsonErr);
+	output = DeserializeBlock(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2275,17 +4104,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockByHashResponse(const JSON
 
 
 // Returns a serialized string, containing information about a block by hash. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetRawBlockByHashRequest(JSONBuilder& request, const Char* blockHash)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetRawBlockByHashRequest(JSONBuilder& request, const Char* blockHash, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getRawBlockByHash"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), blockHash);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetRawBlockByHashResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetRawBlockByHashResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2293,6 +4122,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetRawBlockByHashResponse(const J
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
+	(void)projection; // nothing to project in a String
 	output = json::AsString(jsonResponse, jsonErr);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
@@ -2301,17 +4131,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetRawBlockByHashResponse(const J
 
 
 // Returns information about a block by height and chain. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetBlockByHeightRequest(JSONBuilder& request, const Char* chainInput, UInt32 height)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetBlockByHeightRequest(JSONBuilder& request, const Char* chainInput, UInt32 height, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getBlockByHeight"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), chainInput, height);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockByHeightResponse(const JSONValue& _jsonResponse, Block& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockByHeightResponse(const JSONValue& _jsonResponse, Block& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2319,7 +4149,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockByHeightResponse(const JS
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeBlock(jsonResponse, jsonErr);
+	output = DeserializeBlock(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2327,17 +4157,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetBlockByHeightResponse(const JS
 
 
 // Returns a serialized string, in hex format, containing information about a block by height and chain. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetRawBlockByHeightRequest(JSONBuilder& request, const Char* chainInput, UInt32 height)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetRawBlockByHeightRequest(JSONBuilder& request, const Char* chainInput, UInt32 height, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getRawBlockByHeight"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), chainInput, height);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetRawBlockByHeightResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetRawBlockByHeightResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2345,6 +4175,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetRawBlockByHeightResponse(const
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
+	(void)projection; // nothing to project in a String
 	output = json::AsString(jsonResponse, jsonErr);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
@@ -2353,17 +4184,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetRawBlockByHeightResponse(const
 
 
 // Returns the information about a transaction requested by a block hash and transaction index. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetTransactionByBlockHashAndIndexRequest(JSONBuilder& request, const Char* blockHash, Int32 index)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetTransactionByBlockHashAndIndexRequest(JSONBuilder& request, const Char* blockHash, Int32 index, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getTransactionByBlockHashAndIndex"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), blockHash, index);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTransactionByBlockHashAndIndexResponse(const JSONValue& _jsonResponse, Transaction& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTransactionByBlockHashAndIndexResponse(const JSONValue& _jsonResponse, Transaction& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2371,7 +4202,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTransactionByBlockHashAndIndex
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeTransaction(jsonResponse, jsonErr);
+	output = DeserializeTransaction(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2379,17 +4210,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTransactionByBlockHashAndIndex
 
 
 // Returns last X transactions of given address. (Paginated)
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetAddressTransactionsRequest(JSONBuilder& request, const Char* account, UInt32 page, UInt32 pageSize)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetAddressTransactionsRequest(JSONBuilder& request, const Char* account, UInt32 page, UInt32 pageSize, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getAddressTransactions"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), account, page, pageSize);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAddressTransactionsResponse(const JSONValue& _jsonResponse, AccountTransactions& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAddressTransactionsResponse(const JSONValue& _jsonResponse, AccountTransactions& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2397,25 +4228,25 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAddressTransactionsResponse(co
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	Paginated pageStruct = DeserializePaginated(jsonResponse, jsonErr);
-	output = DeserializeAccountTransactions(pageStruct.result, jsonErr);
+	Paginated pageStruct = DeserializePaginated(jsonResponse, jsonErr, projection);
+	output = DeserializeAccountTransactions(pageStruct.result, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
 }
 
 // Get number of transactions in a specific address and chain 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetAddressTransactionCountRequest(JSONBuilder& request, const Char* account, const Char* chainInput)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetAddressTransactionCountRequest(JSONBuilder& request, const Char* account, const Char* chainInput, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getAddressTransactionCount"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), account, chainInput);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAddressTransactionCountResponse(const JSONValue& _jsonResponse, Int32& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAddressTransactionCountResponse(const JSONValue& _jsonResponse, Int32& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2423,6 +4254,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAddressTransactionCountRespons
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
+	(void)projection; // nothing to project in a Int32
 	output = json::AsInt32(jsonResponse, jsonErr);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
@@ -2431,17 +4263,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAddressTransactionCountRespons
 
 
 // Allows to broadcast a signed operation on the network, but it&apos;s required to build it manually. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeSendRawTransactionRequest(JSONBuilder& request, const Char* txData)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeSendRawTransactionRequest(JSONBuilder& request, const Char* txData, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("sendRawTransaction"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), txData);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseSendRawTransactionResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseSendRawTransactionResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2449,6 +4281,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseSendRawTransactionResponse(const
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
+	(void)projection; // nothing to project in a String
 	output = json::AsString(jsonResponse, jsonErr);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
@@ -2457,17 +4290,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseSendRawTransactionResponse(const
 
 
 // Allows to invoke script based on network state, without state changes. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeInvokeRawScriptRequest(JSONBuilder& request, const Char* chainInput, const Char* scriptData)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeInvokeRawScriptRequest(JSONBuilder& request, const Char* chainInput, const Char* scriptData, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("invokeRawScript"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), chainInput, scriptData);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseInvokeRawScriptResponse(const JSONValue& _jsonResponse, Script& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseInvokeRawScriptResponse(const JSONValue& _jsonResponse, Script& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2475,7 +4308,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseInvokeRawScriptResponse(const JSO
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeScript(jsonResponse, jsonErr);
+	output = DeserializeScript(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2483,17 +4316,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseInvokeRawScriptResponse(const JSO
 
 
 // Returns information about a transaction by hash. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetTransactionRequest(JSONBuilder& request, const Char* hashText)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetTransactionRequest(JSONBuilder& request, const Char* hashText, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getTransaction"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), hashText);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTransactionResponse(const JSONValue& _jsonResponse, Transaction& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTransactionResponse(const JSONValue& _jsonResponse, Transaction& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2501,7 +4334,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTransactionResponse(const JSON
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeTransaction(jsonResponse, jsonErr);
+	output = DeserializeTransaction(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2509,17 +4342,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTransactionResponse(const JSON
 
 
 // Removes a pending transaction from the mempool. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeCancelTransactionRequest(JSONBuilder& request, const Char* hashText)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeCancelTransactionRequest(JSONBuilder& request, const Char* hashText, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("cancelTransaction"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), hashText);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseCancelTransactionResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseCancelTransactionResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2527,6 +4360,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseCancelTransactionResponse(const J
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
+	(void)projection; // nothing to project in a String
 	output = json::AsString(jsonResponse, jsonErr);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
@@ -2535,17 +4369,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseCancelTransactionResponse(const J
 
 
 // Returns an array of all chains deployed in Phantasma. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetChainsRequest(JSONBuilder& request)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetChainsRequest(JSONBuilder& request, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getChains"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"));
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetChainsResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Chain>& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetChainsResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Chain>& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2563,9 +4397,9 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetChainsResponse(const JSONValue
 	const JSONArray& resultArray = json::AsArray(jsonResponse, jsonErr);
 	int resultArraySize = json::ArraySize(resultArray, jsonErr);
 	output.reserve(resultArraySize);
-	for(int i = 0; i < resultArraySize; ++i)
+	for(JSONArrayCursor it = json::ArrayBegin(resultArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 	{
-		output.push_back(DeserializeChain(json::IndexArray(resultArray, i, jsonErr), jsonErr));
+		output.push_back(DeserializeChain(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		if( jsonErr || out_error.code )
 			break;
 	}
@@ -2576,17 +4410,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetChainsResponse(const JSONValue
 
 
 // Returns info about the nexus. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetNexusRequest(JSONBuilder& request, bool extended)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetNexusRequest(JSONBuilder& request, bool extended, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getNexus"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), extended);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetNexusResponse(const JSONValue& _jsonResponse, Nexus& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetNexusResponse(const JSONValue& _jsonResponse, Nexus& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2594,7 +4428,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetNexusResponse(const JSONValue&
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeNexus(jsonResponse, jsonErr);
+	output = DeserializeNexus(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2602,17 +4436,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetNexusResponse(const JSONValue&
 
 
 // Returns info about an organization. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetOrganizationRequest(JSONBuilder& request, const Char* ID)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetOrganizationRequest(JSONBuilder& request, const Char* ID, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getOrganization"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), ID);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetOrganizationResponse(const JSONValue& _jsonResponse, Organization& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetOrganizationResponse(const JSONValue& _jsonResponse, Organization& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2620,7 +4454,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetOrganizationResponse(const JSO
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeOrganization(jsonResponse, jsonErr);
+	output = DeserializeOrganization(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2628,17 +4462,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetOrganizationResponse(const JSO
 
 
 // Returns content of a Phantasma leaderboard. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetLeaderboardRequest(JSONBuilder& request, const Char* name)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetLeaderboardRequest(JSONBuilder& request, const Char* name, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getLeaderboard"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), name);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetLeaderboardResponse(const JSONValue& _jsonResponse, Leaderboard& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetLeaderboardResponse(const JSONValue& _jsonResponse, Leaderboard& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2646,7 +4480,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetLeaderboardResponse(const JSON
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeLeaderboard(jsonResponse, jsonErr);
+	output = DeserializeLeaderboard(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2654,17 +4488,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetLeaderboardResponse(const JSON
 
 
 // Returns an array of tokens deployed in Phantasma. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetTokensRequest(JSONBuilder& request, bool extended)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetTokensRequest(JSONBuilder& request, bool extended, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getTokens"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), extended);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokensResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Token>& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokensResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Token>& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2682,9 +4516,9 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokensResponse(const JSONValue
 	const JSONArray& resultArray = json::AsArray(jsonResponse, jsonErr);
 	int resultArraySize = json::ArraySize(resultArray, jsonErr);
 	output.reserve(resultArraySize);
-	for(int i = 0; i < resultArraySize; ++i)
+	for(JSONArrayCursor it = json::ArrayBegin(resultArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 	{
-		output.push_back(DeserializeToken(json::IndexArray(resultArray, i, jsonErr), jsonErr));
+		output.push_back(DeserializeToken(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		if( jsonErr || out_error.code )
 			break;
 	}
@@ -2695,17 +4529,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokensResponse(const JSONValue
 
 
 // Returns info about a specific token deployed in Phantasma. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetTokenRequest(JSONBuilder& request, const Char* symbol, bool extended)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetTokenRequest(JSONBuilder& request, const Char* symbol, bool extended, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getToken"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), symbol, extended);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokenResponse(const JSONValue& _jsonResponse, Token& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokenResponse(const JSONValue& _jsonResponse, Token& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2713,7 +4547,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokenResponse(const JSONValue&
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeToken(jsonResponse, jsonErr);
+	output = DeserializeToken(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2721,17 +4555,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokenResponse(const JSONValue&
 
 
 // Returns data of a non-fungible token, in hexadecimal format. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetTokenDataRequest(JSONBuilder& request, const Char* symbol, const Char* IDtext)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetTokenDataRequest(JSONBuilder& request, const Char* symbol, const Char* IDtext, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getTokenData"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), symbol, IDtext);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokenDataResponse(const JSONValue& _jsonResponse, TokenData& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokenDataResponse(const JSONValue& _jsonResponse, TokenData& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2739,7 +4573,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokenDataResponse(const JSONVa
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeTokenData(jsonResponse, jsonErr);
+	output = DeserializeTokenData(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2747,17 +4581,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokenDataResponse(const JSONVa
 
 
 // Returns data of a non-fungible token, in hexadecimal format. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetNFTRequest(JSONBuilder& request, const Char* symbol, const Char* IDtext, bool extended)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetNFTRequest(JSONBuilder& request, const Char* symbol, const Char* IDtext, bool extended, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getNFT"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), symbol, IDtext, extended);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetNFTResponse(const JSONValue& _jsonResponse, TokenData& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetNFTResponse(const JSONValue& _jsonResponse, TokenData& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2765,7 +4599,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetNFTResponse(const JSONValue& _
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeTokenData(jsonResponse, jsonErr);
+	output = DeserializeTokenData(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2773,17 +4607,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetNFTResponse(const JSONValue& _
 
 
 // Returns the balance for a specific token and chain, given an address. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetTokenBalanceRequest(JSONBuilder& request, const Char* account, const Char* tokenSymbol, const Char* chainInput)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetTokenBalanceRequest(JSONBuilder& request, const Char* account, const Char* tokenSymbol, const Char* chainInput, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getTokenBalance"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), account, tokenSymbol, chainInput);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokenBalanceResponse(const JSONValue& _jsonResponse, Balance& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokenBalanceResponse(const JSONValue& _jsonResponse, Balance& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2791,7 +4625,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokenBalanceResponse(const JSO
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeBalance(jsonResponse, jsonErr);
+	output = DeserializeBalance(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2799,17 +4633,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetTokenBalanceResponse(const JSO
 
 
 // Returns the number of active auctions. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetAuctionsCountRequest(JSONBuilder& request, const Char* chainAddressOrName, const Char* symbol)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetAuctionsCountRequest(JSONBuilder& request, const Char* chainAddressOrName, const Char* symbol, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getAuctionsCount"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), chainAddressOrName, symbol);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAuctionsCountResponse(const JSONValue& _jsonResponse, Int32& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAuctionsCountResponse(const JSONValue& _jsonResponse, Int32& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2817,6 +4651,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAuctionsCountResponse(const JS
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
+	(void)projection; // nothing to project in a Int32
 	output = json::AsInt32(jsonResponse, jsonErr);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
@@ -2825,17 +4660,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAuctionsCountResponse(const JS
 
 
 // Returns the auctions available in the market. (Paginated)
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetAuctionsRequest(JSONBuilder& request, const Char* chainAddressOrName, const Char* symbol, UInt32 page, UInt32 pageSize)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetAuctionsRequest(JSONBuilder& request, const Char* chainAddressOrName, const Char* symbol, UInt32 page, UInt32 pageSize, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getAuctions"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), chainAddressOrName, symbol, page, pageSize);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAuctionsResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Auction>& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAuctionsResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Auction>& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2843,7 +4678,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAuctionsResponse(const JSONVal
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	Paginated pageStruct = DeserializePaginated(jsonResponse, jsonErr);
+	Paginated pageStruct = DeserializePaginated(jsonResponse, jsonErr, projection);
 	if(!json::IsArray(pageStruct.result, jsonErr))
 	{ 
 		PHANTASMA_EXCEPTION("Malformed response: No JSON array on the \"result\" node");
@@ -2853,9 +4688,9 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAuctionsResponse(const JSONVal
 	const JSONArray& pages = json::AsArray(pageStruct.result, jsonErr);
 	int size = json::ArraySize(pages, jsonErr);
 	output.reserve(size);
-	for(int i = 0; i < size; ++i)
+	for(JSONArrayCursor it = json::ArrayBegin(pages, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 	{
-		output.push_back(DeserializeAuction(json::IndexArray(pages, i, jsonErr), jsonErr));
+		output.push_back(DeserializeAuction(json::ArrayValue(it, jsonErr), jsonErr, projection));
 	}
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
@@ -2863,17 +4698,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAuctionsResponse(const JSONVal
 }
 
 // Returns the auction for a specific token. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetAuctionRequest(JSONBuilder& request, const Char* chainAddressOrName, const Char* symbol, const Char* IDtext)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetAuctionRequest(JSONBuilder& request, const Char* chainAddressOrName, const Char* symbol, const Char* IDtext, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getAuction"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), chainAddressOrName, symbol, IDtext);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAuctionResponse(const JSONValue& _jsonResponse, Auction& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAuctionResponse(const JSONValue& _jsonResponse, Auction& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2881,7 +4716,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAuctionResponse(const JSONValu
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeAuction(jsonResponse, jsonErr);
+	output = DeserializeAuction(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2889,17 +4724,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetAuctionResponse(const JSONValu
 
 
 // Returns info about a specific archive. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetArchiveRequest(JSONBuilder& request, const Char* hashText)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetArchiveRequest(JSONBuilder& request, const Char* hashText, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getArchive"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), hashText);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetArchiveResponse(const JSONValue& _jsonResponse, Archive& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetArchiveResponse(const JSONValue& _jsonResponse, Archive& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2907,7 +4742,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetArchiveResponse(const JSONValu
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeArchive(jsonResponse, jsonErr);
+	output = DeserializeArchive(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2915,17 +4750,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetArchiveResponse(const JSONValu
 
 
 // Writes the contents of an incomplete archive. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeWriteArchiveRequest(JSONBuilder& request, const Char* hashText, Int32 blockIndex, const Char* blockContent)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeWriteArchiveRequest(JSONBuilder& request, const Char* hashText, Int32 blockIndex, const Char* blockContent, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("writeArchive"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), hashText, blockIndex, blockContent);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseWriteArchiveResponse(const JSONValue& _jsonResponse, bool& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseWriteArchiveResponse(const JSONValue& _jsonResponse, bool& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2933,7 +4768,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseWriteArchiveResponse(const JSONVa
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = Deserializebool(jsonResponse, jsonErr);
+	output = Deserializebool(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2941,17 +4776,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseWriteArchiveResponse(const JSONVa
 
 
 // Reads given archive block. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeReadArchiveRequest(JSONBuilder& request, const Char* hashText, Int32 blockIndex)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeReadArchiveRequest(JSONBuilder& request, const Char* hashText, Int32 blockIndex, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("readArchive"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), hashText, blockIndex);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseReadArchiveResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseReadArchiveResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2959,6 +4794,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseReadArchiveResponse(const JSONVal
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
+	(void)projection; // nothing to project in a String
 	output = json::AsString(jsonResponse, jsonErr);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
@@ -2967,17 +4803,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseReadArchiveResponse(const JSONVal
 
 
 // Returns the ABI interface of specific contract. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetContractRequest(JSONBuilder& request, const Char* chainAddressOrName, const Char* contractName)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetContractRequest(JSONBuilder& request, const Char* chainAddressOrName, const Char* contractName, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getContract"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), chainAddressOrName, contractName);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetContractResponse(const JSONValue& _jsonResponse, Contract& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetContractResponse(const JSONValue& _jsonResponse, Contract& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -2985,7 +4821,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetContractResponse(const JSONVal
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = DeserializeContract(jsonResponse, jsonErr);
+	output = DeserializeContract(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -2993,17 +4829,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetContractResponse(const JSONVal
 
 
 // Returns list of known peers. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetPeersRequest(JSONBuilder& request)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetPeersRequest(JSONBuilder& request, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getPeers"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"));
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetPeersResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Peer>& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetPeersResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Peer>& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -3021,9 +4857,9 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetPeersResponse(const JSONValue&
 	const JSONArray& resultArray = json::AsArray(jsonResponse, jsonErr);
 	int resultArraySize = json::ArraySize(resultArray, jsonErr);
 	output.reserve(resultArraySize);
-	for(int i = 0; i < resultArraySize; ++i)
+	for(JSONArrayCursor it = json::ArrayBegin(resultArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 	{
-		output.push_back(DeserializePeer(json::IndexArray(resultArray, i, jsonErr), jsonErr));
+		output.push_back(DeserializePeer(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		if( jsonErr || out_error.code )
 			break;
 	}
@@ -3034,17 +4870,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetPeersResponse(const JSONValue&
 
 
 // Writes a message to the relay network. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeRelaySendRequest(JSONBuilder& request, const Char* receiptHex)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeRelaySendRequest(JSONBuilder& request, const Char* receiptHex, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("relaySend"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), receiptHex);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseRelaySendResponse(const JSONValue& _jsonResponse, bool& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseRelaySendResponse(const JSONValue& _jsonResponse, bool& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -3052,7 +4888,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseRelaySendResponse(const JSONValue
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
-	output = Deserializebool(jsonResponse, jsonErr);
+	output = Deserializebool(jsonResponse, jsonErr, projection);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
 	return out_error.code == 0;
@@ -3060,17 +4896,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseRelaySendResponse(const JSONValue
 
 
 // Receives messages from the relay network. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeRelayReceiveRequest(JSONBuilder& request, const Char* account)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeRelayReceiveRequest(JSONBuilder& request, const Char* account, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("relayReceive"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), account);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseRelayReceiveResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Receipt>& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseRelayReceiveResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Receipt>& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -3088,9 +4924,9 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseRelayReceiveResponse(const JSONVa
 	const JSONArray& resultArray = json::AsArray(jsonResponse, jsonErr);
 	int resultArraySize = json::ArraySize(resultArray, jsonErr);
 	output.reserve(resultArraySize);
-	for(int i = 0; i < resultArraySize; ++i)
+	for(JSONArrayCursor it = json::ArrayBegin(resultArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 	{
-		output.push_back(DeserializeReceipt(json::IndexArray(resultArray, i, jsonErr), jsonErr));
+		output.push_back(DeserializeReceipt(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		if( jsonErr || out_error.code )
 			break;
 	}
@@ -3101,17 +4937,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseRelayReceiveResponse(const JSONVa
 
 
 // Reads pending messages from the relay network. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetEventsRequest(JSONBuilder& request, const Char* account)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetEventsRequest(JSONBuilder& request, const Char* account, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getEvents"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), account);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetEventsResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Event>& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetEventsResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Event>& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -3129,9 +4965,9 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetEventsResponse(const JSONValue
 	const JSONArray& resultArray = json::AsArray(jsonResponse, jsonErr);
 	int resultArraySize = json::ArraySize(resultArray, jsonErr);
 	output.reserve(resultArraySize);
-	for(int i = 0; i < resultArraySize; ++i)
+	for(JSONArrayCursor it = json::ArrayBegin(resultArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 	{
-		output.push_back(DeserializeEvent(json::IndexArray(resultArray, i, jsonErr), jsonErr));
+		output.push_back(DeserializeEvent(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		if( jsonErr || out_error.code )
 			break;
 	}
@@ -3142,17 +4978,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetEventsResponse(const JSONValue
 
 
 // Returns an array of available interop platforms. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetPlatformsRequest(JSONBuilder& request)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetPlatformsRequest(JSONBuilder& request, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getPlatforms"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"));
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetPlatformsResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Platform>& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetPlatformsResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Platform>& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -3170,9 +5006,9 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetPlatformsResponse(const JSONVa
 	const JSONArray& resultArray = json::AsArray(jsonResponse, jsonErr);
 	int resultArraySize = json::ArraySize(resultArray, jsonErr);
 	output.reserve(resultArraySize);
-	for(int i = 0; i < resultArraySize; ++i)
+	for(JSONArrayCursor it = json::ArrayBegin(resultArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 	{
-		output.push_back(DeserializePlatform(json::IndexArray(resultArray, i, jsonErr), jsonErr));
+		output.push_back(DeserializePlatform(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		if( jsonErr || out_error.code )
 			break;
 	}
@@ -3183,17 +5019,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetPlatformsResponse(const JSONVa
 
 
 // Returns an array of available validators. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetValidatorsRequest(JSONBuilder& request)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetValidatorsRequest(JSONBuilder& request, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getValidators"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"));
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetValidatorsResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Validator>& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetValidatorsResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Validator>& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -3211,9 +5047,9 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetValidatorsResponse(const JSONV
 	const JSONArray& resultArray = json::AsArray(jsonResponse, jsonErr);
 	int resultArraySize = json::ArraySize(resultArray, jsonErr);
 	output.reserve(resultArraySize);
-	for(int i = 0; i < resultArraySize; ++i)
+	for(JSONArrayCursor it = json::ArrayBegin(resultArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 	{
-		output.push_back(DeserializeValidator(json::IndexArray(resultArray, i, jsonErr), jsonErr));
+		output.push_back(DeserializeValidator(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		if( jsonErr || out_error.code )
 			break;
 	}
@@ -3224,17 +5060,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetValidatorsResponse(const JSONV
 
 
 // Tries to settle a pending swap for a specific hash. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeSettleSwapRequest(JSONBuilder& request, const Char* sourcePlatform, const Char* destPlatform, const Char* hashText)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeSettleSwapRequest(JSONBuilder& request, const Char* sourcePlatform, const Char* destPlatform, const Char* hashText, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("settleSwap"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), sourcePlatform, destPlatform, hashText);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseSettleSwapResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseSettleSwapResponse(const JSONValue& _jsonResponse, String& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -3242,6 +5078,7 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseSettleSwapResponse(const JSONValu
 	if( out_error.code )
 		return false;
 	bool jsonErr = false;
+	(void)projection; // nothing to project in a String
 	output = json::AsString(jsonResponse, jsonErr);
 	if( !out_error.code && jsonErr )
 		out_error.code = PhantasmaError::InvalidJSON;
@@ -3250,17 +5087,17 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseSettleSwapResponse(const JSONValu
 
 
 // Returns platform swaps for a specific address. 
-PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetSwapsForAddressRequest(JSONBuilder& request, const Char* account)
+PHANTASMA_FUNCTION void PhantasmaJsonAPI::MakeGetSwapsForAddressRequest(JSONBuilder& request, const Char* account, const Char* id)
 {
 	json::BeginObject(request);
 	json::AddString(request, PHANTASMA_LITERAL("jsonrpc"), PHANTASMA_LITERAL("2.0"));
 	json::AddString(request, PHANTASMA_LITERAL("method"), PHANTASMA_LITERAL("getSwapsForAddress"));
-	json::AddString(request, PHANTASMA_LITERAL("id"), PHANTASMA_LITERAL("1"));
+	json::AddString(request, PHANTASMA_LITERAL("id"), id);
 	json::AddArray(request, PHANTASMA_LITERAL("params"), account);
 	json::EndObject(request);
 }
 
-PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetSwapsForAddressResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Swap>& output, PhantasmaError* pout_err)
+PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetSwapsForAddressResponse(const JSONValue& _jsonResponse, PHANTASMA_VECTOR<Swap>& output, PhantasmaError* pout_err, const RpcProjection* projection)
 {
 	PhantasmaError err_dummy;
 	PhantasmaError& out_error = pout_err ? *pout_err : err_dummy;
@@ -3278,9 +5115,9 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetSwapsForAddressResponse(const
 	const JSONArray& resultArray = json::AsArray(jsonResponse, jsonErr);
 	int resultArraySize = json::ArraySize(resultArray, jsonErr);
 	output.reserve(resultArraySize);
-	for(int i = 0; i < resultArraySize; ++i)
+	for(JSONArrayCursor it = json::ArrayBegin(resultArray, jsonErr); json::ArrayValid(it, jsonErr); json::ArrayNext(it, jsonErr))
 	{
-		output.push_back(DeserializeSwap(json::IndexArray(resultArray, i, jsonErr), jsonErr));
+		output.push_back(DeserializeSwap(json::ArrayValue(it, jsonErr), jsonErr, projection));
 		if( jsonErr || out_error.code )
 			break;
 	}
@@ -3293,429 +5130,450 @@ PHANTASMA_FUNCTION bool PhantasmaJsonAPI::ParseGetSwapsForAddressResponse(const
 	
 #if defined(PHANTASMA_HTTPCLIENT)
 
-PHANTASMA_FUNCTION Account PhantasmaAPI::GetAccount(const Char* account, PhantasmaError* out_error)
+PHANTASMA_FUNCTION bool PhantasmaAPI::Send(PHANTASMA_ARENA_PARAM RpcBatch& batch, PhantasmaError* out_error)
+{
+	PhantasmaError err_dummy;
+	PhantasmaError& error = out_error ? *out_error : err_dummy;
+	// A failed HTTP request only fails the requests of its own sub-batch; the first failure is reported
+	for( int i = 0, count = batch.Batches(); i != count; ++i )
+	{
+		PhantasmaError batchError;
+		JSONBuilder request;
+		PhantasmaJsonAPI::MakeBatchRequest(request, batch, i);
+		const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, &batchError));
+		if( batchError.code )
+			batch.Fail(i, batchError);
+		else
+			PhantasmaJsonAPI::ParseBatchResponse(json::Parse(response), batch, i, &batchError);
+		if( batchError.code && !error.code )
+			error = batchError;
+	}
+	return error.code == 0;
+}
+
+PHANTASMA_FUNCTION Account PhantasmaAPI::GetAccount(PHANTASMA_ARENA_PARAM const Char* account, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetAccountRequest(request, account);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Account output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetAccountResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION String PhantasmaAPI::LookUpName(const Char* name, PhantasmaError* out_error)
+PHANTASMA_FUNCTION String PhantasmaAPI::LookUpName(PHANTASMA_ARENA_PARAM const Char* name, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeLookUpNameRequest(request, name);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	String output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseLookUpNameResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Int32 PhantasmaAPI::GetBlockHeight(const Char* chainInput, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Int32 PhantasmaAPI::GetBlockHeight(PHANTASMA_ARENA_PARAM const Char* chainInput, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetBlockHeightRequest(request, chainInput);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Int32 output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetBlockHeightResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Int32 PhantasmaAPI::GetBlockTransactionCountByHash(const Char* blockHash, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Int32 PhantasmaAPI::GetBlockTransactionCountByHash(PHANTASMA_ARENA_PARAM const Char* blockHash, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetBlockTransactionCountByHashRequest(request, blockHash);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Int32 output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetBlockTransactionCountByHashResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Block PhantasmaAPI::GetBlockByHash(const Char* blockHash, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Block PhantasmaAPI::GetBlockByHash(PHANTASMA_ARENA_PARAM const Char* blockHash, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetBlockByHashRequest(request, blockHash);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Block output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetBlockByHashResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION String PhantasmaAPI::GetRawBlockByHash(const Char* blockHash, PhantasmaError* out_error)
+PHANTASMA_FUNCTION String PhantasmaAPI::GetRawBlockByHash(PHANTASMA_ARENA_PARAM const Char* blockHash, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetRawBlockByHashRequest(request, blockHash);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	String output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetRawBlockByHashResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Block PhantasmaAPI::GetBlockByHeight(const Char* chainInput, UInt32 height, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Block PhantasmaAPI::GetBlockByHeight(PHANTASMA_ARENA_PARAM const Char* chainInput, UInt32 height, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetBlockByHeightRequest(request, chainInput, height);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Block output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetBlockByHeightResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION String PhantasmaAPI::GetRawBlockByHeight(const Char* chainInput, UInt32 height, PhantasmaError* out_error)
+PHANTASMA_FUNCTION String PhantasmaAPI::GetRawBlockByHeight(PHANTASMA_ARENA_PARAM const Char* chainInput, UInt32 height, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetRawBlockByHeightRequest(request, chainInput, height);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	String output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetRawBlockByHeightResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Transaction PhantasmaAPI::GetTransactionByBlockHashAndIndex(const Char* blockHash, Int32 index, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Transaction PhantasmaAPI::GetTransactionByBlockHashAndIndex(PHANTASMA_ARENA_PARAM const Char* blockHash, Int32 index, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetTransactionByBlockHashAndIndexRequest(request, blockHash, index);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Transaction output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetTransactionByBlockHashAndIndexResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION AccountTransactions PhantasmaAPI::GetAddressTransactions(const Char* account, UInt32 page, UInt32 pageSize, PhantasmaError* out_error)
+PHANTASMA_FUNCTION AccountTransactions PhantasmaAPI::GetAddressTransactions(PHANTASMA_ARENA_PARAM const Char* account, UInt32 page, UInt32 pageSize, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetAddressTransactionsRequest(request, account, page, pageSize);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	AccountTransactions output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetAddressTransactionsResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Int32 PhantasmaAPI::GetAddressTransactionCount(const Char* account, const Char* chainInput, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Int32 PhantasmaAPI::GetAddressTransactionCount(PHANTASMA_ARENA_PARAM const Char* account, const Char* chainInput, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetAddressTransactionCountRequest(request, account, chainInput);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Int32 output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetAddressTransactionCountResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION String PhantasmaAPI::SendRawTransaction(const Char* txData, PhantasmaError* out_error)
+PHANTASMA_FUNCTION String PhantasmaAPI::SendRawTransaction(PHANTASMA_ARENA_PARAM const Char* txData, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeSendRawTransactionRequest(request, txData);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	String output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseSendRawTransactionResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Script PhantasmaAPI::InvokeRawScript(const Char* chainInput, const Char* scriptData, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Script PhantasmaAPI::InvokeRawScript(PHANTASMA_ARENA_PARAM const Char* chainInput, const Char* scriptData, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeInvokeRawScriptRequest(request, chainInput, scriptData);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Script output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseInvokeRawScriptResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Transaction PhantasmaAPI::GetTransaction(const Char* hashText, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Transaction PhantasmaAPI::GetTransaction(PHANTASMA_ARENA_PARAM const Char* hashText, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetTransactionRequest(request, hashText);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Transaction output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetTransactionResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION String PhantasmaAPI::CancelTransaction(const Char* hashText, PhantasmaError* out_error)
+PHANTASMA_FUNCTION String PhantasmaAPI::CancelTransaction(PHANTASMA_ARENA_PARAM const Char* hashText, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeCancelTransactionRequest(request, hashText);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	String output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseCancelTransactionResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION PHANTASMA_VECTOR<Chain> PhantasmaAPI::GetChains(PhantasmaError* out_error)
+PHANTASMA_FUNCTION PHANTASMA_VECTOR<Chain> PhantasmaAPI::GetChains(PHANTASMA_ARENA_PARAM PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetChainsRequest(request);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	PHANTASMA_VECTOR<Chain> output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetChainsResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Nexus PhantasmaAPI::GetNexus(bool extended, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Nexus PhantasmaAPI::GetNexus(PHANTASMA_ARENA_PARAM bool extended, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetNexusRequest(request, extended);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Nexus output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetNexusResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Organization PhantasmaAPI::GetOrganization(const Char* ID, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Organization PhantasmaAPI::GetOrganization(PHANTASMA_ARENA_PARAM const Char* ID, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetOrganizationRequest(request, ID);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Organization output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetOrganizationResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Leaderboard PhantasmaAPI::GetLeaderboard(const Char* name, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Leaderboard PhantasmaAPI::GetLeaderboard(PHANTASMA_ARENA_PARAM const Char* name, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetLeaderboardRequest(request, name);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Leaderboard output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetLeaderboardResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION PHANTASMA_VECTOR<Token> PhantasmaAPI::GetTokens(bool extended, PhantasmaError* out_error)
+PHANTASMA_FUNCTION PHANTASMA_VECTOR<Token> PhantasmaAPI::GetTokens(PHANTASMA_ARENA_PARAM bool extended, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetTokensRequest(request, extended);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	PHANTASMA_VECTOR<Token> output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetTokensResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Token PhantasmaAPI::GetToken(const Char* symbol, bool extended, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Token PhantasmaAPI::GetToken(PHANTASMA_ARENA_PARAM const Char* symbol, bool extended, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetTokenRequest(request, symbol, extended);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Token output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetTokenResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION TokenData PhantasmaAPI::GetTokenData(const Char* symbol, const Char* IDtext, PhantasmaError* out_error)
+PHANTASMA_FUNCTION TokenData PhantasmaAPI::GetTokenData(PHANTASMA_ARENA_PARAM const Char* symbol, const Char* IDtext, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetTokenDataRequest(request, symbol, IDtext);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	TokenData output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetTokenDataResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION TokenData PhantasmaAPI::GetNFT(const Char* symbol, const Char* IDtext, bool extended, PhantasmaError* out_error)
+PHANTASMA_FUNCTION TokenData PhantasmaAPI::GetNFT(PHANTASMA_ARENA_PARAM const Char* symbol, const Char* IDtext, bool extended, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetNFTRequest(request, symbol, IDtext, extended);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	TokenData output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetNFTResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Balance PhantasmaAPI::GetTokenBalance(const Char* account, const Char* tokenSymbol, const Char* chainInput, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Balance PhantasmaAPI::GetTokenBalance(PHANTASMA_ARENA_PARAM const Char* account, const Char* tokenSymbol, const Char* chainInput, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetTokenBalanceRequest(request, account, tokenSymbol, chainInput);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Balance output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetTokenBalanceResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Int32 PhantasmaAPI::GetAuctionsCount(const Char* chainAddressOrName, const Char* symbol, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Int32 PhantasmaAPI::GetAuctionsCount(PHANTASMA_ARENA_PARAM const Char* chainAddressOrName, const Char* symbol, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetAuctionsCountRequest(request, chainAddressOrName, symbol);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Int32 output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetAuctionsCountResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION PHANTASMA_VECTOR<Auction> PhantasmaAPI::GetAuctions(const Char* chainAddressOrName, const Char* symbol, UInt32 page, UInt32 pageSize, PhantasmaError* out_error)
+PHANTASMA_FUNCTION PHANTASMA_VECTOR<Auction> PhantasmaAPI::GetAuctions(PHANTASMA_ARENA_PARAM const Char* chainAddressOrName, const Char* symbol, UInt32 page, UInt32 pageSize, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetAuctionsRequest(request, chainAddressOrName, symbol, page, pageSize);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	PHANTASMA_VECTOR<Auction> output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetAuctionsResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Auction PhantasmaAPI::GetAuction(const Char* chainAddressOrName, const Char* symbol, const Char* IDtext, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Auction PhantasmaAPI::GetAuction(PHANTASMA_ARENA_PARAM const Char* chainAddressOrName, const Char* symbol, const Char* IDtext, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetAuctionRequest(request, chainAddressOrName, symbol, IDtext);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Auction output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetAuctionResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Archive PhantasmaAPI::GetArchive(const Char* hashText, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Archive PhantasmaAPI::GetArchive(PHANTASMA_ARENA_PARAM const Char* hashText, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetArchiveRequest(request, hashText);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Archive output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetArchiveResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION bool PhantasmaAPI::WriteArchive(const Char* hashText, Int32 blockIndex, const Char* blockContent, PhantasmaError* out_error)
+PHANTASMA_FUNCTION bool PhantasmaAPI::WriteArchive(PHANTASMA_ARENA_PARAM const Char* hashText, Int32 blockIndex, const Char* blockContent, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeWriteArchiveRequest(request, hashText, blockIndex, blockContent);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	bool output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseWriteArchiveResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION String PhantasmaAPI::ReadArchive(const Char* hashText, Int32 blockIndex, PhantasmaError* out_error)
+PHANTASMA_FUNCTION String PhantasmaAPI::ReadArchive(PHANTASMA_ARENA_PARAM const Char* hashText, Int32 blockIndex, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeReadArchiveRequest(request, hashText, blockIndex);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	String output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseReadArchiveResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION Contract PhantasmaAPI::GetContract(const Char* chainAddressOrName, const Char* contractName, PhantasmaError* out_error)
+PHANTASMA_FUNCTION Contract PhantasmaAPI::GetContract(PHANTASMA_ARENA_PARAM const Char* chainAddressOrName, const Char* contractName, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetContractRequest(request, chainAddressOrName, contractName);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	Contract output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetContractResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION PHANTASMA_VECTOR<Peer> PhantasmaAPI::GetPeers(PhantasmaError* out_error)
+PHANTASMA_FUNCTION PHANTASMA_VECTOR<Peer> PhantasmaAPI::GetPeers(PHANTASMA_ARENA_PARAM PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetPeersRequest(request);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	PHANTASMA_VECTOR<Peer> output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetPeersResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION bool PhantasmaAPI::RelaySend(const Char* receiptHex, PhantasmaError* out_error)
+PHANTASMA_FUNCTION bool PhantasmaAPI::RelaySend(PHANTASMA_ARENA_PARAM const Char* receiptHex, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeRelaySendRequest(request, receiptHex);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	bool output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseRelaySendResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION PHANTASMA_VECTOR<Receipt> PhantasmaAPI::RelayReceive(const Char* account, PhantasmaError* out_error)
+PHANTASMA_FUNCTION PHANTASMA_VECTOR<Receipt> PhantasmaAPI::RelayReceive(PHANTASMA_ARENA_PARAM const Char* account, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeRelayReceiveRequest(request, account);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	PHANTASMA_VECTOR<Receipt> output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseRelayReceiveResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION PHANTASMA_VECTOR<Event> PhantasmaAPI::GetEvents(const Char* account, PhantasmaError* out_error)
+PHANTASMA_FUNCTION PHANTASMA_VECTOR<Event> PhantasmaAPI::GetEvents(PHANTASMA_ARENA_PARAM const Char* account, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetEventsRequest(request, account);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	PHANTASMA_VECTOR<Event> output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetEventsResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION PHANTASMA_VECTOR<Platform> PhantasmaAPI::GetPlatforms(PhantasmaError* out_error)
+PHANTASMA_FUNCTION PHANTASMA_VECTOR<Platform> PhantasmaAPI::GetPlatforms(PHANTASMA_ARENA_PARAM PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetPlatformsRequest(request);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	PHANTASMA_VECTOR<Platform> output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetPlatformsResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION PHANTASMA_VECTOR<Validator> PhantasmaAPI::GetValidators(PhantasmaError* out_error)
+PHANTASMA_FUNCTION PHANTASMA_VECTOR<Validator> PhantasmaAPI::GetValidators(PHANTASMA_ARENA_PARAM PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetValidatorsRequest(request);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	PHANTASMA_VECTOR<Validator> output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetValidatorsResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION String PhantasmaAPI::SettleSwap(const Char* sourcePlatform, const Char* destPlatform, const Char* hashText, PhantasmaError* out_error)
+PHANTASMA_FUNCTION String PhantasmaAPI::SettleSwap(PHANTASMA_ARENA_PARAM const Char* sourcePlatform, const Char* destPlatform, const Char* hashText, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeSettleSwapRequest(request, sourcePlatform, destPlatform, hashText);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	String output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseSettleSwapResponse(json::Parse(response), output, out_error);
 	return output;
 }
 
-PHANTASMA_FUNCTION PHANTASMA_VECTOR<Swap> PhantasmaAPI::GetSwapsForAddress(const Char* account, PhantasmaError* out_error)
+PHANTASMA_FUNCTION PHANTASMA_VECTOR<Swap> PhantasmaAPI::GetSwapsForAddress(PHANTASMA_ARENA_PARAM const Char* account, PhantasmaError* out_error)
 {
 	JSONBuilder request;
 	PhantasmaJsonAPI::MakeGetSwapsForAddressRequest(request, account);
-	const JSONDocument& response = HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error);
+	const JSONDocument& response = PHANTASMA_ARENA_KEEP(HttpPost(m_httpClient, PhantasmaJsonAPI::Uri(), request, out_error));
 	PHANTASMA_VECTOR<Swap> output;
 	if( !out_error || out_error->code == 0 )
 		PhantasmaJsonAPI::ParseGetSwapsForAddressResponse(json::Parse(response), output, out_error);
@@ -3723,146 +5581,1168 @@ PHANTASMA_FUNCTION PHANTASMA_VECTOR<Swap> PhantasmaAPI::GetSwapsForAddress(const
 }
 
 #endif
-}
+#if defined(PHANTASMA_ASYNC_HTTPCLIENT)
 
-namespace json
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetAccount(const Char* account, std::function<void(Account& output, PhantasmaError& error)> onComplete)
 {
-#ifndef PHANTASMA_JSONVALUE
-//------------------------------------------------------------------------------
-// Built-in JSON parsing library:
-//------------------------------------------------------------------------------
-    JSONValue Parse(const JSONDocument& doc) { return doc; }
-
-	inline size_t SkipNumber(const JSONValue& v, size_t i, bool& out_error)
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetAccountRequest(request, account);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
 	{
-		size_t j = v.find_first_not_of(PHANTASMA_LITERAL("+-0123456789.eE"), i);
-		if( i==j ) { PHANTASMA_EXCEPTION("Invalid Number"); out_error = true; return i+1; }
-		return j;
-	}
-	inline size_t SkipString(const JSONValue& v, size_t i, bool& out_error)
+		Account output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetAccountResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::LookUpName(const Char* name, std::function<void(String& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeLookUpNameRequest(request, name);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
 	{
-		if( v[i] != '"' ) { PHANTASMA_EXCEPTION("Invalid String"); out_error = true; return i+1; }
-		for(++i; i<v.size();)
+		String output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
 		{
-			i =  v.find_first_of(PHANTASMA_LITERAL("\"\\"), i);
-			if( i == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated String"); out_error = true; return i; }
-			if( v[i] == '"' ) { break; }
-			if( i+1 < v.size() )
+			PHANTASMA_TRY
 			{
-				switch(v[i+1])
-				{
-				case '\\': case 'b': case 'f': case 'n': case 'r': case 't': case '"': i = i+2; continue;
-				case 'u': i = i+6; continue;
-				}
+				PhantasmaJsonAPI::ParseLookUpNameResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
 			}
-			PHANTASMA_EXCEPTION("Invalid Escape sequence"); out_error = true; ++i;
 		}
-		return i == JSONValue::npos ? i : i+1;
-	}
-	inline size_t SkipBoolNull(const JSONValue& v, size_t i, bool& out_error)
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetBlockHeight(const Char* chainInput, std::function<void(Int32& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetBlockHeightRequest(request, chainInput);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
 	{
-		switch(v[i])
+		Int32 output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
 		{
-		case 'f': if(v.compare(i, 5, PHANTASMA_LITERAL("false"))) { break; } return i+5;
-		case 't': if(v.compare(i, 4, PHANTASMA_LITERAL("true")))  { break; } return i+4;
-		case 'n': if(v.compare(i, 4, PHANTASMA_LITERAL("null")))  { break; } return i+4;
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetBlockHeightResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
 		}
-		PHANTASMA_EXCEPTION("Invalid Value"); out_error = true; return i+1;
-	}
-	inline size_t SkipObject(const JSONValue& v, size_t i, bool& out_error);
-	inline size_t SkipArray(const JSONValue& v, size_t i, bool& out_error)
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetBlockTransactionCountByHash(const Char* blockHash, std::function<void(Int32& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetBlockTransactionCountByHashRequest(request, blockHash);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
 	{
-		if( v[i] != '[' ) { PHANTASMA_EXCEPTION("Invalid Array"); out_error = true; return i+1; }
-		++i;
-		for(; i<v.size();)
+		Int32 output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
 		{
-			i = v.find_first_not_of(PHANTASMA_LITERAL(", \t\r\n\f\b"), i);
-			if( i == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated array"); out_error = true; return i; }
-			switch( v[i] )
+			PHANTASMA_TRY
 			{
-			case ']': return i+1;
-			case '{': i = SkipObject(v, i, out_error); break;
-			case '[': i = SkipArray(v, i, out_error); break;
-			case '"': i = SkipString(v, i, out_error); break;
-			case 't': case 'f': case 'n': i = SkipBoolNull(v, i, out_error); break;
-			default:  i = SkipNumber(v, i, out_error); break;
+				PhantasmaJsonAPI::ParseGetBlockTransactionCountByHashResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
 			}
 		}
-		PHANTASMA_EXCEPTION("Unterminated array");
-		out_error = true;
-		return i == JSONValue::npos ? i : i+1;
-	}
-	inline size_t SkipObject(const JSONValue& v, size_t i, bool& out_error)
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetBlockByHash(const Char* blockHash, std::function<void(Block& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetBlockByHashRequest(request, blockHash);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
 	{
-		if( v[i] != '{' ) { PHANTASMA_EXCEPTION("Invalid object"); out_error = true; return i+1; }
-		for(; i<v.size();)
+		Block output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
 		{
-			size_t keyBegin = v.find_first_of(PHANTASMA_LITERAL("\"}"), i);
-			if( keyBegin == JSONValue::npos || v[keyBegin] == '}' ) { break; }//no more keys
-			size_t keyEnd = v.find_first_of('"', keyBegin+1);
-			if( keyEnd == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated string"); out_error = true; break; }
-			size_t valueBegin = v.find_first_not_of(PHANTASMA_LITERAL(" \t\r\n\f\b:"), keyEnd+1);
-			if( valueBegin == JSONValue::npos ) { PHANTASMA_EXCEPTION("No value following object key"); out_error = true; break; }
-			Char value0 = v[valueBegin];
-			switch(value0)
+			PHANTASMA_TRY
 			{
-			case '{': i = SkipObject(v, valueBegin, out_error); break;
-			case '[': i = SkipArray(v, valueBegin, out_error); break;
-			case '"': i = SkipString(v, valueBegin, out_error); break;
-			case 't': case 'f': case 'n': i = SkipBoolNull(v, valueBegin, out_error); break;
-			default:  i = SkipNumber(v, valueBegin, out_error); break;
+				PhantasmaJsonAPI::ParseGetBlockByHashResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
 			}
 		}
-		return i == JSONValue::npos ? i : i+1;
-	}
+		onComplete(output, error);
+	});
+}
 
-	PHANTASMA_FUNCTION bool LookupBool(const JSONValue& v, const Char* field, bool& out_error)       { return AsBool( LookupValue(v, field, out_error), out_error); }
-	PHANTASMA_FUNCTION Int32 LookupInt32(const JSONValue& v, const Char* field, bool& out_error)     { return AsInt32( LookupValue(v, field, out_error), out_error); }
-	PHANTASMA_FUNCTION UInt32 LookupUInt32(const JSONValue& v, const Char* field, bool& out_error)   { return AsUInt32(LookupValue(v, field, out_error), out_error); }
-	PHANTASMA_FUNCTION String LookupString(const JSONValue& v, const Char* field, bool& out_error)   { return AsString(LookupValue(v, field, out_error), out_error); }
-	PHANTASMA_FUNCTION JSONArray LookupArray(const JSONValue& v, const Char* field, bool& out_error) { return AsArray(LookupValue(v, field, out_error), out_error); }
-	PHANTASMA_FUNCTION bool HasField(const JSONValue& v, const Char* field, bool& out_error)         { return JSONValue() != LookupValue(v, field, out_error); }
-	PHANTASMA_FUNCTION bool HasArrayField(const JSONValue& v, const Char* field, bool& out_error)    { return IsArray(LookupValue(v, field, out_error), out_error); }
-	PHANTASMA_FUNCTION JSONValue LookupValue(const JSONValue& v, const Char* field, bool& out_error)
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetRawBlockByHash(const Char* blockHash, std::function<void(String& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetRawBlockByHashRequest(request, blockHash);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
 	{
-		if( v.length() < 1 || v[0] != '{' ) { out_error = true; return JSONValue(); }
-		size_t fieldLen = PHANTASMA_STRLEN(field);
-		for(size_t i=0; i<v.size();)
+		String output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
 		{
-			size_t keyBegin = v.find_first_of(PHANTASMA_LITERAL("\"}"), i);
-			if( keyBegin == JSONValue::npos || v[keyBegin] == '}' ) { break; }//no more keys
-			++keyBegin;
-			size_t keyEnd = v.find_first_of('"', keyBegin);
-			if( keyEnd == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated string"); out_error = true; break; }
-			size_t valueBegin = v.find_first_not_of(PHANTASMA_LITERAL(" \t\r\n\f\b:"), keyEnd+1);
-			if( valueBegin == JSONValue::npos ) { PHANTASMA_EXCEPTION("No value following object key"); out_error = true; break; }
-			size_t keyLen = keyEnd-keyBegin;
-			bool correctKey = fieldLen == keyLen && 0==v.compare(keyBegin, keyLen, field);
-			if( correctKey )
-				return v.substr(valueBegin);//should really be using string views if this was a serious json parser...
-			Char value0 = v[valueBegin];
-			switch(value0)
+			PHANTASMA_TRY
 			{
-			case '{': i = SkipObject(v, valueBegin, out_error); break;
-			case '[': i = SkipArray( v, valueBegin, out_error); break;
-			case '"': i = SkipString(v, valueBegin, out_error); break;
-			case 't': case 'f': case 'n': i = SkipBoolNull(v, valueBegin, out_error); break;
-			default:  i = SkipNumber(v, valueBegin, out_error); break;
+				PhantasmaJsonAPI::ParseGetRawBlockByHashResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
 			}
 		}
-		return JSONValue();
-	}
-	PHANTASMA_FUNCTION bool AsBool(const JSONValue& v, bool& out_error)
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetBlockByHeight(const Char* chainInput, UInt32 height, std::function<void(Block& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetBlockByHeightRequest(request, chainInput, height);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
 	{
-		if( v.length() < 1 ) { out_error = true; return false; }
-		switch(v[0])
+		Block output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
 		{
-		default: PHANTASMA_EXCEPTION("Casting non-bool value to bool"); out_error = true;
-		case 'f': return false;
-		case 't': return true;
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetBlockByHeightResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
 		}
-	}
-	PHANTASMA_FUNCTION Int32  AsInt32(const JSONValue& v, bool& out_error)
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetRawBlockByHeight(const Char* chainInput, UInt32 height, std::function<void(String& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetRawBlockByHeightRequest(request, chainInput, height);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		String output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetRawBlockByHeightResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetTransactionByBlockHashAndIndex(const Char* blockHash, Int32 index, std::function<void(Transaction& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetTransactionByBlockHashAndIndexRequest(request, blockHash, index);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		Transaction output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetTransactionByBlockHashAndIndexResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetAddressTransactions(const Char* account, UInt32 page, UInt32 pageSize, std::function<void(AccountTransactions& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetAddressTransactionsRequest(request, account, page, pageSize);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		AccountTransactions output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetAddressTransactionsResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetAddressTransactionCount(const Char* account, const Char* chainInput, std::function<void(Int32& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetAddressTransactionCountRequest(request, account, chainInput);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		Int32 output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetAddressTransactionCountResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::SendRawTransaction(const Char* txData, std::function<void(String& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeSendRawTransactionRequest(request, txData);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		String output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseSendRawTransactionResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::InvokeRawScript(const Char* chainInput, const Char* scriptData, std::function<void(Script& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeInvokeRawScriptRequest(request, chainInput, scriptData);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		Script output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseInvokeRawScriptResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetTransaction(const Char* hashText, std::function<void(Transaction& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetTransactionRequest(request, hashText);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		Transaction output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetTransactionResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::CancelTransaction(const Char* hashText, std::function<void(String& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeCancelTransactionRequest(request, hashText);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		String output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseCancelTransactionResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetChains(std::function<void(PHANTASMA_VECTOR<Chain>& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetChainsRequest(request);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		PHANTASMA_VECTOR<Chain> output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetChainsResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetNexus(bool extended, std::function<void(Nexus& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetNexusRequest(request, extended);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		Nexus output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetNexusResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetOrganization(const Char* ID, std::function<void(Organization& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetOrganizationRequest(request, ID);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		Organization output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetOrganizationResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetLeaderboard(const Char* name, std::function<void(Leaderboard& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetLeaderboardRequest(request, name);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		Leaderboard output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetLeaderboardResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetTokens(bool extended, std::function<void(PHANTASMA_VECTOR<Token>& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetTokensRequest(request, extended);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		PHANTASMA_VECTOR<Token> output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetTokensResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetToken(const Char* symbol, bool extended, std::function<void(Token& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetTokenRequest(request, symbol, extended);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		Token output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetTokenResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetTokenData(const Char* symbol, const Char* IDtext, std::function<void(TokenData& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetTokenDataRequest(request, symbol, IDtext);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		TokenData output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetTokenDataResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetNFT(const Char* symbol, const Char* IDtext, bool extended, std::function<void(TokenData& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetNFTRequest(request, symbol, IDtext, extended);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		TokenData output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetNFTResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetTokenBalance(const Char* account, const Char* tokenSymbol, const Char* chainInput, std::function<void(Balance& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetTokenBalanceRequest(request, account, tokenSymbol, chainInput);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		Balance output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetTokenBalanceResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetAuctionsCount(const Char* chainAddressOrName, const Char* symbol, std::function<void(Int32& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetAuctionsCountRequest(request, chainAddressOrName, symbol);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		Int32 output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetAuctionsCountResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetAuctions(const Char* chainAddressOrName, const Char* symbol, UInt32 page, UInt32 pageSize, std::function<void(PHANTASMA_VECTOR<Auction>& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetAuctionsRequest(request, chainAddressOrName, symbol, page, pageSize);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		PHANTASMA_VECTOR<Auction> output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetAuctionsResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetAuction(const Char* chainAddressOrName, const Char* symbol, const Char* IDtext, std::function<void(Auction& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetAuctionRequest(request, chainAddressOrName, symbol, IDtext);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		Auction output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetAuctionResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetArchive(const Char* hashText, std::function<void(Archive& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetArchiveRequest(request, hashText);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		Archive output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetArchiveResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::WriteArchive(const Char* hashText, Int32 blockIndex, const Char* blockContent, std::function<void(bool& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeWriteArchiveRequest(request, hashText, blockIndex, blockContent);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		bool output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseWriteArchiveResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::ReadArchive(const Char* hashText, Int32 blockIndex, std::function<void(String& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeReadArchiveRequest(request, hashText, blockIndex);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		String output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseReadArchiveResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetContract(const Char* chainAddressOrName, const Char* contractName, std::function<void(Contract& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetContractRequest(request, chainAddressOrName, contractName);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		Contract output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetContractResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetPeers(std::function<void(PHANTASMA_VECTOR<Peer>& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetPeersRequest(request);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		PHANTASMA_VECTOR<Peer> output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetPeersResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::RelaySend(const Char* receiptHex, std::function<void(bool& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeRelaySendRequest(request, receiptHex);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		bool output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseRelaySendResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::RelayReceive(const Char* account, std::function<void(PHANTASMA_VECTOR<Receipt>& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeRelayReceiveRequest(request, account);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		PHANTASMA_VECTOR<Receipt> output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseRelayReceiveResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetEvents(const Char* account, std::function<void(PHANTASMA_VECTOR<Event>& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetEventsRequest(request, account);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		PHANTASMA_VECTOR<Event> output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetEventsResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetPlatforms(std::function<void(PHANTASMA_VECTOR<Platform>& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetPlatformsRequest(request);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		PHANTASMA_VECTOR<Platform> output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetPlatformsResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetValidators(std::function<void(PHANTASMA_VECTOR<Validator>& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetValidatorsRequest(request);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		PHANTASMA_VECTOR<Validator> output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetValidatorsResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::SettleSwap(const Char* sourcePlatform, const Char* destPlatform, const Char* hashText, std::function<void(String& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeSettleSwapRequest(request, sourcePlatform, destPlatform, hashText);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		String output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseSettleSwapResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+
+PHANTASMA_FUNCTION void AsyncPhantasmaAPI::GetSwapsForAddress(const Char* account, std::function<void(PHANTASMA_VECTOR<Swap>& output, PhantasmaError& error)> onComplete)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetSwapsForAddressRequest(request, account);
+	HttpPostAsync(m_httpClient, PhantasmaJsonAPI::Uri(), request, [onComplete](const JSONDocument* response, const Char* httpError)
+	{
+		PHANTASMA_VECTOR<Swap> output;
+		PhantasmaError error;
+		if( !response )
+			OnHttpError(error, httpError);
+		else
+		{
+			PHANTASMA_TRY
+			{
+				PhantasmaJsonAPI::ParseGetSwapsForAddressResponse(json::Parse(*response), output, &error);
+			}
+			PHANTASMA_CATCH_ALL() // e.g. C++ REST throws on a missing field
+			{
+				error.code = PhantasmaError::InvalidJSON;
+			}
+		}
+		onComplete(output, error);
+	});
+}
+#endif
+}
+
+namespace json
+{
+#ifndef PHANTASMA_JSONVALUE
+//------------------------------------------------------------------------------
+// Built-in JSON parsing library:
+//------------------------------------------------------------------------------
+    JSONValue Parse(const JSONDocument& doc) { return doc; }
+
+#ifdef PHANTASMA_SIMD_X64
+# if defined(_MSC_VER) && !defined(__clang__)
+	inline int SimdLowestBit(unsigned mask) { unsigned long i; _BitScanForward(&i, mask); return (int)i; }
+# else
+	inline int SimdLowestBit(unsigned mask) { return __builtin_ctz(mask); }
+# endif
+	// Returns the index of the first a/b character, or the start of the final partial block
+	inline size_t ScanFor2SSE2(const char* s, size_t i, size_t n, char a, char b)
+	{
+		const __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b);
+		for(; i+16 <= n; i += 16)
+		{
+			__m128i x = _mm_loadu_si128((const __m128i*)(s+i));
+			unsigned mask = (unsigned)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(x, va), _mm_cmpeq_epi8(x, vb)));
+			if( mask ) { return i + SimdLowestBit(mask); }
+		}
+		return i;
+	}
+#endif
+	// Equivalent to v.find_first_of({a,b}, i)
+	inline size_t ScanFor2(const JSONValue& v, size_t i, Char a, Char b)
+	{
+#ifdef PHANTASMA_SIMD_X64
+		if( sizeof(Char) == 1 && i < v.size() )
+			i = ScanFor2SSE2((const char*)v.data(), i, v.size(), (char)a, (char)b);
+#endif
+		for(; i < v.size(); ++i)
+		{
+			if( v[i] == a || v[i] == b ) { return i; }
+		}
+		return JSONValue::npos;
+	}
+
+	inline size_t SkipNumber(const JSONValue& v, size_t i, bool& out_error)
+	{
+		size_t j = v.find_first_not_of(PHANTASMA_LITERAL("+-0123456789.eE"), i);
+		if( i==j ) { PHANTASMA_EXCEPTION("Invalid Number"); out_error = true; return i+1; }
+		return j;
+	}
+	inline size_t SkipString(const JSONValue& v, size_t i, bool& out_error)
+	{
+		if( v[i] != '"' ) { PHANTASMA_EXCEPTION("Invalid String"); out_error = true; return i+1; }
+		for(++i; i<v.size();)
+		{
+			i =  ScanFor2(v, i, '"', '\\');
+			if( i == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated String"); out_error = true; return i; }
+			if( v[i] == '"' ) { break; }
+			if( i+1 < v.size() )
+			{
+				switch(v[i+1])
+				{
+				case '\\': case 'b': case 'f': case 'n': case 'r': case 't': case '"': i = i+2; continue;
+				case 'u': i = i+6; continue;
+				}
+			}
+			PHANTASMA_EXCEPTION("Invalid Escape sequence"); out_error = true; ++i;
+		}
+		return i == JSONValue::npos ? i : i+1;
+	}
+	inline size_t SkipBoolNull(const JSONValue& v, size_t i, bool& out_error)
+	{
+		switch(v[i])
+		{
+		case 'f': if(v.compare(i, 5, PHANTASMA_LITERAL("false"))) { break; } return i+5;
+		case 't': if(v.compare(i, 4, PHANTASMA_LITERAL("true")))  { break; } return i+4;
+		case 'n': if(v.compare(i, 4, PHANTASMA_LITERAL("null")))  { break; } return i+4;
+		}
+		PHANTASMA_EXCEPTION("Invalid Value"); out_error = true; return i+1;
+	}
+	inline size_t SkipObject(const JSONValue& v, size_t i, bool& out_error);
+	inline size_t SkipArray(const JSONValue& v, size_t i, bool& out_error);
+	inline size_t SkipValue(const JSONValue& v, size_t i, bool& out_error)
+	{
+		switch( v[i] )
+		{
+		case '{': return SkipObject(v, i, out_error);
+		case '[': return SkipArray(v, i, out_error);
+		case '"': return SkipString(v, i, out_error);
+		case 't': case 'f': case 'n': return SkipBoolNull(v, i, out_error);
+		default:  return SkipNumber(v, i, out_error);
+		}
+	}
+	inline size_t SkipArray(const JSONValue& v, size_t i, bool& out_error)
+	{
+		if( v[i] != '[' ) { PHANTASMA_EXCEPTION("Invalid Array"); out_error = true; return i+1; }
+		++i;
+		for(; i<v.size();)
+		{
+			i = v.find_first_not_of(PHANTASMA_LITERAL(", \t\r\n\f\b"), i);
+			if( i == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated array"); out_error = true; return i; }
+			switch( v[i] )
+			{
+			case ']': return i+1;
+			case '{': i = SkipObject(v, i, out_error); break;
+			case '[': i = SkipArray(v, i, out_error); break;
+			case '"': i = SkipString(v, i, out_error); break;
+			case 't': case 'f': case 'n': i = SkipBoolNull(v, i, out_error); break;
+			default:  i = SkipNumber(v, i, out_error); break;
+			}
+		}
+		PHANTASMA_EXCEPTION("Unterminated array");
+		out_error = true;
+		return i == JSONValue::npos ? i : i+1;
+	}
+	inline size_t SkipObject(const JSONValue& v, size_t i, bool& out_error)
+	{
+		if( v[i] != '{' ) { PHANTASMA_EXCEPTION("Invalid object"); out_error = true; return i+1; }
+		for(; i<v.size();)
+		{
+			size_t keyBegin = ScanFor2(v, i, '"', '}');
+			if( keyBegin == JSONValue::npos || v[keyBegin] == '}' ) { break; }//no more keys
+			size_t keyEnd = v.find_first_of('"', keyBegin+1);
+			if( keyEnd == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated string"); out_error = true; break; }
+			size_t valueBegin = v.find_first_not_of(PHANTASMA_LITERAL(" \t\r\n\f\b:"), keyEnd+1);
+			if( valueBegin == JSONValue::npos ) { PHANTASMA_EXCEPTION("No value following object key"); out_error = true; break; }
+			Char value0 = v[valueBegin];
+			switch(value0)
+			{
+			case '{': i = SkipObject(v, valueBegin, out_error); break;
+			case '[': i = SkipArray(v, valueBegin, out_error); break;
+			case '"': i = SkipString(v, valueBegin, out_error); break;
+			case 't': case 'f': case 'n': i = SkipBoolNull(v, valueBegin, out_error); break;
+			default:  i = SkipNumber(v, valueBegin, out_error); break;
+			}
+		}
+		return i == JSONValue::npos ? i : i+1;
+	}
+
+	PHANTASMA_FUNCTION bool LookupBool(const JSONValue& v, const Char* field, bool& out_error)       { return AsBool( LookupValue(v, field, out_error), out_error); }
+	PHANTASMA_FUNCTION Int32 LookupInt32(const JSONValue& v, const Char* field, bool& out_error)     { return AsInt32( LookupValue(v, field, out_error), out_error); }
+	PHANTASMA_FUNCTION UInt32 LookupUInt32(const JSONValue& v, const Char* field, bool& out_error)   { return AsUInt32(LookupValue(v, field, out_error), out_error); }
+	PHANTASMA_FUNCTION String LookupString(const JSONValue& v, const Char* field, bool& out_error)   { return AsString(LookupValue(v, field, out_error), out_error); }
+	PHANTASMA_FUNCTION JSONArray LookupArray(const JSONValue& v, const Char* field, bool& out_error) { return AsArray(LookupValue(v, field, out_error), out_error); }
+	PHANTASMA_FUNCTION bool HasField(const JSONValue& v, const Char* field, bool& out_error)         { return JSONValue() != LookupValue(v, field, out_error); }
+	PHANTASMA_FUNCTION bool HasArrayField(const JSONValue& v, const Char* field, bool& out_error)    { return IsArray(LookupValue(v, field, out_error), out_error); }
+	PHANTASMA_FUNCTION JSONValue LookupValue(const JSONValue& v, const Char* field, bool& out_error)
+	{
+		if( v.length() < 1 || v[0] != '{' ) { out_error = true; return JSONValue(); }
+		size_t fieldLen = PHANTASMA_STRLEN(field);
+		for(size_t i=0; i<v.size();)
+		{
+			size_t keyBegin = ScanFor2(v, i, '"', '}');
+			if( keyBegin == JSONValue::npos || v[keyBegin] == '}' ) { break; }//no more keys
+			++keyBegin;
+			size_t keyEnd = v.find_first_of('"', keyBegin);
+			if( keyEnd == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated string"); out_error = true; break; }
+			size_t valueBegin = v.find_first_not_of(PHANTASMA_LITERAL(" \t\r\n\f\b:"), keyEnd+1);
+			if( valueBegin == JSONValue::npos ) { PHANTASMA_EXCEPTION("No value following object key"); out_error = true; break; }
+			size_t keyLen = keyEnd-keyBegin;
+			bool correctKey = fieldLen == keyLen && 0==v.compare(keyBegin, keyLen, field);
+			if( correctKey )
+				return v.substr(valueBegin);//should really be using string views if this was a serious json parser...
+			Char value0 = v[valueBegin];
+			switch(value0)
+			{
+			case '{': i = SkipObject(v, valueBegin, out_error); break;
+			case '[': i = SkipArray( v, valueBegin, out_error); break;
+			case '"': i = SkipString(v, valueBegin, out_error); break;
+			case 't': case 'f': case 'n': i = SkipBoolNull(v, valueBegin, out_error); break;
+			default:  i = SkipNumber(v, valueBegin, out_error); break;
+			}
+		}
+		return JSONValue();
+	}
+	PHANTASMA_FUNCTION bool AsBool(const JSONValue& v, bool& out_error)
+	{
+		if( v.length() < 1 ) { out_error = true; return false; }
+		switch(v[0])
+		{
+		default: PHANTASMA_EXCEPTION("Casting non-bool value to bool"); out_error = true;
+		case 'f': return false;
+		case 't': return true;
+		}
+	}
+	PHANTASMA_FUNCTION Int32  AsInt32(const JSONValue& v, bool& out_error)
 	{
 		const Char* numeric = PHANTASMA_LITERAL("-0123456789");
 		size_t begin = v.find_first_of(numeric, 0);
@@ -3880,6 +6760,15 @@ namespace json
 		if( pos == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated string"); out_error = true; return String(); }
 		return String(v.substr(1, pos-1));
 	}
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+	PHANTASMA_FUNCTION StringView AsStringView(const JSONValue& v, bool& out_error)
+	{
+		if( v.length() < 1 || v[0] != '"' ) { PHANTASMA_EXCEPTION("Casting non-string value to string"); out_error = true; return StringView(); }
+		size_t pos = v.find('"', 1);
+		if( pos == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated string"); out_error = true; return StringView(); }
+		return v.substr(1, pos-1);
+	}
+#endif
 	PHANTASMA_FUNCTION JSONArray AsArray(const JSONValue& v, bool& out_error) { if(!IsArray(v, out_error)) { PHANTASMA_EXCEPTION("Casting non-array value to array"); out_error = true; } return v; }
 	PHANTASMA_FUNCTION bool IsArray(const JSONValue& v, bool& out_error)
 	{
@@ -3937,6 +6826,111 @@ namespace json
 		out_error = true;
 		return JSONValue();
 	}
+	PHANTASMA_FUNCTION JSONArrayCursor ArrayBegin(const JSONArray& v, bool& out_error)
+	{
+		if( v.length() < 1 || v[0] != '[' ) { PHANTASMA_EXCEPTION("Invalid Array"); out_error = true; return JSONArrayCursor{ &v, JSONValue::npos, 0 }; }
+		size_t i = v.find_first_not_of(PHANTASMA_LITERAL(" \t\r\n\f\b"), 1);
+		if( i == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated array"); out_error = true; }
+		return JSONArrayCursor{ &v, i, 0 };
+	}
+	PHANTASMA_FUNCTION bool ArrayValid(const JSONArrayCursor& c, bool&)
+	{
+		return c.position < c.array->size() && (*c.array)[c.position] != ']';
+	}
+	PHANTASMA_FUNCTION void ArrayNext(JSONArrayCursor& c, bool& out_error)
+	{
+		const JSONValue& v = *c.array;
+		size_t i = SkipValue(v, c.position, out_error);
+		if( i != JSONValue::npos )
+			i = v.find_first_not_of(PHANTASMA_LITERAL(" \t\r\n\f\b"), i);
+		if( i != JSONValue::npos && v[i] == ',' )
+			i = v.find_first_not_of(PHANTASMA_LITERAL(" \t\r\n\f\b"), i+1);
+		else if( i == JSONValue::npos || v[i] != ']' )
+		{
+			PHANTASMA_EXCEPTION("Unterminated array");
+			out_error = true;
+			i = JSONValue::npos;
+		}
+		c.position = i;
+	}
+	PHANTASMA_FUNCTION JSONValue ArrayValue(const JSONArrayCursor& c, bool&)
+	{
+		return c.array->substr(c.position);
+	}
+	inline void FindObjectKey(JSONObjectCursor& c, size_t i, bool& out_error)
+	{
+		const JSONValue& v = *c.object;
+		c.keyBegin = JSONValue::npos;
+		size_t keyBegin = ScanFor2(v, i, '"', '}');
+		if( keyBegin == JSONValue::npos || v[keyBegin] == '}' ) { return; }//no more keys
+		++keyBegin;
+		size_t keyEnd = v.find_first_of('"', keyBegin);
+		if( keyEnd == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated string"); out_error = true; return; }
+		size_t valueBegin = v.find_first_not_of(PHANTASMA_LITERAL(" \t\r\n\f\b:"), keyEnd+1);
+		if( valueBegin == JSONValue::npos ) { PHANTASMA_EXCEPTION("No value following object key"); out_error = true; return; }
+		c.keyBegin = keyBegin;
+		c.keyEnd = keyEnd;
+		c.valueBegin = valueBegin;
+	}
+	PHANTASMA_FUNCTION JSONObjectCursor ObjectBegin(const JSONValue& v, bool& out_error)
+	{
+		JSONObjectCursor c{ &v, JSONValue::npos, 0, 0 };
+		if( v.length() < 1 || v[0] != '{' ) { PHANTASMA_EXCEPTION("Invalid object"); out_error = true; return c; }
+		FindObjectKey(c, 1, out_error);
+		return c;
+	}
+	PHANTASMA_FUNCTION bool ObjectValid(const JSONObjectCursor& c, bool&)
+	{
+		return c.keyBegin != JSONValue::npos;
+	}
+	PHANTASMA_FUNCTION void ObjectNext(JSONObjectCursor& c, bool& out_error)
+	{
+		size_t i = SkipValue(*c.object, c.valueBegin, out_error);
+		if( i == JSONValue::npos ) { PHANTASMA_EXCEPTION("Unterminated object"); out_error = true; c.keyBegin = JSONValue::npos; return; }
+		FindObjectKey(c, i, out_error);
+	}
+	PHANTASMA_FUNCTION const Char* ObjectKey(const JSONObjectCursor& c, size_t& out_length, bool&)
+	{
+		out_length = c.keyEnd - c.keyBegin;
+		return c.object->data() + c.keyBegin;
+	}
+	PHANTASMA_FUNCTION JSONValue ObjectValue(const JSONObjectCursor& c, bool&)
+	{
+		return c.object->substr(c.valueBegin);
+	}
+#else
+# ifndef PHANTASMA_JSONARRAYCURSOR
+//------------------------------------------------------------------------------
+// Array cursors for JSON libraries that only supply ArraySize/IndexArray:
+//------------------------------------------------------------------------------
+	PHANTASMA_FUNCTION JSONArrayCursor ArrayBegin(const JSONArray& a, bool& out_error) { return JSONArrayCursor{ &a, 0, (size_t)ArraySize(a, out_error) }; }
+	PHANTASMA_FUNCTION bool ArrayValid(const JSONArrayCursor& c, bool&)                { return c.position < c.size; }
+	PHANTASMA_FUNCTION void ArrayNext(JSONArrayCursor& c, bool&)                       { ++c.position; }
+	PHANTASMA_FUNCTION JSONValue ArrayValue(const JSONArrayCursor& c, bool& out_error) { return IndexArray(*c.array, (int)c.position, out_error); }
+# endif
+# ifndef PHANTASMA_JSONOBJECTCURSOR
+//------------------------------------------------------------------------------
+// Object cursors for JSON libraries that only supply HasField/LookupValue. They
+//  visit the fields of the RPC structure that the object has, in the order of
+//  the structure, rather than the members of the object:
+//------------------------------------------------------------------------------
+	inline void FindObjectKey(JSONObjectCursor& c, bool& out_error)
+	{
+		while( c.index < c.numKeys && !HasField(*c.object, c.keys[c.index], out_error) )
+			++c.index;
+	}
+	PHANTASMA_FUNCTION JSONObjectCursor ObjectBegin(const JSONValue& v, const Char* const* keys, int numKeys, bool& out_error)
+	{
+		JSONObjectCursor c{ &v, keys, numKeys, 0 };
+		if( !IsObject(v, out_error) ) { PHANTASMA_EXCEPTION("Invalid object"); out_error = true; c.index = numKeys; return c; }
+		FindObjectKey(c, out_error);
+		return c;
+	}
+	PHANTASMA_FUNCTION bool ObjectValid(const JSONObjectCursor& c, bool&)                                 { return c.index < c.numKeys; }
+	PHANTASMA_FUNCTION void ObjectNext(JSONObjectCursor& c, bool& out_error)                              { ++c.index; FindObjectKey(c, out_error); }
+	PHANTASMA_FUNCTION const Char* ObjectKey(const JSONObjectCursor& c, size_t& out_length, bool&)        { out_length = PHANTASMA_STRLEN(c.keys[c.index]); return c.keys[c.index]; }
+	PHANTASMA_FUNCTION JSONValue ObjectValue(const JSONObjectCursor& c, bool& out_error)                  { return LookupValue(*c.object, c.keys[c.index], out_error); }
+# endif
 #endif
 #ifndef PHANTASMA_JSONBUILDER
 	PHANTASMA_FUNCTION void BeginObject(JSONBuilder& b)                                   { b.BeginObject(); }
@@ -3944,6 +6938,8 @@ namespace json
 	template<class... Args>
 	void AddArray(JSONBuilder& b, const Char* key, Args... args)                          { b.AddArray(key, args...); }
 	PHANTASMA_FUNCTION void EndObject(JSONBuilder& b)                                     { b.EndObject(); }
+	PHANTASMA_FUNCTION void BeginArray(JSONBuilder& b)                                    { b.BeginArray(); }
+	PHANTASMA_FUNCTION void EndArray(JSONBuilder& b)                                      { b.EndArray(); }
 #endif
 #endif
 }
@@ -39,6 +39,22 @@ public:
 		return *this;
 	}
 
+	// The allocation (and its lock) is handed over, so nothing is copied or exposed
+	SecureVector( SecureVector&& other ) noexcept
+		: data(std::move(other.data))
+	{
+	}
+
+	SecureVector& operator=( SecureVector&& other ) noexcept
+	{
+		if( this != &other )
+		{
+			clear();
+			PHANTASMA_SWAP(data, other.data);
+		}
+		return *this;
+	}
+
 	typedef typename PHANTASMA_VECTOR<T>::size_type size_type;
 
 	auto  begin()       { return data.begin(); }
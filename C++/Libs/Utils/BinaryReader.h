@@ -1,7 +1,7 @@
 #pragma once
 
 #include "TextUtils.h"
-#include "../Numerics/BigInteger.h"
+#include "../Numerics/Int256.h"
 
 namespace phantasma {
 class Hash;
@@ -94,16 +94,19 @@ public:
 	
 	void Read(Byte* b, int size)
 	{
-		UInt32 end = (UInt32)stream.size();
-		for( int i=0; i<size; ++i )
+		if( size <= 0 )
+			return;
+		UInt32 available = (UInt32)stream.size() - PHANTASMA_MIN(cursor, (UInt32)stream.size());
+		int count = (int)PHANTASMA_MIN((UInt32)size, available);
+		if( count )
 		{
-			if(cursor >= end)
-			{
-				error = true;
-				PHANTASMA_EXCEPTION("stream error");
-				break;
-			}
-			b[i] = stream[cursor++];
+			PHANTASMA_COPY(&stream[cursor], &stream[cursor] + count, b);
+			cursor += count;
+		}
+		if( count < size )
+		{
+			error = true;
+			PHANTASMA_EXCEPTION("stream error");
 		}
 	}
 	
@@ -157,6 +160,19 @@ public:
 		Read(bytes, size);
 		n = BigInteger::FromSignedArray(bytes);
 	}
+	template<bool S>
+	void ReadBigInteger(TInt256<S>& n)
+	{
+		Byte size = 0;
+		Byte bytes[255];
+		Read(size);
+		Read(bytes, size);
+		if( !TInt256<S>::TryFromSignedArray(bytes, error ? 0 : size, n) )
+		{
+			error = true;
+			PHANTASMA_EXCEPTION("number is too large");
+		}
+	}
 	
 	void ReadByteArray(ByteArray& bytes) 
 	{
@@ -2,7 +2,7 @@
 
 #include "TextUtils.h"
 #include "Serializable.h"
-#include "../Numerics/BigInteger.h"
+#include "../Numerics/Int256.h"
 
 namespace phantasma {
 class Hash;
@@ -105,6 +105,14 @@ public:
 		Write((Byte)bytes.size());
 		Write(bytes);
 	}
+	template<bool S>
+	void WriteBigInteger(const TInt256<S>& n)
+	{
+		Byte bytes[TInt256<S>::Words * 4 + 2];
+		int size = n.ToSignedByteArray(bytes, (int)sizeof(bytes));
+		Write((Byte)size);
+		Write(bytes, size);
+	}
 
 	void WriteByteArray(const Byte* bytes, int numBytes)
 	{
@@ -0,0 +1,218 @@
+#pragma once
+#ifndef PHANTASMA_API_INCLUDED
+#error "Configure and include PhantasmaAPI.h first"
+#endif
+#ifndef PHANTASMA_HTTPCLIENT
+#error "BlockRangeFetcher requires an HTTP client. Define PHANTASMA_HTTPCLIENT or include an HTTP adaptor"
+#endif
+#if defined(PHANTASMA_RPC_STRINGVIEW)
+#error "BlockRangeFetcher.h requires rpc strings that own their text. Do not define PHANTASMA_RPC_STRINGVIEW"
+#endif
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// Fetching ranges of blocks
+//------------------------------------------------------------------------------
+// Fetching one block at a time costs a network round trip per block.
+//  BlockRangeFetcher keeps many requests in flight instead: each of its
+//  worker threads fetches and parses blocks with its own HttpClient, while the
+//  consumer receives the blocks strictly in height order.
+//
+//     CurlClient clients[4];
+//     BlockRangeFetcher fetcher(clients, 4);
+//     fetcher.Start("main", 1, height);
+//     rpc::Block block;
+//     while( fetcher.Next(block, &err) )
+//         Index(block);
+//
+// At most Options::window blocks are fetched ahead of the consumer, so a slow
+//  consumer holds the workers back (and bounds memory use) rather than letting
+//  the blocks pile up. If Options::batchSize is greater than one, each worker
+//  requests that many consecutive heights per HTTP request, as a JSON-RPC
+//  batch (see RpcBatch).
+//
+// Requests that fail because of the connection or an invalid response are
+//  retried up to Options::maxRetries times. Any other error stops the fetch,
+//  and is reported by Next once the blocks before it have been delivered.
+//------------------------------------------------------------------------------
+
+namespace phantasma {
+
+class BlockRangeFetcher
+{
+public:
+	struct Options
+	{
+		int window = 64;     // blocks that may be fetched ahead of the consumer
+		int batchSize = 1;   // consecutive heights per HTTP request
+		int maxRetries = 2;
+	};
+
+	// One worker thread is used per client. The clients must have a longer lifetime than this fetcher.
+	BlockRangeFetcher(HttpClient* clients, int numClients) : BlockRangeFetcher(clients, numClients, Options{}) {}
+	BlockRangeFetcher(HttpClient* clients, int numClients, const Options& options)
+		: m_options(options)
+	{
+		m_options.batchSize = PHANTASMA_MAX(m_options.batchSize, 1);
+		m_options.window = PHANTASMA_MAX(m_options.window, m_options.batchSize);
+		m_slots.resize(m_options.window);
+		for( int i = 0; i < numClients; ++i )
+			m_apis.emplace_back(new rpc::PhantasmaAPI(clients[i]));
+	}
+	~BlockRangeFetcher()
+	{
+		Stop();
+	}
+	BlockRangeFetcher(const BlockRangeFetcher&) = delete;
+	BlockRangeFetcher& operator=(const BlockRangeFetcher&) = delete;
+
+	// Starts fetching the blocks from fromHeight to toHeight inclusive, stopping any previous fetch
+	void Start(const Char* chain, UInt32 fromHeight, UInt32 toHeight)
+	{
+		Stop();
+		m_chain = chain;
+		m_nextFetch = m_nextDeliver = fromHeight;
+		m_end = (UInt64)toHeight + 1;
+		m_stopped = false;
+		m_failed = false;
+		for( Slot& slot : m_slots )
+			slot = Slot{};
+		for( std::unique_ptr<rpc::PhantasmaAPI>& api : m_apis )
+			m_workers.emplace_back(&BlockRangeFetcher::Work, this, api.get());
+	}
+	// Cancels the fetch, and waits for the requests in flight to complete
+	void Stop()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stopped = true;
+			m_changed.notify_all();
+		}
+		for( std::thread& worker : m_workers )
+			worker.join();
+		m_workers.clear();
+	}
+
+	// Waits for the block at the next height. Returns false once every block has been delivered, or if the
+	//  block could not be fetched (in which case out_error is set).
+	bool Next(rpc::Block& output, rpc::PhantasmaError* out_error = nullptr)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		if( m_nextDeliver >= m_end || m_workers.empty() )
+			return false;
+		Slot& slot = m_slots[m_nextDeliver % m_slots.size()];
+		m_changed.wait(lock, [&] { return slot.ready || m_stopped; });
+		if( !slot.ready )
+			return false;
+		if( slot.error.code )
+		{
+			if( out_error )
+				*out_error = slot.error;
+			m_end = m_nextDeliver; // nothing more will be delivered
+			return false;
+		}
+		output = std::move(slot.block);
+		slot = Slot{};
+		++m_nextDeliver;
+		m_changed.notify_all();
+		return true;
+	}
+	// Calls onBlock for each block in order, until it returns false. Returns false if a block could not be fetched.
+	bool Run(const std::function<bool(rpc::Block&)>& onBlock, rpc::PhantasmaError* out_error = nullptr)
+	{
+		rpc::PhantasmaError err_dummy;
+		rpc::PhantasmaError& error = out_error ? *out_error : err_dummy;
+		error = rpc::PhantasmaError{};
+		rpc::Block block;
+		while( Next(block, &error) )
+			if( !onBlock(block) )
+				break;
+		return error.code == 0;
+	}
+
+	UInt64 NextHeight() const { std::lock_guard<std::mutex> lock(m_mutex); return m_nextDeliver; }
+private:
+	struct Slot
+	{
+		bool                ready = false;
+		rpc::Block          block;
+		rpc::PhantasmaError error;
+	};
+
+	Options m_options;
+	String  m_chain;
+	std::vector<std::unique_ptr<rpc::PhantasmaAPI>> m_apis;
+	std::vector<std::thread> m_workers;
+	std::vector<Slot>        m_slots; // ring buffer of the window, indexed by height
+	mutable std::mutex       m_mutex;
+	std::condition_variable  m_changed;
+	UInt64 m_nextFetch = 0;
+	UInt64 m_nextDeliver = 0;
+	UInt64 m_end = 0;
+	bool   m_stopped = true;
+	bool   m_failed = false;
+
+	void Work(rpc::PhantasmaAPI* api)
+	{
+		std::vector<rpc::Block> blocks(m_options.batchSize);
+		std::vector<rpc::PhantasmaError> errors(m_options.batchSize);
+		for(;;)
+		{
+			UInt64 first, count;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_changed.wait(lock, [&] { return m_stopped || m_failed || m_nextFetch >= m_end || m_nextFetch < m_nextDeliver + m_slots.size(); });
+				if( m_stopped || m_failed || m_nextFetch >= m_end )
+					return;
+				first = m_nextFetch;
+				count = PHANTASMA_MIN((UInt64)m_options.batchSize, m_end - first);
+				count = PHANTASMA_MIN(count, m_nextDeliver + m_slots.size() - first);
+				m_nextFetch += count;
+			}
+			for( int attempt = 0; ; ++attempt )
+			{
+				Fetch(*api, (UInt32)first, (int)count, blocks.data(), errors.data());
+				bool retry = false;
+				for( UInt64 i = 0; i < count; ++i )
+					retry = retry || rpc::IsTransientError(errors[i]);
+				if( !retry || attempt >= m_options.maxRetries )
+					break;
+			}
+			std::lock_guard<std::mutex> lock(m_mutex);
+			for( UInt64 i = 0; i < count; ++i )
+			{
+				Slot& slot = m_slots[(first + i) % m_slots.size()];
+				slot.block = std::move(blocks[i]);
+				slot.error = errors[i];
+				slot.ready = true;
+				m_failed = m_failed || errors[i].code != 0;
+			}
+			m_changed.notify_all();
+		}
+	}
+	void Fetch(rpc::PhantasmaAPI& api, UInt32 first, int count, rpc::Block* blocks, rpc::PhantasmaError* errors)
+	{
+		if( count == 1 )
+		{
+			errors[0] = rpc::PhantasmaError{};
+			blocks[0] = api.GetBlockByHeight(m_chain.c_str(), first, &errors[0]);
+			return;
+		}
+		rpc::RpcBatch batch(count);
+		for( int i = 0; i < count; ++i )
+		{
+			errors[i] = rpc::PhantasmaError{};
+			batch.Add(&rpc::PhantasmaJsonAPI::MakeGetBlockByHeightRequest, &rpc::PhantasmaJsonAPI::ParseGetBlockByHeightResponse,
+			          blocks[i], &errors[i], m_chain.c_str(), first + i);
+		}
+		api.Send(batch);
+	}
+};
+
+}
@@ -0,0 +1,564 @@
+#pragma once
+#ifndef PHANTASMA_API_INCLUDED
+#error "Configure and include PhantasmaAPI.h first"
+#endif
+
+#include "../Numerics/Base16.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//------------------------------------------------------------------------------
+// Storing blocks on disk
+//------------------------------------------------------------------------------
+// BlockStore keeps the raw (binary) blocks returned by GetRawBlockByHeight in
+//  a directory, so that re-indexing a chain does not have to download it
+//  again. Blocks are appended to segment files, and an index file maps each
+//  height to its segment and offset. Reading maps the segments into memory,
+//  so a stored block is accessed in place, without copying it:
+//
+//     BlockStore store;
+//     store.Open("blocks");
+//     if( !store.Has(height) )
+//         store.AppendRaw(height, api.GetRawBlockByHeight("main", height, &err));
+//     BlockView block;
+//     block.Parse(store.Get(height));
+//     block.ForEachTransaction([](const BlockView::TransactionView& tx)
+//     {
+//         tx.ForEachEvent([](const BlockView::EventView& e) { ... });
+//     });
+//
+// BlockView reads the binary format of a block (see Blockchain/Block.h for a
+//  decoder into objects) without allocating: its hashes, addresses, strings
+//  and byte arrays are ByteViews into the stored block.
+//
+// Blocks are never modified or removed. Each height can be stored once, in
+//  any order, but not below the first height that was stored. The views
+//  returned by Get remain valid until the next call to Append or Close.
+//  A BlockStore must not be used by several threads at once.
+//------------------------------------------------------------------------------
+
+namespace phantasma {
+
+struct ByteView
+{
+	const Byte* data = nullptr;
+	UInt32      length = 0;
+
+	bool empty() const { return length == 0; }
+	const Byte* begin() const { return data; }
+	const Byte* end() const { return data + length; }
+};
+
+class BlockStore
+{
+public:
+	struct Options
+	{
+		UInt64 segmentSize = 256 * 1024 * 1024; // a new segment file is started once a segment would exceed this
+		bool   flush = true;                    // flush the files after each append
+	};
+
+	BlockStore() {}
+	BlockStore(const Options& options) : m_options(options) {}
+	~BlockStore() { Close(); }
+	BlockStore(const BlockStore&) = delete;
+	BlockStore& operator=(const BlockStore&) = delete;
+
+	// Opens or creates the store in an existing directory. Index entries that refer past the end of their segment
+	//  (e.g. after a crash during an append) are discarded.
+	bool Open(const char* directory)
+	{
+		Close();
+		m_directory = directory;
+		if( !m_directory.empty() && m_directory.back() != '/' && m_directory.back() != '\\' )
+			m_directory += '/';
+		m_index = fopen((m_directory + "index.bin").c_str(), "r+b");
+		if( !m_index )
+			m_index = fopen((m_directory + "index.bin").c_str(), "w+b");
+		if( !m_index )
+			return false;
+
+		IndexHeader header;
+		if( fread(&header, sizeof(header), 1, m_index) == 1 )
+		{
+			if( header.magic != Magic || header.version != Version )
+			{
+				Close();
+				return false;
+			}
+			m_firstHeight = header.firstHeight;
+			Entry entry;
+			while( fread(&entry, sizeof(entry), 1, m_index) == 1 )
+				m_entries.push_back(entry);
+		}
+		else
+			m_firstHeight = 0;
+
+		for( UInt32 segment = 0; ; ++segment )
+		{
+			UInt64 size = 0;
+			if( !FileSize(SegmentPath(segment), size) )
+				break;
+			m_segments.push_back(Segment{});
+			m_segments.back().size = size;
+		}
+		bool discarded = false;
+		for( Entry& entry : m_entries )
+		{
+			if( entry.length && (entry.segment >= m_segments.size() || entry.offset + entry.length > m_segments[entry.segment].size) )
+			{
+				entry = Entry{};
+				discarded = true;
+			}
+		}
+		while( !m_entries.empty() && !m_entries.back().length )
+			m_entries.pop_back();
+		if( discarded && !RewriteIndex() )
+		{
+			Close();
+			return false;
+		}
+		return true;
+	}
+	void Close()
+	{
+		for( Segment& segment : m_segments )
+			Unmap(segment);
+		m_segments.clear();
+		m_entries.clear();
+		if( m_index )
+			fclose(m_index);
+		m_index = nullptr;
+		if( m_append )
+			fclose(m_append);
+		m_append = nullptr;
+	}
+
+	bool   IsOpen() const { return m_index != nullptr; }
+	bool   Has(UInt32 height) const { return Find(height) != nullptr; }
+	UInt32 FirstHeight() const { return m_firstHeight; }
+	UInt32 EndHeight() const { return m_firstHeight + (UInt32)m_entries.size(); } // one past the highest stored height
+
+	// Returns the stored block, or an empty view if there is none
+	ByteView Get(UInt32 height)
+	{
+		const Entry* entry = Find(height);
+		if( !entry )
+			return ByteView{};
+		Segment& segment = m_segments[entry->segment];
+		if( entry->offset + entry->length > segment.mappedSize && !Map(entry->segment) )
+			return ByteView{};
+		return ByteView{ segment.data + entry->offset, entry->length };
+	}
+
+	// Stores a block. Fails if the height is already stored, or is below the first stored height.
+	bool Append(UInt32 height, const Byte* block, UInt32 length)
+	{
+		if( !m_index || !block || !length || Has(height) )
+			return false;
+		if( m_entries.empty() && !WriteHeader(height) )
+			return false;
+		if( height < m_firstHeight )
+			return false;
+
+		if( m_segments.empty() || (m_segments.back().size && m_segments.back().size + length > m_options.segmentSize) )
+		{
+			if( m_append )
+				fclose(m_append);
+			m_append = nullptr;
+			m_segments.push_back(Segment{});
+		}
+		UInt32 segmentIndex = (UInt32)m_segments.size() - 1;
+		Segment& segment = m_segments.back();
+		if( !m_append )
+			m_append = fopen(SegmentPath(segmentIndex).c_str(), "ab");
+		if( !m_append || fwrite(block, 1, length, m_append) != length || (m_options.flush && fflush(m_append) != 0) )
+		{
+			if( m_append )
+				fclose(m_append);
+			m_append = nullptr;
+			FileSize(SegmentPath(segmentIndex), segment.size); // part of the block may have been written
+			return false;
+		}
+
+		Entry entry;
+		entry.segment = segmentIndex;
+		entry.length = length;
+		entry.offset = segment.size;
+		segment.size += length;
+		Unmap(segment); // the mapping no longer covers the segment
+
+		// the block is written before its index entry, so a crash never leaves an entry for a missing block
+		UInt32 slot = height - m_firstHeight;
+		if( slot >= m_entries.size() )
+			m_entries.resize(slot + 1);
+		m_entries[slot] = entry;
+		long position = (long)(sizeof(IndexHeader) + (UInt64)slot * sizeof(Entry));
+		if( fseek(m_index, 0, SEEK_END) != 0 )
+			return false;
+		for( long at = ftell(m_index); at < position; at += sizeof(Entry) ) // the heights that were skipped
+		{
+			Entry missing;
+			if( fwrite(&missing, sizeof(missing), 1, m_index) != 1 )
+				return false;
+		}
+		if( fseek(m_index, position, SEEK_SET) != 0 || fwrite(&entry, sizeof(entry), 1, m_index) != 1 || (m_options.flush && fflush(m_index) != 0) )
+			return false;
+		return true;
+	}
+	bool Append(UInt32 height, const ByteArray& block)
+	{
+		return Append(height, block.empty() ? nullptr : &block.front(), (UInt32)block.size());
+	}
+	// Stores the Base16 text returned by GetRawBlockByHeight / GetRawBlockByHash
+	bool AppendRaw(UInt32 height, const String& rawBlock)
+	{
+		return !rawBlock.empty() && Append(height, Base16::Decode(rawBlock));
+	}
+private:
+	constexpr static UInt32 Magic = 0x49424850; // "PHBI"
+	constexpr static UInt32 Version = 1;
+	struct IndexHeader
+	{
+		UInt32 magic = Magic;
+		UInt32 version = Version;
+		UInt32 firstHeight = 0;
+		UInt32 reserved = 0;
+	};
+	struct Entry
+	{
+		UInt32 segment = 0;
+		UInt32 length = 0; // 0 if the height is not stored
+		UInt64 offset = 0;
+	};
+	struct Segment
+	{
+		UInt64      size = 0;
+		const Byte* data = nullptr;
+		UInt64      mappedSize = 0;
+#ifdef _WIN32
+		HANDLE      file = INVALID_HANDLE_VALUE;
+		HANDLE      mapping = NULL;
+#endif
+	};
+
+	Options m_options;
+	std::string m_directory;
+	FILE* m_index = nullptr;
+	FILE* m_append = nullptr; // the last segment, opened for appending
+	UInt32 m_firstHeight = 0;
+	std::vector<Entry> m_entries; // indexed by height - m_firstHeight
+	std::vector<Segment> m_segments;
+
+	const Entry* Find(UInt32 height) const
+	{
+		if( height < m_firstHeight || height - m_firstHeight >= m_entries.size() )
+			return nullptr;
+		const Entry& entry = m_entries[height - m_firstHeight];
+		return entry.length ? &entry : nullptr;
+	}
+	bool WriteHeader(UInt32 firstHeight)
+	{
+		IndexHeader header;
+		header.firstHeight = firstHeight;
+		if( fseek(m_index, 0, SEEK_SET) != 0 || fwrite(&header, sizeof(header), 1, m_index) != 1 || fflush(m_index) != 0 )
+			return false;
+		m_firstHeight = firstHeight;
+		return true;
+	}
+	// Replaces the index file with the entries in memory
+	bool RewriteIndex()
+	{
+		m_index = freopen((m_directory + "index.bin").c_str(), "w+b", m_index);
+		if( !m_index )
+			return false;
+		IndexHeader header;
+		header.firstHeight = m_firstHeight;
+		if( fwrite(&header, sizeof(header), 1, m_index) != 1 )
+			return false;
+		if( !m_entries.empty() && fwrite(&m_entries.front(), sizeof(Entry), m_entries.size(), m_index) != m_entries.size() )
+			return false;
+		return fflush(m_index) == 0;
+	}
+	std::string SegmentPath(UInt32 segment) const
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "segment-%05u.bin", segment);
+		return m_directory + name;
+	}
+
+#ifdef _WIN32
+	static bool FileSize(const std::string& path, UInt64& size)
+	{
+		WIN32_FILE_ATTRIBUTE_DATA attributes;
+		if( !GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &attributes) )
+			return false;
+		size = ((UInt64)attributes.nFileSizeHigh << 32) | attributes.nFileSizeLow;
+		return true;
+	}
+	bool Map(UInt32 index)
+	{
+		Segment& segment = m_segments[index];
+		Unmap(segment);
+		if( !segment.size )
+			return false;
+		segment.file = CreateFileA(SegmentPath(index).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if( segment.file == INVALID_HANDLE_VALUE )
+			return false;
+		segment.mapping = CreateFileMappingA(segment.file, NULL, PAGE_READONLY, (DWORD)(segment.size >> 32), (DWORD)segment.size, NULL);
+		if( segment.mapping )
+			segment.data = (const Byte*)MapViewOfFile(segment.mapping, FILE_MAP_READ, 0, 0, (SIZE_T)segment.size);
+		if( !segment.data )
+		{
+			Unmap(segment);
+			return false;
+		}
+		segment.mappedSize = segment.size;
+		return true;
+	}
+	static void Unmap(Segment& segment)
+	{
+		if( segment.data )
+			UnmapViewOfFile(segment.data);
+		if( segment.mapping )
+			CloseHandle(segment.mapping);
+		if( segment.file != INVALID_HANDLE_VALUE )
+			CloseHandle(segment.file);
+		segment.data = nullptr;
+		segment.mapping = NULL;
+		segment.file = INVALID_HANDLE_VALUE;
+		segment.mappedSize = 0;
+	}
+#else
+	static bool FileSize(const std::string& path, UInt64& size)
+	{
+		struct stat info;
+		if( stat(path.c_str(), &info) != 0 )
+			return false;
+		size = (UInt64)info.st_size;
+		return true;
+	}
+	bool Map(UInt32 index)
+	{
+		Segment& segment = m_segments[index];
+		Unmap(segment);
+		if( !segment.size )
+			return false;
+		int file = open(SegmentPath(index).c_str(), O_RDONLY);
+		if( file < 0 )
+			return false;
+		void* data = mmap(nullptr, (size_t)segment.size, PROT_READ, MAP_SHARED, file, 0);
+		close(file);
+		if( data == MAP_FAILED )
+			return false;
+		segment.data = (const Byte*)data;
+		segment.mappedSize = segment.size;
+		return true;
+	}
+	static void Unmap(Segment& segment)
+	{
+		if( segment.data )
+			munmap((void*)segment.data, (size_t)segment.mappedSize);
+		segment.data = nullptr;
+		segment.mappedSize = 0;
+	}
+#endif
+};
+
+// Reads a block in its binary form (as stored by BlockStore, or decoded from GetRawBlockByHeight) without copying it
+class BlockView
+{
+public:
+	struct EventView
+	{
+		Byte     kind = 0;  // an EventKind (see Domain/Event.h)
+		ByteView address;   // 34 bytes
+		ByteView contract;  // UTF-8
+		ByteView data;
+	};
+	struct TransactionView
+	{
+		ByteView hash;      // 32 bytes
+		UInt32   eventCount = 0;
+		ByteView events;    // the serialized events, read by ForEachEvent
+		ByteView result;
+		bool     hasResult = false;
+
+		// Calls onEvent(const EventView&) for each event. Returns false if the events are malformed.
+		template<class Fn>
+		bool ForEachEvent(Fn onEvent) const
+		{
+			Reader reader{ events.data, events.data + events.length };
+			EventView event;
+			for( UInt32 i = 0; i != eventCount; ++i )
+			{
+				if( !ReadEvent(reader, event) )
+					return false;
+				onEvent(event);
+			}
+			return true;
+		}
+	};
+
+	// Reads the block's header. Returns false if it is malformed.
+	bool Parse(ByteView block)
+	{
+		*this = BlockView{};
+		Reader reader{ block.data, block.data + block.length };
+		UInt64 count = 0;
+		if( !reader.ReadLength(m_height, 1) || m_height.length > 8 ||
+			!reader.ReadUInt32(m_timestamp) ||
+			!reader.ReadByteArray(m_previousHash) ||
+			!reader.ReadByteArray(m_chainAddress) ||
+			!reader.ReadVarInt(m_protocol) ||
+			!reader.ReadVarInt(count) || count > block.length )
+			return false;
+		m_transactionCount = (UInt32)count;
+		m_transactions = reader.Rest();
+		return true;
+	}
+	bool Parse(const Byte* block, UInt32 length) { return Parse(ByteView{ block, length }); }
+
+	UInt64   Height() const
+	{
+		UInt64 height = 0; // little-endian, two's complement. Heights are never negative.
+		for( UInt32 i = m_height.length; i-- > 0; )
+			height = (height << 8) | m_height.data[i];
+		return height;
+	}
+	UInt32   Timestamp() const { return m_timestamp; }
+	ByteView PreviousHash() const { return m_previousHash; }
+	ByteView ChainAddress() const { return m_chainAddress; }
+	UInt32   Protocol() const { return (UInt32)m_protocol; }
+	UInt32   TransactionCount() const { return m_transactionCount; }
+
+	// Calls onTransaction(const TransactionView&) for each transaction. Returns false if the block is malformed.
+	template<class Fn>
+	bool ForEachTransaction(Fn onTransaction) const
+	{
+		Reader reader{ m_transactions.data, m_transactions.data + m_transactions.length };
+		TransactionView tx;
+		for( UInt32 i = 0; i != m_transactionCount; ++i )
+		{
+			if( !ReadTransaction(reader, tx) )
+				return false;
+			onTransaction(tx);
+		}
+		return true;
+	}
+private:
+	ByteView m_height;
+	UInt32   m_timestamp = 0;
+	ByteView m_previousHash;
+	ByteView m_chainAddress;
+	UInt64   m_protocol = 0;
+	UInt32   m_transactionCount = 0;
+	ByteView m_transactions;
+
+	struct Reader // bounds-checked cursor; every read fails once the end would be passed
+	{
+		const Byte* at;
+		const Byte* end;
+
+		bool Skip(UInt64 count, ByteView* output = nullptr)
+		{
+			if( count > (UInt64)(end - at) )
+				return false;
+			if( output )
+				*output = ByteView{ at, (UInt32)count };
+			at += count;
+			return true;
+		}
+		bool ReadByte(Byte& output)
+		{
+			if( at == end )
+				return false;
+			output = *at++;
+			return true;
+		}
+		bool ReadUInt(UInt64& output, int bytes)
+		{
+			ByteView view;
+			if( !Skip(bytes, &view) )
+				return false;
+			output = 0;
+			for( int i = bytes; i-- > 0; )
+				output = (output << 8) | view.data[i];
+			return true;
+		}
+		bool ReadUInt32(UInt32& output)
+		{
+			UInt64 value;
+			if( !ReadUInt(value, 4) )
+				return false;
+			output = (UInt32)value;
+			return true;
+		}
+		bool ReadVarInt(UInt64& output)
+		{
+			Byte header;
+			if( !ReadByte(header) )
+				return false;
+			switch( header )
+			{
+			case 0xFD: return ReadUInt(output, 2);
+			case 0xFE: return ReadUInt(output, 4);
+			case 0xFF: return ReadUInt(output, 8);
+			default:   output = header; return true;
+			}
+		}
+		// A length of lengthBytes bytes, followed by that many bytes
+		bool ReadLength(ByteView& output, int lengthBytes)
+		{
+			UInt64 length;
+			return ReadUInt(length, lengthBytes) && Skip(length, &output);
+		}
+		bool ReadByteArray(ByteView& output)
+		{
+			UInt64 length;
+			return ReadVarInt(length) && Skip(length, &output);
+		}
+		ByteView Rest() const { return ByteView{ at, (UInt32)(end - at) }; }
+	};
+
+	static bool ReadEvent(Reader& reader, EventView& output)
+	{
+		return reader.ReadByte(output.kind)
+		    && reader.ReadByteArray(output.address)
+		    && reader.ReadByteArray(output.contract)
+		    && reader.ReadByteArray(output.data);
+	}
+	static bool ReadTransaction(Reader& reader, TransactionView& output)
+	{
+		UInt64 count = 0;
+		if( !reader.ReadByteArray(output.hash) || !reader.ReadVarInt(count) || count > (UInt64)(reader.end - reader.at) )
+			return false;
+		output.eventCount = (UInt32)count;
+		const Byte* events = reader.at;
+		EventView event;
+		for( UInt64 i = 0; i != count; ++i )
+			if( !ReadEvent(reader, event) )
+				return false;
+		output.events = ByteView{ events, (UInt32)(reader.at - events) };
+		UInt64 resultLength = 0;
+		if( !reader.ReadUInt(resultLength, 2) )
+			return false;
+		output.hasResult = (int16_t)resultLength >= 0;
+		output.result = ByteView{};
+		return (int16_t)resultLength <= 0 || reader.ReadByteArray(output.result);
+	}
+};
+
+}
@@ -0,0 +1,328 @@
+#pragma once
+#ifndef PHANTASMA_API_INCLUDED
+#error "Configure and include PhantasmaAPI.h first"
+#endif
+#ifndef PHANTASMA_HTTPCLIENT
+#error "NodePool requires an HTTP client. Define PHANTASMA_HTTPCLIENT or include an HTTP adaptor"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// Load balancing over several nodes
+//------------------------------------------------------------------------------
+// NodePool wraps the HttpClients of several RPC nodes. Each call is routed to
+//  the fastest healthy node, judged by exponentially weighted moving averages
+//  (EWMA) of each node's latency and failure rate. A call that fails because
+//  of the node (HTTP errors and invalid responses, but not RPC error messages)
+//  is retried on the next best node.
+//
+//     CurlClient a("http://node-a:7077"), b("http://node-b:7077");
+//     NodePool pool;
+//     pool.Add(a);
+//     pool.Add(b);
+//     Int32 height = pool.Call([](PhantasmaAPI& api, PhantasmaError& err)
+//                              { return api.GetBlockHeight("main", &err); }, &err);
+//
+// If hedging is enabled, a call that has not completed after the node's 95th
+//  percentile latency is also sent to the next best node, and whichever
+//  response arrives first is used. This cuts tail latency at the cost of some
+//  duplicated requests. Hedged calls run on a worker thread per request; a
+//  node is only ever used by one request at a time, as HttpClients are not
+//  thread-safe. The slower duplicate still completes in the background (its
+//  node is unavailable until then), and its latency is recorded. So when
+//  hedging, requests must capture their arguments by value, not by reference.
+//
+// Call may be used from several threads at once; it waits for a free node if
+//  every node is busy.
+//------------------------------------------------------------------------------
+
+namespace phantasma {
+
+struct NodeStats
+{
+	double latencyMs = 0;      // EWMA of the response time
+	double failureRate = 0;    // EWMA of failures, from 0 (healthy) to 1 (every request fails)
+	double p95Ms = 0;          // 95th percentile of the recent response times, or 0 if there are too few samples
+	UInt32 requests = 0;
+	UInt32 failures = 0;
+	UInt32 hedges = 0;         // number of times this node was sent a duplicate of a slow request
+	bool   busy = false;
+};
+
+class NodePool
+{
+public:
+	struct Options
+	{
+		double ewmaWeight = 0.2;        // weight of the newest sample in the moving averages
+		double unhealthyRate = 0.5;     // nodes whose failure rate is above this are only used when no healthy node is free,
+		int    retryUnhealthyMs = 5000; //  until this long after their last failure
+		double failurePenaltyMs = 1000; // added to the latency of a node, per unit of failure rate, when ranking nodes
+		bool   hedge = false;           // send a duplicate request to another node when a request is slower than p95
+		int    minHedgeMs = 5;          // never hedge sooner than this
+		int    maxAttempts = 3;         // nodes to try before a call reports a node failure
+	};
+
+	NodePool() {}
+	NodePool(const Options& options) : m_options(options) {}
+	~NodePool()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_changed.wait(lock, [this] { return m_running == 0; }); // hedged requests still hold references to this pool
+	}
+	NodePool(const NodePool&) = delete;
+	NodePool& operator=(const NodePool&) = delete;
+
+	// client must have a longer lifetime than this pool. Returns the node's index.
+	int Add(HttpClient& client)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_nodes.emplace_back(new Node(client));
+		return (int)m_nodes.size() - 1;
+	}
+	int Size() const { return (int)m_nodes.size(); }
+	NodeStats Stats(int node) const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		const Node& n = *m_nodes[node];
+		NodeStats stats = n.stats;
+		stats.p95Ms = P95(n);
+		return stats;
+	}
+	// Returns the node that the next call would be routed to, or -1 if every node is busy
+	int Best() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return Pick(0);
+	}
+
+	// Calls request(rpc::PhantasmaAPI&, rpc::PhantasmaError&) on the best node, and returns its result.
+	// Nodes must not be added while calls are in progress.
+	template<class Request>
+	auto Call(Request request, rpc::PhantasmaError* out_error = nullptr) -> decltype(request(std::declval<rpc::PhantasmaAPI&>(), std::declval<rpc::PhantasmaError&>()))
+	{
+		typedef decltype(request(std::declval<rpc::PhantasmaAPI&>(), std::declval<rpc::PhantasmaError&>())) Output;
+		rpc::PhantasmaError err_dummy;
+		rpc::PhantasmaError& error = out_error ? *out_error : err_dummy;
+		Output output{};
+		if( m_nodes.empty() )
+		{
+			rpc::OnHttpError(error, PHANTASMA_LITERAL("NodePool has no nodes"));
+			return output;
+		}
+		std::vector<bool> tried(m_nodes.size(), false);
+		for( int attempt = 0; attempt < m_options.maxAttempts; ++attempt )
+		{
+			error = rpc::PhantasmaError{};
+			bool failed = m_options.hedge ? CallHedged(request, output, error, tried)
+			                              : CallDirect(request, output, error, tried);
+			if( !failed || std::find(tried.begin(), tried.end(), false) == tried.end() )
+				break;
+		}
+		return output;
+	}
+private:
+	typedef std::chrono::steady_clock Clock;
+	constexpr static int SampleCount = 64;
+
+	struct Node
+	{
+		Node(HttpClient& client) : api(client) {}
+		rpc::PhantasmaAPI api;
+		NodeStats stats;
+		Clock::time_point lastFailure;
+		float     samples[SampleCount] = {};
+		int       sampleCount = 0;
+	};
+	template<class Output>
+	struct HedgedCall // shared by the threads of one hedged call
+	{
+		std::mutex              mutex;
+		std::condition_variable done;
+		int                     pending = 0;
+		bool                    answered = false;
+		Output                  output{};
+		rpc::PhantasmaError     error;
+	};
+
+	Options m_options;
+	std::vector<std::unique_ptr<Node>> m_nodes;
+	mutable std::mutex      m_mutex;
+	std::condition_variable m_changed; // a node became free, or a hedged request finished
+	int                     m_running = 0;
+
+	// Returns the best free node that is not excluded, or -1
+	int Pick(const std::vector<bool>* exclude) const
+	{
+		int best = -1;
+		double bestScore = 0;
+		Clock::time_point now = Clock::now();
+		for( int i = 0, end = (int)m_nodes.size(); i != end; ++i )
+		{
+			const NodeStats& s = m_nodes[i]->stats;
+			if( s.busy || (exclude && (*exclude)[i]) )
+				continue;
+			double score = s.latencyMs + s.failureRate * m_options.failurePenaltyMs;
+			if( s.failureRate > m_options.unhealthyRate && now - m_nodes[i]->lastFailure < std::chrono::milliseconds(m_options.retryUnhealthyMs) )
+				score += 1e9; // only used if every healthy node is busy or excluded
+			if( best < 0 || score < bestScore )
+			{
+				best = i;
+				bestScore = score;
+			}
+		}
+		return best;
+	}
+	// Waits for a free node that has not been tried, and marks it busy. Returns -1 if every node has been tried.
+	int Acquire(std::vector<bool>& tried)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		for(;;)
+		{
+			if( std::find(tried.begin(), tried.end(), false) == tried.end() )
+				return -1;
+			int node = Pick(&tried);
+			if( node >= 0 )
+			{
+				tried[node] = true;
+				m_nodes[node]->stats.busy = true;
+				return node;
+			}
+			m_changed.wait(lock);
+		}
+	}
+	void Release(int node, Clock::time_point start, const rpc::PhantasmaError& error)
+	{
+		double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		bool failed = rpc::IsTransientError(error);
+		std::lock_guard<std::mutex> lock(m_mutex);
+		Node& n = *m_nodes[node];
+		NodeStats& s = n.stats;
+		double w = s.requests ? m_options.ewmaWeight : 1.0;
+		if( !failed ) // a failure's time (e.g. a refused connection) says nothing about the node's speed
+		{
+			s.latencyMs += w * (ms - s.latencyMs);
+			n.samples[n.sampleCount++ % SampleCount] = (float)ms;
+		}
+		s.failureRate += w * ((failed ? 1.0 : 0.0) - s.failureRate);
+		s.requests++;
+		s.failures += failed ? 1 : 0;
+		if( failed )
+			n.lastFailure = Clock::now();
+		s.busy = false;
+		m_changed.notify_all();
+	}
+	static double P95(const Node& n)
+	{
+		int count = PHANTASMA_MIN(n.sampleCount, SampleCount);
+		if( count < 8 )
+			return 0;
+		float sorted[SampleCount];
+		PHANTASMA_COPY(n.samples, n.samples + count, sorted);
+		int index = (count * 95) / 100;
+		std::nth_element(sorted, sorted + index, sorted + count);
+		return sorted[index];
+	}
+
+	// Returns true if the call failed because of the node
+	template<class Request, class Output>
+	bool CallDirect(Request& request, Output& output, rpc::PhantasmaError& error, std::vector<bool>& tried)
+	{
+		int node = Acquire(tried);
+		if( node < 0 )
+			return true;
+		Clock::time_point start = Clock::now();
+		output = request(m_nodes[node]->api, error);
+		Release(node, start, error);
+		return rpc::IsTransientError(error);
+	}
+
+	template<class Request, class Output>
+	bool CallHedged(Request& request, Output& output, rpc::PhantasmaError& error, std::vector<bool>& tried)
+	{
+		int primary = Acquire(tried);
+		if( primary < 0 )
+			return true;
+		double hedgeMs;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			hedgeMs = P95(*m_nodes[primary]);
+		}
+		std::shared_ptr<HedgedCall<Output>> call = std::make_shared<HedgedCall<Output>>();
+		Start(call, request, primary);
+
+		std::unique_lock<std::mutex> lock(call->mutex);
+		if( hedgeMs > 0 && !call->done.wait_for(lock, std::chrono::duration<double, std::milli>(PHANTASMA_MAX(hedgeMs, (double)m_options.minHedgeMs)), [&] { return call->answered || call->pending == 0; }) )
+		{
+			lock.unlock();
+			int backup = TryAcquire(tried);
+			if( backup >= 0 )
+			{
+				{
+					std::lock_guard<std::mutex> statsLock(m_mutex);
+					m_nodes[backup]->stats.hedges++;
+				}
+				Start(call, request, backup);
+			}
+			lock.lock();
+		}
+		call->done.wait(lock, [&] { return call->answered || call->pending == 0; });
+		output = std::move(call->output);
+		error = call->error;
+		return !call->answered;
+	}
+	// As Acquire, but returns -1 instead of waiting if no untried node is free
+	int TryAcquire(std::vector<bool>& tried)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		int node = Pick(&tried);
+		if( node >= 0 )
+		{
+			tried[node] = true;
+			m_nodes[node]->stats.busy = true;
+		}
+		return node;
+	}
+	template<class Request, class Output>
+	void Start(const std::shared_ptr<HedgedCall<Output>>& call, Request& request, int node)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			++m_running;
+		}
+		{
+			std::lock_guard<std::mutex> lock(call->mutex);
+			++call->pending;
+		}
+		std::thread([this, call, request, node]() mutable
+		{
+			Clock::time_point start = Clock::now();
+			rpc::PhantasmaError error;
+			Output output = request(m_nodes[node]->api, error);
+			{
+				std::lock_guard<std::mutex> lock(call->mutex);
+				--call->pending;
+				if( !call->answered && (!rpc::IsTransientError(error) || call->pending == 0) )
+				{
+					call->answered = !rpc::IsTransientError(error);
+					call->output = std::move(output);
+					call->error = error;
+				}
+				call->done.notify_all();
+			}
+			Release(node, start, error);
+			std::lock_guard<std::mutex> lock(m_mutex);
+			--m_running;
+			m_changed.notify_all();
+		}).detach();
+	}
+};
+
+}
@@ -0,0 +1,274 @@
+#pragma once
+#ifndef PHANTASMA_API_INCLUDED
+#error "Configure and include PhantasmaAPI.h first"
+#endif
+#ifndef PHANTASMA_HTTPCLIENT
+#error "PaginatedFetcher requires an HTTP client. Define PHANTASMA_HTTPCLIENT or include an HTTP adaptor"
+#endif
+#if defined(PHANTASMA_RPC_STRINGVIEW)
+#error "PaginatedFetcher.h requires rpc strings that own their text. Do not define PHANTASMA_RPC_STRINGVIEW"
+#endif
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// Fetching every page of a paginated call
+//------------------------------------------------------------------------------
+// GetAddressTransactions and GetAuctions return their results a page at a
+//  time. Rather than requesting the pages one after another,
+//  PaginatedFetcher reads the number of pages from the first response, then
+//  fetches the remaining pages concurrently, one worker thread per HttpClient.
+//  The items are still delivered in order:
+//
+//     CurlClient clients[4];
+//     AddressTransactionsFetcher fetcher(clients, 4, address);
+//     rpc::Transaction tx;
+//     while( fetcher.Next(tx, &err) )
+//         Index(tx);
+//
+// At most Options::window pages are fetched ahead of the consumer. Requests
+//  that fail because of the connection or an invalid response are retried up
+//  to Options::maxRetries times; any other error ends the fetch, and is
+//  reported by Next once the items before it have been delivered.
+//
+// The pages are read while the node may be adding to the results, so an item
+//  can move to the next page between two requests, and be delivered twice.
+//------------------------------------------------------------------------------
+
+namespace phantasma {
+
+// The position of a page within the results of a paginated call
+struct PageInfo
+{
+	UInt32 page = 0;
+	UInt32 pageSize = 0;
+	UInt32 total = 0;
+	UInt32 totalPages = 0;
+};
+
+// Reads the page information from the response of a paginated call
+inline bool ParsePageInfo(const JSONValue& response, PageInfo& output, rpc::PhantasmaError* out_error = nullptr)
+{
+	rpc::PhantasmaError err_dummy;
+	rpc::PhantasmaError& error = out_error ? *out_error : err_dummy;
+	JSONValue result = rpc::PhantasmaJsonAPI::CheckResponse(response, error);
+	if( error.code )
+		return false;
+	bool jsonErr = false;
+	output.page = json::LookupUInt32(result, PHANTASMA_LITERAL("page"), jsonErr);
+	output.pageSize = json::LookupUInt32(result, PHANTASMA_LITERAL("pageSize"), jsonErr);
+	output.total = json::LookupUInt32(result, PHANTASMA_LITERAL("total"), jsonErr);
+	output.totalPages = json::LookupUInt32(result, PHANTASMA_LITERAL("totalPages"), jsonErr);
+	if( jsonErr )
+		error.code = rpc::PhantasmaError::InvalidJSON;
+	return error.code == 0;
+}
+
+template<class Output, class Item, class Items = RpcVector<Item>>
+class PaginatedFetcher
+{
+public:
+	struct Options
+	{
+		int    window = 16;     // pages that may be fetched ahead of the consumer
+		UInt32 pageSize = 50;   // items per page. Nodes return at most 50 (PaginationMaxResults).
+		int    maxRetries = 2;
+	};
+	typedef std::function<void(JSONBuilder&, UInt32 page, UInt32 pageSize)> MakeRequest;
+	typedef bool(*ParseResponse)(const JSONValue&, Output&, rpc::PhantasmaError*, const rpc::RpcProjection*);
+	typedef std::function<Items&(Output&)> GetItems;
+
+	// Starts fetching from the first page, with one worker thread per client. The clients must have a longer lifetime than this fetcher.
+	PaginatedFetcher(HttpClient* clients, int numClients, MakeRequest make, ParseResponse parse, GetItems items, const Options& options = Options{})
+		: m_options(options)
+		, m_make(std::move(make))
+		, m_parse(parse)
+		, m_items(std::move(items))
+	{
+		m_options.window = PHANTASMA_MAX(m_options.window, 1);
+		m_slots.resize(m_options.window);
+		for( int i = 0; i < numClients; ++i )
+			m_workers.emplace_back(&PaginatedFetcher::Work, this, &clients[i]);
+	}
+	~PaginatedFetcher()
+	{
+		Stop();
+	}
+	PaginatedFetcher(const PaginatedFetcher&) = delete;
+	PaginatedFetcher& operator=(const PaginatedFetcher&) = delete;
+
+	// Cancels the fetch, and waits for the requests in flight to complete
+	void Stop()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stopped = true;
+			m_changed.notify_all();
+		}
+		for( std::thread& worker : m_workers )
+			worker.join();
+		m_workers.clear();
+	}
+
+	// Waits for the next item. Returns false once every item has been delivered, or if a page could not be fetched
+	//  (in which case out_error is set).
+	bool Next(Item& output, rpc::PhantasmaError* out_error = nullptr)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		for(;;)
+		{
+			if( m_nextDeliver > m_lastPage )
+				return false;
+			Slot& slot = m_slots[m_nextDeliver % m_slots.size()];
+			m_changed.wait(lock, [&] { return slot.ready || m_stopped; });
+			if( !slot.ready )
+				return false;
+			if( slot.error.code )
+			{
+				if( out_error )
+					*out_error = slot.error;
+				m_lastPage = 0; // nothing more will be delivered
+				return false;
+			}
+			Items& items = m_items(slot.output);
+			if( m_nextItem < items.size() )
+			{
+				output = std::move(items[m_nextItem++]);
+				return true;
+			}
+			slot = Slot{};
+			m_nextItem = 0;
+			++m_nextDeliver;
+			m_changed.notify_all();
+		}
+	}
+	// Calls onItem for each item in order, until it returns false. Returns false if a page could not be fetched.
+	bool Run(const std::function<bool(Item&)>& onItem, rpc::PhantasmaError* out_error = nullptr)
+	{
+		rpc::PhantasmaError err_dummy;
+		rpc::PhantasmaError& error = out_error ? *out_error : err_dummy;
+		error = rpc::PhantasmaError{};
+		Item item;
+		while( Next(item, &error) )
+			if( !onItem(item) )
+				break;
+		return error.code == 0;
+	}
+
+	// The page information of the first response, once it has arrived
+	PageInfo FirstPage() const
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_changed.wait(lock, [&] { return m_lastPage != Unknown || m_stopped; });
+		return m_firstPage;
+	}
+private:
+	constexpr static UInt32 Unknown = ~UInt32(0);
+	struct Slot
+	{
+		bool                ready = false;
+		Output              output;
+		rpc::PhantasmaError error;
+	};
+
+	Options       m_options;
+	MakeRequest   m_make;
+	ParseResponse m_parse;
+	GetItems      m_items;
+	std::vector<std::thread>        m_workers;
+	std::vector<Slot>               m_slots;   // ring buffer of the window, indexed by page
+	mutable std::mutex              m_mutex;
+	mutable std::condition_variable m_changed;
+	PageInfo m_firstPage;
+	UInt32   m_nextFetch = 1;
+	UInt32   m_nextDeliver = 1;
+	UInt32   m_lastPage = Unknown; // until the first page has arrived
+	size_t   m_nextItem = 0;       // within the page m_nextDeliver
+	bool     m_stopped = false;
+	bool     m_failed = false;
+
+	void Work(HttpClient* client)
+	{
+		for(;;)
+		{
+			UInt32 page;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				// Only the first page is requested until it tells how many pages there are
+				m_changed.wait(lock, [&] { return m_stopped || m_failed || m_nextFetch > m_lastPage ||
+				                                  ((m_nextFetch == 1 || m_lastPage != Unknown) && m_nextFetch < m_nextDeliver + m_slots.size()); });
+				if( m_stopped || m_failed || m_nextFetch > m_lastPage )
+					return;
+				page = m_nextFetch++;
+			}
+			Output output;
+			PageInfo info;
+			rpc::PhantasmaError error;
+			for( int attempt = 0; ; ++attempt )
+			{
+				output = Output{};
+				error = rpc::PhantasmaError{};
+				Fetch(*client, page, output, info, error);
+				if( !rpc::IsTransientError(error) || attempt >= m_options.maxRetries )
+					break;
+			}
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if( page == 1 )
+			{
+				m_firstPage = info;
+				m_lastPage = error.code ? 1 : PHANTASMA_MAX(info.totalPages, 1u);
+			}
+			Slot& slot = m_slots[page % m_slots.size()];
+			slot.output = std::move(output);
+			slot.error = error;
+			slot.ready = true;
+			m_failed = m_failed || error.code != 0;
+			m_changed.notify_all();
+		}
+	}
+	void Fetch(HttpClient& client, UInt32 page, Output& output, PageInfo& info, rpc::PhantasmaError& error)
+	{
+		JSONBuilder request;
+		m_make(request, page, m_options.pageSize);
+		const JSONDocument& response = HttpPost(client, rpc::PhantasmaJsonAPI::Uri(), request, &error);
+		if( error.code )
+			return;
+		JSONValue json = json::Parse(response);
+		if( m_parse(json, output, &error, nullptr) && page == 1 )
+			ParsePageInfo(json, info, &error);
+	}
+};
+
+// Every transaction of an address, most recent first
+class AddressTransactionsFetcher : public PaginatedFetcher<rpc::AccountTransactions, rpc::Transaction>
+{
+public:
+	AddressTransactionsFetcher(HttpClient* clients, int numClients, const Char* account, const Options& options = Options{})
+		: PaginatedFetcher(clients, numClients,
+			[account = String(account)](JSONBuilder& request, UInt32 page, UInt32 pageSize)
+			{ rpc::PhantasmaJsonAPI::MakeGetAddressTransactionsRequest(request, account.c_str(), page, pageSize); },
+			&rpc::PhantasmaJsonAPI::ParseGetAddressTransactionsResponse,
+			[](rpc::AccountTransactions& output) -> RpcVector<rpc::Transaction>& { return output.txs; },
+			options)
+	{}
+};
+
+// Every auction of a chain's market, optionally only of one token
+class AuctionsFetcher : public PaginatedFetcher<PHANTASMA_VECTOR<rpc::Auction>, rpc::Auction, PHANTASMA_VECTOR<rpc::Auction>>
+{
+public:
+	AuctionsFetcher(HttpClient* clients, int numClients, const Char* chainAddressOrName, const Char* symbol, const Options& options = Options{})
+		: PaginatedFetcher(clients, numClients,
+			[chain = String(chainAddressOrName), symbol = String(symbol ? symbol : PHANTASMA_LITERAL(""))](JSONBuilder& request, UInt32 page, UInt32 pageSize)
+			{ rpc::PhantasmaJsonAPI::MakeGetAuctionsRequest(request, chain.c_str(), symbol.c_str(), page, pageSize); },
+			&rpc::PhantasmaJsonAPI::ParseGetAuctionsResponse,
+			[](PHANTASMA_VECTOR<rpc::Auction>& output) -> PHANTASMA_VECTOR<rpc::Auction>& { return output; },
+			options)
+	{}
+};
+
+}
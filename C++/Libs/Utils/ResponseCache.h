@@ -0,0 +1,281 @@
+#pragma once
+#ifndef PHANTASMA_API_INCLUDED
+#error "Configure and include PhantasmaAPI.h first"
+#endif
+#ifndef PHANTASMA_HTTPCLIENT
+#error "CachedPhantasmaAPI requires an HTTP client. Define PHANTASMA_HTTPCLIENT or include an HTTP adaptor"
+#endif
+#if defined(PHANTASMA_RPC_STRINGVIEW)
+#error "ResponseCache.h requires rpc strings that own their text. Do not define PHANTASMA_RPC_STRINGVIEW"
+#endif
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+//------------------------------------------------------------------------------
+// Caching RPC responses
+//------------------------------------------------------------------------------
+// Chains, tokens, the nexus and contracts change rarely, and blocks never
+//  change once they have been produced. CachedPhantasmaAPI sits in front of a
+//  PhantasmaAPI and keeps the parsed results of these calls in a
+//  ResponseCache, so repeated calls cost neither a request nor a parse:
+//
+//     PhantasmaAPI api(client);
+//     CachedPhantasmaAPI cached(api);
+//     auto chains = cached.GetChains(&err); // fetched
+//     auto tokens = cached.GetTokens(false, &err);
+//     chains = cached.GetChains(&err);      // from the cache
+//
+// Each kind of call has a time-to-live in CachedPhantasmaAPI::Options.
+//  Blocks (by hash or by height) are cached permanently. Other calls can be
+//  cached with Call, which takes a key, a time-to-live and the request.
+//
+// The cache holds at most Options::maxEntries results, evicting the least
+//  recently used. Errors are never cached. Results are returned by value, so
+//  they remain valid after they are evicted.
+//
+// Neither class is thread-safe. Use one per thread, or guard each with a lock.
+//------------------------------------------------------------------------------
+
+namespace phantasma {
+
+struct ResponseCacheStats
+{
+	UInt64 hits = 0;
+	UInt64 misses = 0;
+	UInt64 expirations = 0;    // lookups that found an entry whose time-to-live had passed
+	UInt64 evictions = 0;      // entries removed to stay within the size limit
+	size_t entries = 0;
+};
+
+class ResponseCache // Least-recently-used store of parsed responses, with per-entry expiry
+{
+public:
+	constexpr static int Permanent = -1; // time-to-live of entries that never expire
+
+	ResponseCache(size_t maxEntries = 1024) : m_maxEntries(maxEntries ? maxEntries : 1) {}
+
+	// Returns the value stored under key, or null if there is none, it has expired, or it was stored with another type
+	template<class T>
+	const T* Find(const String& key)
+	{
+		Index::iterator found = m_index.find(key);
+		if( found == m_index.end() || found->second->type != TypeTag<T>() )
+		{
+			m_stats.misses++;
+			return nullptr;
+		}
+		Entries::iterator entry = found->second;
+		if( entry->expires != Clock::time_point::max() && Clock::now() >= entry->expires )
+		{
+			m_stats.expirations++;
+			m_stats.misses++;
+			m_index.erase(found);
+			m_entries.erase(entry);
+			return nullptr;
+		}
+		m_stats.hits++;
+		m_entries.splice(m_entries.begin(), m_entries, entry); // most recently used first
+		return &static_cast<const Value<T>&>(*entry->value).value;
+	}
+	// Stores a value under key, for ttlMs milliseconds or permanently
+	template<class T>
+	void Insert(const String& key, const T& value, int ttlMs)
+	{
+		if( ttlMs == 0 )
+			return;
+		Clock::time_point expires = ttlMs < 0 ? Clock::time_point::max() : Clock::now() + std::chrono::milliseconds(ttlMs);
+		Index::iterator found = m_index.find(key);
+		if( found != m_index.end() )
+		{
+			m_entries.erase(found->second);
+			m_index.erase(found);
+		}
+		m_entries.push_front(Entry{ key, expires, TypeTag<T>(), std::unique_ptr<ValueBase>(new Value<T>(value)) });
+		m_index[key] = m_entries.begin();
+		while( m_entries.size() > m_maxEntries )
+		{
+			m_index.erase(m_entries.back().key);
+			m_entries.pop_back();
+			m_stats.evictions++;
+		}
+	}
+	void Erase(const String& key)
+	{
+		Index::iterator found = m_index.find(key);
+		if( found == m_index.end() )
+			return;
+		m_entries.erase(found->second);
+		m_index.erase(found);
+	}
+	void Clear()
+	{
+		m_index.clear();
+		m_entries.clear();
+	}
+	size_t Size() const { return m_entries.size(); }
+	ResponseCacheStats Stats() const
+	{
+		ResponseCacheStats stats = m_stats;
+		stats.entries = m_entries.size();
+		return stats;
+	}
+	void ResetStats() { m_stats = ResponseCacheStats{}; }
+private:
+	typedef std::chrono::steady_clock Clock;
+	struct ValueBase
+	{
+		virtual ~ValueBase() {}
+	};
+	template<class T>
+	struct Value : ValueBase
+	{
+		Value(const T& value) : value(value) {}
+		T value;
+	};
+	// A distinct address for each stored type, so that Find can check the type without RTTI
+	template<class T>
+	static const void* TypeTag()
+	{
+		static const char tag = 0;
+		return &tag;
+	}
+	struct Entry
+	{
+		String                     key;
+		Clock::time_point          expires;
+		const void*                type;
+		std::unique_ptr<ValueBase> value;
+	};
+	typedef std::list<Entry> Entries;
+	typedef std::unordered_map<String, Entries::iterator> Index;
+
+	size_t             m_maxEntries;
+	Entries            m_entries;
+	Index              m_index;
+	ResponseCacheStats m_stats;
+};
+
+class CachedPhantasmaAPI
+{
+public:
+	struct Options
+	{
+		size_t maxEntries  = 1024;
+		int    chainsTtlMs    = 10 * 60 * 1000; // GetChains, GetPlatforms
+		int    tokensTtlMs    = 10 * 60 * 1000; // GetTokens, GetToken
+		int    nexusTtlMs     = 10 * 60 * 1000; // GetNexus, GetValidators
+		int    contractsTtlMs = 10 * 60 * 1000; // GetContract
+		int    blocksTtlMs    = ResponseCache::Permanent; // GetBlockByHash, GetBlockByHeight, GetTransactionByBlockHashAndIndex
+	};
+
+	CachedPhantasmaAPI(rpc::PhantasmaAPI& api) // api must have a longer lifetime than this object
+		: m_api(api), m_cache(m_options.maxEntries) {}
+	CachedPhantasmaAPI(rpc::PhantasmaAPI& api, const Options& options)
+		: m_api(api), m_options(options), m_cache(options.maxEntries) {}
+
+	rpc::PhantasmaAPI&  Api()   { return m_api; }   // for calls that are not cached
+	ResponseCache&      Cache() { return m_cache; }
+	ResponseCacheStats  Stats() const { return m_cache.Stats(); }
+
+	PHANTASMA_VECTOR<rpc::Chain> GetChains(rpc::PhantasmaError* out_error = nullptr)
+	{
+		return Call(Key(PHANTASMA_LITERAL("getChains")), m_options.chainsTtlMs,
+			[&](rpc::PhantasmaError* e) { return m_api.GetChains(e); }, out_error);
+	}
+	PHANTASMA_VECTOR<rpc::Platform> GetPlatforms(rpc::PhantasmaError* out_error = nullptr)
+	{
+		return Call(Key(PHANTASMA_LITERAL("getPlatforms")), m_options.chainsTtlMs,
+			[&](rpc::PhantasmaError* e) { return m_api.GetPlatforms(e); }, out_error);
+	}
+	PHANTASMA_VECTOR<rpc::Token> GetTokens(bool extended, rpc::PhantasmaError* out_error = nullptr)
+	{
+		return Call(Key(PHANTASMA_LITERAL("getTokens"), extended), m_options.tokensTtlMs,
+			[&](rpc::PhantasmaError* e) { return m_api.GetTokens(extended, e); }, out_error);
+	}
+	rpc::Token GetToken(const Char* symbol, bool extended, rpc::PhantasmaError* out_error = nullptr)
+	{
+		return Call(Key(PHANTASMA_LITERAL("getToken"), symbol, extended), m_options.tokensTtlMs,
+			[&](rpc::PhantasmaError* e) { return m_api.GetToken(symbol, extended, e); }, out_error);
+	}
+	rpc::Nexus GetNexus(bool extended, rpc::PhantasmaError* out_error = nullptr)
+	{
+		return Call(Key(PHANTASMA_LITERAL("getNexus"), extended), m_options.nexusTtlMs,
+			[&](rpc::PhantasmaError* e) { return m_api.GetNexus(extended, e); }, out_error);
+	}
+	PHANTASMA_VECTOR<rpc::Validator> GetValidators(rpc::PhantasmaError* out_error = nullptr)
+	{
+		return Call(Key(PHANTASMA_LITERAL("getValidators")), m_options.nexusTtlMs,
+			[&](rpc::PhantasmaError* e) { return m_api.GetValidators(e); }, out_error);
+	}
+	rpc::Contract GetContract(const Char* chainAddressOrName, const Char* contractName, rpc::PhantasmaError* out_error = nullptr)
+	{
+		return Call(Key(PHANTASMA_LITERAL("getContract"), chainAddressOrName, contractName), m_options.contractsTtlMs,
+			[&](rpc::PhantasmaError* e) { return m_api.GetContract(chainAddressOrName, contractName, e); }, out_error);
+	}
+	// A block can only be returned once it has been produced, and Phantasma's consensus is final, so blocks never change
+	rpc::Block GetBlockByHash(const Char* blockHash, rpc::PhantasmaError* out_error = nullptr)
+	{
+		return Call(Key(PHANTASMA_LITERAL("getBlockByHash"), blockHash), m_options.blocksTtlMs,
+			[&](rpc::PhantasmaError* e) { return m_api.GetBlockByHash(blockHash, e); }, out_error);
+	}
+	rpc::Block GetBlockByHeight(const Char* chainInput, UInt32 height, rpc::PhantasmaError* out_error = nullptr)
+	{
+		return Call(Key(PHANTASMA_LITERAL("getBlockByHeight"), chainInput, height), m_options.blocksTtlMs,
+			[&](rpc::PhantasmaError* e) { return m_api.GetBlockByHeight(chainInput, height, e); }, out_error);
+	}
+	rpc::Transaction GetTransactionByBlockHashAndIndex(const Char* blockHash, Int32 index, rpc::PhantasmaError* out_error = nullptr)
+	{
+		return Call(Key(PHANTASMA_LITERAL("getTransactionByBlockHashAndIndex"), blockHash, index), m_options.blocksTtlMs,
+			[&](rpc::PhantasmaError* e) { return m_api.GetTransactionByBlockHashAndIndex(blockHash, index, e); }, out_error);
+	}
+
+	// Returns the result cached under key, or calls fetch(rpc::PhantasmaError*) and caches its result for ttlMs
+	//  milliseconds (or permanently if ttlMs is ResponseCache::Permanent) if it succeeds
+	template<class Fetch>
+	auto Call(const String& key, int ttlMs, Fetch fetch, rpc::PhantasmaError* out_error = nullptr) -> decltype(fetch(out_error))
+	{
+		typedef decltype(fetch(out_error)) Output;
+		if( const Output* cached = m_cache.Find<Output>(key) )
+		{
+			if( out_error )
+				*out_error = rpc::PhantasmaError{};
+			return *cached;
+		}
+		rpc::PhantasmaError err_dummy;
+		rpc::PhantasmaError& error = out_error ? *out_error : err_dummy;
+		Output output = fetch(&error);
+		if( error.code == 0 )
+			m_cache.Insert(key, output, ttlMs);
+		return output;
+	}
+
+	// Builds a cache key from a method name and its arguments
+	template<class... Args>
+	static String Key(const Char* method, Args... args)
+	{
+		StringBuilder key;
+		key << method;
+		AppendKey(key, args...);
+		return key.str();
+	}
+private:
+	rpc::PhantasmaAPI& m_api;
+	Options            m_options;
+	ResponseCache      m_cache;
+
+	static void AppendKey(StringBuilder&) {}
+	static void AppendKey(StringBuilder& key, const Char* arg) { key << PHANTASMA_LITERAL('\n') << (arg ? arg : PHANTASMA_LITERAL("")); }
+	template<class T>
+	static void AppendKey(StringBuilder& key, T arg) { key << PHANTASMA_LITERAL('\n') << arg; }
+	template<class T, class... Args>
+	static void AppendKey(StringBuilder& key, T arg, Args... args)
+	{
+		AppendKey(key, arg);
+		AppendKey(key, args...);
+	}
+};
+
+}
@@ -0,0 +1,407 @@
+#pragma once
+#ifndef PHANTASMA_API_INCLUDED
+#error "Configure and include PhantasmaAPI.h first"
+#endif
+
+#include <functional>
+
+//------------------------------------------------------------------------------
+// Streaming RPC responses
+//------------------------------------------------------------------------------
+// Block and address-transaction responses can be very large. RpcStreamParser
+//  scans a response while it is still arriving, and as soon as each
+//  transaction (or block event) is complete, it is deserialized and passed to
+//  your callbacks. Only the current element is buffered, along with a small
+//  "skeleton" of the response in which the streamed arrays are left empty.
+//  Finish parses the skeleton to produce the block header / page and to report
+//  RPC errors.
+//
+//     RpcStreamCallbacks callbacks;
+//     callbacks.onTransaction = [](const Transaction& tx) { ... };
+//     callbacks.onEvent = [](const Event& e, const Transaction* owner) { ... };
+//     RpcStreamParser parser(StreamedResponse::Block, callbacks);
+//     while( ... ) parser.Feed(bytes, length);
+//     parser.Finish(blockHeader, &error);
+//
+// If the HTTP client implements HttpPostStream (the libcurl adaptor does), the
+//  StreamGetBlockByHeight / StreamGetBlockByHash / StreamGetAddressTransactions
+//  functions feed the parser directly from the client's write callback. Like
+//  the parser, they take an optional RpcProjection.
+//
+// Each element is loaded into a JSONDocument with json::LoadDocument. This is
+//  implemented below for the built-in, RapidJSON, Tape JSON and C++ REST
+//  parsers. If you have supplied your own JSON types, you must implement:
+//
+//     namespace phantasma { namespace json {
+//        const JSONDocument& LoadDocument(JSONDocument&, const String& text);
+//     }}
+//
+// If `PHANTASMA_RPC_STRINGVIEW` is defined, the structures that are passed to
+//  the callbacks are only valid until the callback returns. The header from
+//  Finish points into the skeleton, which the parser owns until it is Reset,
+//  or until Keep moves it into a ResponseArena. The Stream* functions take a
+//  `ResponseArena&` after the client, as the PhantasmaAPI methods do, and keep
+//  the skeleton there.
+//------------------------------------------------------------------------------
+
+namespace phantasma {
+namespace json {
+#if defined(PHANTASMA_RAPIDJSON)
+inline const JSONDocument& LoadDocument(JSONDocument& doc, const String& text) { doc.Parse<0>(text.c_str()); return doc; }
+#elif defined(PHANTASMA_TAPEJSON)
+inline const JSONDocument& LoadDocument(JSONDocument& doc, const String& text) { doc.Reset(text.data(), text.size()); return doc; }
+#elif defined(PHANTASMA_CPPREST)
+inline const JSONDocument& LoadDocument(JSONDocument& doc, const String& text) { doc = web::json::value::parse(text); return doc; }
+#elif !defined(PHANTASMA_JSONDOCUMENT)
+inline const JSONDocument& LoadDocument(JSONDocument& doc, const String& text) { doc = text; return doc; }
+#endif
+}
+
+namespace rpc {
+
+enum class StreamedResponse
+{
+	Block,               // GetBlockByHeight / GetBlockByHash: streams result.txs and result.events
+	AddressTransactions, // GetAddressTransactions: streams result.result.txs
+};
+
+struct RpcStreamCallbacks
+{
+	std::function<void(const Transaction&)>                     onTransaction;
+	std::function<void(const Event&, const Transaction* owner)> onEvent; // owner is null for block events
+};
+
+class RpcStreamParser
+{
+	static_assert(sizeof(Char) == 1, "RpcStreamParser requires UTF-8 strings");
+public:
+	constexpr static int MaxDepth = 512;
+
+	// If a projection is supplied, it must outlive the parser
+	RpcStreamParser(StreamedResponse type, const RpcStreamCallbacks& callbacks, const RpcProjection* projection = nullptr)
+		: m_type(type)
+		, m_callbacks(callbacks)
+		, m_projection(projection)
+	{}
+
+	void Reset()
+	{
+		m_stack.clear();
+		m_skeleton.clear();
+		m_element.clear();
+		m_key.clear();
+		m_inString = m_escape = m_stringIsKey = m_inScalar = false;
+		m_error = m_done = false;
+		m_elementDepth = -1;
+		m_elementTarget = Target::None;
+	}
+
+	bool Failed() const { return m_error; }
+
+	// Returns false once the response is known to be invalid. Any further input is ignored.
+	bool Feed(const char* data, size_t size)
+	{
+		for( const char* end = data + size; data != end && !m_error; ++data )
+			Step(*data);
+		return !m_error;
+	}
+
+	// Call after the final byte has been fed. Deserializes the non-streamed parts of the response.
+	bool Finish(Block& out_header, PhantasmaError* out_error = nullptr)
+	{
+		if( !CheckFinished(out_error) )
+			return false;
+		return PhantasmaJsonAPI::ParseGetBlockByHeightResponse(json::Parse(json::LoadDocument(m_doc, m_skeleton)), out_header, out_error, m_projection);
+	}
+	bool Finish(AccountTransactions& out_header, PhantasmaError* out_error = nullptr)
+	{
+		if( !CheckFinished(out_error) )
+			return false;
+		return PhantasmaJsonAPI::ParseGetAddressTransactionsResponse(json::Parse(json::LoadDocument(m_doc, m_skeleton)), out_header, out_error, m_projection);
+	}
+
+#ifdef PHANTASMA_RPC_STRINGVIEW
+	// Moves the skeleton document, which the header of Finish points into, into the arena
+	void Keep(ResponseArena& arena) { arena.Keep(m_doc); }
+#endif
+
+	// Compatible with CURLOPT_WRITEFUNCTION, where userp is the RpcStreamParser
+	static size_t CurlWrite(char* contents, size_t size, size_t nmemb, void* userp)
+	{
+		RpcStreamParser* parser = (RpcStreamParser*)userp;
+		size_t realsize = size * nmemb;
+		bool ok = false;
+		PHANTASMA_TRY
+		{
+			ok = parser->Feed((const char*)contents, realsize);
+		}
+		PHANTASMA_CATCH_ALL()
+		{
+			parser->m_error = true;
+		}
+		return ok ? realsize : 0; // a short count makes CURL abort the transfer
+	}
+private:
+	enum class Target
+	{
+		None,
+		Transaction,
+		Event,
+	};
+	struct Frame
+	{
+		bool   array;
+		bool   expectKey; // objects only: the next string is a key
+		Target streamed;  // arrays only: the elements are delivered to the callbacks instead of the skeleton
+		String key;       // objects only: the key of the current member
+	};
+
+	StreamedResponse          m_type;
+	RpcStreamCallbacks        m_callbacks;
+	const RpcProjection*      m_projection;
+	PHANTASMA_VECTOR<Frame>   m_stack;
+	String                    m_skeleton;
+	String                    m_element;
+	String                    m_key;
+	JSONDocument              m_doc;
+	bool                      m_inString = false;
+	bool                      m_escape = false;
+	bool                      m_stringIsKey = false;
+	bool                      m_inScalar = false;
+	bool                      m_error = false;
+	bool                      m_done = false;
+	int                       m_elementDepth = -1; // stack depth at which the current element began, or -1
+	Target                    m_elementTarget = Target::None;
+
+	static bool IsSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+	static bool IsScalar(char c) { return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || c == '-' || c == '+' || c == '.' || c == 'E'; }
+
+	bool CheckFinished(PhantasmaError* out_error)
+	{
+		if( m_inScalar && !m_error )
+		{
+			m_inScalar = false;
+			EndValue();
+		}
+		if( m_done && !m_error )
+			return true;
+		PHANTASMA_EXCEPTION("Incomplete or invalid streamed response");
+		if( out_error && !out_error->code )
+		{
+			out_error->code = PhantasmaError::InvalidJSON;
+			out_error->message = PHANTASMA_LITERAL("Incomplete or invalid streamed response");
+		}
+		return false;
+	}
+
+	Target StreamedPath() const // Does an array that starts here hold elements to stream?
+	{
+		for( const Frame& f : m_stack )
+			if( f.array )
+				return Target::None;
+		size_t depth = m_stack.size();
+		auto at = [this](size_t i, const Char* key) { return m_stack[i].key == key; };
+		switch( m_type )
+		{
+		case StreamedResponse::Block:
+			if( depth == 2 && at(0, PHANTASMA_LITERAL("result")) && at(1, PHANTASMA_LITERAL("txs")) )    return Target::Transaction;
+			if( depth == 2 && at(0, PHANTASMA_LITERAL("result")) && at(1, PHANTASMA_LITERAL("events")) ) return Target::Event;
+			break;
+		case StreamedResponse::AddressTransactions:
+			if( depth == 3 && at(0, PHANTASMA_LITERAL("result")) && at(1, PHANTASMA_LITERAL("result")) && at(2, PHANTASMA_LITERAL("txs")) ) return Target::Transaction;
+			break;
+		}
+		return Target::None;
+	}
+
+	void Emit(char c)
+	{
+		if( m_elementDepth >= 0 )
+			m_element.push_back(c);
+		else if( m_stack.empty() || m_stack.back().streamed == Target::None )
+			m_skeleton.push_back(c); // separators within streamed arrays are dropped along with the elements
+	}
+
+	void BeginValue()
+	{
+		if( m_done ) { m_error = true; return; }
+		if( !m_stack.empty() && !m_stack.back().array && m_stack.back().expectKey ) { m_error = true; return; }
+		if( m_elementDepth < 0 && !m_stack.empty() && m_stack.back().streamed != Target::None )
+		{
+			m_elementDepth = (int)m_stack.size();
+			m_elementTarget = m_stack.back().streamed;
+			m_element.clear();
+		}
+	}
+
+	void EndValue()
+	{
+		if( m_elementDepth >= 0 && (int)m_stack.size() == m_elementDepth )
+		{
+			Deliver();
+			m_elementDepth = -1;
+		}
+		if( m_stack.empty() )
+			m_done = true;
+	}
+
+	void Deliver()
+	{
+		bool jsonErr = false;
+		const JSONDocument& doc = json::LoadDocument(m_doc, m_element);
+		if( m_elementTarget == Target::Transaction )
+		{
+			Transaction tx = PhantasmaJsonAPI::DeserializeTransaction(json::Parse(doc), jsonErr, m_projection);
+			if( jsonErr ) { m_error = true; return; }
+			if( m_callbacks.onTransaction )
+				m_callbacks.onTransaction(tx);
+			if( m_callbacks.onEvent )
+				for( const Event& e : tx.events )
+					m_callbacks.onEvent(e, &tx);
+		}
+		else
+		{
+			Event e = PhantasmaJsonAPI::DeserializeEvent(json::Parse(doc), jsonErr, m_projection);
+			if( jsonErr ) { m_error = true; return; }
+			if( m_callbacks.onEvent )
+				m_callbacks.onEvent(e, nullptr);
+		}
+	}
+
+	void Step(char c)
+	{
+		if( m_inString )
+		{
+			Emit(c);
+			if( m_escape )
+				m_escape = false;
+			else if( c == '\\' )
+				m_escape = true;
+			else if( c == '"' )
+			{
+				m_inString = false;
+				if( m_stringIsKey )
+					m_stack.back().key = m_key;
+				else
+					EndValue();
+				return;
+			}
+			if( m_stringIsKey )
+				m_key.push_back(c);
+			return;
+		}
+		if( m_inScalar )
+		{
+			if( IsScalar(c) ) { Emit(c); return; }
+			m_inScalar = false;
+			EndValue();
+			if( m_error )
+				return;
+		}
+		if( IsSpace(c) )
+			return;
+		switch( c )
+		{
+		case '{':
+		case '[':
+			BeginValue();
+			if( m_error || m_stack.size() >= MaxDepth ) { m_error = true; return; }
+			Emit(c);
+			m_stack.push_back(Frame{ c == '[', c == '{', c == '[' ? StreamedPath() : Target::None, String() });
+			return;
+		case '}':
+		case ']':
+			if( m_stack.empty() || m_stack.back().array != (c == ']') ) { m_error = true; return; }
+			m_stack.pop_back();
+			Emit(c);
+			EndValue();
+			return;
+		case ':':
+			if( m_stack.empty() || m_stack.back().array ) { m_error = true; return; }
+			Emit(c);
+			return;
+		case ',':
+			if( m_stack.empty() ) { m_error = true; return; }
+			if( !m_stack.back().array )
+				m_stack.back().expectKey = true;
+			Emit(c);
+			return;
+		case '"':
+			m_stringIsKey = !m_stack.empty() && !m_stack.back().array && m_stack.back().expectKey;
+			if( m_stringIsKey )
+			{
+				m_stack.back().expectKey = false;
+				m_key.clear();
+			}
+			else
+			{
+				BeginValue();
+				if( m_error )
+					return;
+			}
+			Emit(c);
+			m_inString = true;
+			return;
+		default:
+			if( !IsScalar(c) ) { m_error = true; return; }
+			BeginValue();
+			if( m_error )
+				return;
+			Emit(c);
+			m_inScalar = true;
+			return;
+		}
+	}
+};
+
+#if defined(PHANTASMA_HTTPCLIENT)
+//------------------------------------------------------------------------------
+// Streaming versions of PhantasmaAPI methods, for HTTP clients that implement:
+//   void HttpPostStream(HttpClient&, const Char* uri, const JSONBuilder&,
+//                       size_t(*write)(char*, size_t, size_t, void*), void* userp, PhantasmaError* out_error);
+//------------------------------------------------------------------------------
+template<class Client, class Header>
+bool StreamRequest(Client& client, PHANTASMA_ARENA_PARAM const JSONBuilder& request, StreamedResponse type, const RpcStreamCallbacks& callbacks, Header& out_header, PhantasmaError* out_error, const RpcProjection* projection = nullptr)
+{
+	RpcStreamParser parser(type, callbacks, projection);
+	PhantasmaError httpError;
+	HttpPostStream(client, PhantasmaJsonAPI::Uri(), request, &RpcStreamParser::CurlWrite, &parser, &httpError);
+	if( httpError.code && !parser.Failed() ) // the transfer failed, rather than being aborted by the parser
+	{
+		if( out_error )
+			*out_error = httpError;
+		return false;
+	}
+	bool ok = parser.Finish(out_header, out_error);
+#ifdef PHANTASMA_RPC_STRINGVIEW
+	parser.Keep(arena);
+#endif
+	return ok;
+}
+
+template<class Client>
+bool StreamGetBlockByHeight(Client& client, PHANTASMA_ARENA_PARAM const Char* chainInput, UInt32 height, const RpcStreamCallbacks& callbacks, Block& out_header, PhantasmaError* out_error = nullptr, const RpcProjection* projection = nullptr)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetBlockByHeightRequest(request, chainInput, height);
+	return StreamRequest(client, PHANTASMA_ARENA_ARG request, StreamedResponse::Block, callbacks, out_header, out_error, projection);
+}
+
+template<class Client>
+bool StreamGetBlockByHash(Client& client, PHANTASMA_ARENA_PARAM const Char* blockHash, const RpcStreamCallbacks& callbacks, Block& out_header, PhantasmaError* out_error = nullptr, const RpcProjection* projection = nullptr)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetBlockByHashRequest(request, blockHash);
+	return StreamRequest(client, PHANTASMA_ARENA_ARG request, StreamedResponse::Block, callbacks, out_header, out_error, projection);
+}
+
+template<class Client>
+bool StreamGetAddressTransactions(Client& client, PHANTASMA_ARENA_PARAM const Char* account, UInt32 page, UInt32 pageSize, const RpcStreamCallbacks& callbacks, AccountTransactions& out_header, PhantasmaError* out_error = nullptr, const RpcProjection* projection = nullptr)
+{
+	JSONBuilder request;
+	PhantasmaJsonAPI::MakeGetAddressTransactionsRequest(request, account, page, pageSize);
+	return StreamRequest(client, PHANTASMA_ARENA_ARG request, StreamedResponse::AddressTransactions, callbacks, out_header, out_error, projection);
+}
+#endif
+
+}}
@@ -1,7 +1,11 @@
 #pragma once
+#if defined(PHANTASMA_RPC_STRINGVIEW) || defined(PHANTASMA_PMR)
+#error "RpcUtils.h requires rpc strings of type String. Do not define PHANTASMA_RPC_STRINGVIEW or PHANTASMA_PMR"
+#endif
 
 #include "../Domain/Event.h"
 #include "../Blockchain/Transaction.h"
+#include "NodePool.h"
 
 namespace phantasma {
 
@@ -18,6 +22,18 @@ enum class TransactionState
 	Confirmed,
 };
 
+inline TransactionState ConfirmationState(const rpc::PhantasmaError& err)
+{
+	if( err.code == 0 )
+		return TransactionState::Confirmed;
+	else if( StringStartsWith(err.message, PHANTASMA_LITERAL("pending"), 7) )
+		return TransactionState::Pending;
+	else if( StringStartsWith(err.message, PHANTASMA_LITERAL("rejected"), 8) )
+		return TransactionState::Rejected;
+	else
+		return TransactionState::Unknown;
+}
+
 inline TransactionState CheckConfirmation(rpc::PhantasmaAPI& api, const Char* txHash, rpc::Transaction& output, rpc::PhantasmaError& err)
 {
 	PHANTASMA_TRY
@@ -31,14 +47,7 @@ inline TransactionState CheckConfirmation(rpc::PhantasmaAPI& api, const Char* tx
 		err.message = FromUTF8(e.what());
 #endif
 	}
-	if( err.code == 0 )
-		return TransactionState::Confirmed;
-	else if( StringStartsWith(err.message, PHANTASMA_LITERAL("pending"), 7) )
-		return TransactionState::Pending;
-	else if( StringStartsWith(err.message, PHANTASMA_LITERAL("rejected"), 8) )
-		return TransactionState::Rejected;
-	else
-		return TransactionState::Unknown;
+	return ConfirmationState(err);
 }
 inline TransactionState CheckConfirmation(rpc::PhantasmaAPI& api, const Char* txHash, rpc::Transaction& output)
 {
@@ -46,11 +55,19 @@ inline TransactionState CheckConfirmation(rpc::PhantasmaAPI& api, const Char* tx
 	return CheckConfirmation(api, txHash, output, err);
 }
 
+// Asks the best node in the pool, so a slow or failing node does not hold up the confirmation
+inline TransactionState CheckConfirmation(NodePool& pool, const Char* txHash, rpc::Transaction& output, rpc::PhantasmaError& err)
+{
+	String hash = txHash; // hedged requests may outlive this call, so must not refer to the caller's data
+	output = pool.Call([hash](rpc::PhantasmaAPI& api, rpc::PhantasmaError& e) { return api.GetTransaction(hash.c_str(), &e); }, &err);
+	return ConfirmationState(err);
+}
+
 inline TransactionState WaitForConfirmation(rpc::PhantasmaAPI* api, int numApi, const Char* txHash, Timestamp expiry, rpc::Transaction& output, FnCallback* fnSleep)
 {
 	if( !api || numApi <= 0 )
 		return TransactionState::Unknown;
-	for(int i=0; ; i %= numApi)
+	for(int i=0; ; i = (i+1) % numApi)
 	{
 		TransactionState state = CheckConfirmation( api[i], txHash, output );
 		switch(state)
@@ -72,6 +89,33 @@ inline TransactionState WaitForConfirmation(rpc::PhantasmaAPI* api, int numApi,
 	}
 }
 
+inline TransactionState WaitForConfirmation(NodePool& pool, const Char* txHash, Timestamp expiry, rpc::Transaction& output, FnCallback* fnSleep)
+{
+	if( pool.Size() <= 0 )
+		return TransactionState::Unknown;
+	for(;;)
+	{
+		rpc::PhantasmaError err;
+		TransactionState state = CheckConfirmation( pool, txHash, output, err );
+		switch(state)
+		{
+		case TransactionState::Confirmed:
+		case TransactionState::Rejected:
+			return state;
+		default:
+			if( expiry.Value )
+			{
+				Timestamp now = Timestamp::Now();
+				if( now + Timespan::FromSeconds(state == TransactionState::Unknown ? 5 : 10) > expiry )
+					return state;
+			}
+			if( fnSleep )
+				fnSleep();
+			break;
+		}
+	}
+}
+
 inline TransactionState SendTransaction(rpc::PhantasmaAPI& api, const Transaction& tx, String& out_txHash)
 {
 	String rawTx = Base16::Encode(tx.ToByteArray(true));
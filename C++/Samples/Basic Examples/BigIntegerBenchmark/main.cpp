@@ -0,0 +1,302 @@
+//------------------------------------------------------------------------------
+// This sample does NOT actually communicate with the network/chain. It measures
+//  the time and the number of heap allocations of BigInteger arithmetic on the
+//  kind of numbers that a wallet or an indexer handles: token amounts with 8 or
+//  18 decimals, which fit in a few 32-bit digits, the powers of 10 that scale
+//  them, and the Base58 decoding of addresses. The sum is measured once more
+//  with UInt256, converting the balances from BigInteger and the total back.
+// It then measures multiplication and division of operands from 1 to 64 digits
+//  (32 to 2048 bits), e.g. NFT IDs and hashes converted to numbers, and the
+//  conversion of numbers to and from text, checking that they round-trip.
+// Allocations are counted by replacing the global operator new.
+//------------------------------------------------------------------------------
+
+#define PHANTASMA_IMPLEMENTATION
+#define SODIUM_STATIC
+#include "../../../Libs/PhantasmaAPI.h"
+#include "../../../Libs/Adapters/PhantasmaAPI_sodium.h"
+#include "../../../Libs/Numerics/BigInteger.h"
+#include "../../../Libs/Numerics/Int256.h"
+#include "../../../Libs/Numerics/Base58.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+//Sorry, I haven't actually bundled a compiled version of libSodium with the project.
+//You have to download/build libSodium yourself!
+#pragma comment(lib, "libsodium.lib")
+
+using namespace phantasma;
+
+static size_t g_allocations = 0;
+
+void* operator new(size_t size)
+{
+	++g_allocations;
+	if( void* p = malloc(size ? size : 1) )
+		return p;
+	throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+const int NumAccounts = 1000;
+const int Repetitions = 200;
+
+struct Result
+{
+	double ms;
+	size_t allocations;
+	int    operations;
+};
+
+template<class Fn>
+static Result Measure(int operations, Fn fn)
+{
+	size_t allocations = g_allocations;
+	auto start = std::chrono::steady_clock::now();
+	fn();
+	double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	return Result{ ms, g_allocations - allocations, operations };
+}
+
+static void Print(const char* name, const Result& r)
+{
+	std::cout << name << ": " << (r.ms * 1000000 / r.operations) << " ns/op, "
+	          << ((double)r.allocations / r.operations) << " allocations/op" << std::endl;
+}
+
+// An amount between 0 and ~1e9 tokens, with 18 decimals
+static BigInteger MakeBalance(int seed)
+{
+	BigInteger value((Int64)seed * 7919 + 12345);
+	value *= BigInteger::Pow(10, 15);
+	value += BigInteger((Int64)seed * 104729);
+	return value;
+}
+
+// A number with the given count of 32-bit digits, all of them non-zero
+static BigInteger MakeNumber(int digits, UInt32 seed)
+{
+	PHANTASMA_VECTOR<UInt32> words;
+	for( int i = 0; i < digits; ++i )
+	{
+		seed = seed * 1664525u + 1013904223u;
+		words.push_back(seed | 1);
+	}
+	const UInt32* data = &words.front();
+	return BigInteger(data, digits);
+}
+
+static void BenchmarkDigits()
+{
+	std::cout << "Digits  Multiply (n x n)           Divide (2n / n)" << std::endl;
+	for( int digits : { 1, 2, 4, 8, 16, 32, 48, 64 } )
+	{
+		BigInteger a = MakeNumber(digits, 1);
+		BigInteger b = MakeNumber(digits, 2);
+		BigInteger c = MakeNumber(2 * digits, 3);
+		int repetitions = 2000000 / (digits * digits) + 100;
+
+		BigInteger product;
+		Result multiply = Measure(repetitions, [&]()
+		{
+			for( int r = 0; r < repetitions; ++r )
+				product = a * b;
+		});
+		BigInteger quotient;
+		Result divide = Measure(repetitions, [&]()
+		{
+			for( int r = 0; r < repetitions; ++r )
+				quotient = c / b;
+		});
+		if( product / b != a || quotient * b + c % b != c )
+			std::cout << "Unexpected result" << std::endl;
+
+		std::cout << digits << "\t" << (multiply.ms * 1000000 / repetitions) << " ns, " << ((double)multiply.allocations / repetitions) << " allocations\t"
+		                             << (divide.ms   * 1000000 / repetitions) << " ns, " << ((double)divide.allocations   / repetitions) << " allocations" << std::endl;
+	}
+}
+
+static String ToHexText(const BigInteger& value)
+{
+	auto words = value.ToUintArray();
+	std::ostringstream text;
+	text << std::hex << std::uppercase << std::setfill('0');
+	for( size_t i = words.size(); i-- > 0; )
+		text << std::setw(8) << words[i];
+	return String(text.str().c_str());
+}
+
+static void BenchmarkConversion()
+{
+	std::cout << "Digits  ToString                   String constructor" << std::endl;
+	for( int digits : { 2, 8, 32, 128, 512, 2048 } )
+	{
+		BigInteger a = MakeNumber(digits, 4);
+		String text = a.ToString();
+		int repetitions = 200000 / (digits * digits) + 20;
+
+		size_t length = 0;
+		Result format = Measure(repetitions, [&]()
+		{
+			for( int r = 0; r < repetitions; ++r )
+				length += a.ToString().length();
+		});
+		BigInteger parsed;
+		Result parse = Measure(repetitions, [&]()
+		{
+			for( int r = 0; r < repetitions; ++r )
+				parsed = BigInteger(text, 10);
+		});
+
+		bool roundTrip = parsed == a && length == text.length() * repetitions
+		              && BigInteger((-a).ToString(), 10) == -a
+		              && BigInteger(ToHexText(a), 16) == a
+		              && BigInteger((a - 1).ToString(), 10) + 1 == a;
+		if( !roundTrip )
+			std::cout << "Unexpected result" << std::endl;
+
+		std::cout << digits << "\t" << (format.ms * 1000000 / repetitions) << " ns, " << ((double)format.allocations / repetitions) << " allocations\t"
+		                             << (parse.ms  * 1000000 / repetitions) << " ns, " << ((double)parse.allocations  / repetitions) << " allocations"
+		          << " (" << text.length() << " characters)" << std::endl;
+	}
+}
+
+int main()
+{
+	if( sodium_init() < 0 )
+		return 1;
+
+	PHANTASMA_VECTOR<BigInteger> balances;
+	PHANTASMA_VECTOR<String> decimals;
+	PHANTASMA_VECTOR<ByteArray> addresses;
+	PHANTASMA_VECTOR<String> addressTexts;
+	for( int i = 0; i < NumAccounts; ++i )
+	{
+		balances.push_back(MakeBalance(i));
+		decimals.push_back(DecimalConversion(balances.back(), 18));
+		ByteArray address(34);
+		for( int j = 0; j < 34; ++j )
+			address[j] = (Byte)(i * 31 + j * 7 + 1);
+		addresses.push_back(address);
+		addressTexts.push_back(Base58::Encode(&address.front(), (int)address.size()));
+	}
+	const BigInteger fee = BigInteger::Pow(10, 15);
+	const BigInteger scale = BigInteger::Pow(10, 10);
+	const int operations = NumAccounts * Repetitions;
+
+	BigInteger total;
+	Result sum = Measure(operations, [&]()
+	{
+		for( int r = 0; r < Repetitions; ++r )
+			for( const BigInteger& balance : balances )
+				total += balance;
+	});
+
+	// The same sum in a UInt256, which doesn't keep track of the number of digits
+	PHANTASMA_VECTOR<UInt256> balances256;
+	for( const BigInteger& balance : balances )
+		balances256.push_back(static_cast<UInt256>(balance));
+	UInt256 total256;
+	Result sum256 = Measure(operations, [&]()
+	{
+		for( int r = 0; r < Repetitions; ++r )
+			for( const UInt256& balance : balances256 )
+				total256 += balance;
+	});
+	bool converted = static_cast<BigInteger>(total256) == total && total256.ToBigInteger() == total
+	              && static_cast<BigInteger>(static_cast<Int256>(-total)) == -total;
+
+	Result transfer = Measure(operations, [&]()
+	{
+		for( int r = 0; r < Repetitions; ++r )
+			for( int i = 0; i < NumAccounts; ++i )
+			{
+				BigInteger& from = balances[i];
+				BigInteger& to = balances[(i + 1) % NumAccounts];
+				from -= fee;
+				to += fee;
+			}
+	});
+
+	// 8 decimals -> 18 decimals, e.g. when converting between two tokens
+	BigInteger scaled;
+	Result rescale = Measure(operations, [&]()
+	{
+		for( int r = 0; r < Repetitions; ++r )
+			for( const BigInteger& balance : balances )
+			{
+				scaled = balance;
+				scaled *= scale;
+			}
+	});
+
+	BigInteger copies;
+	Result copy = Measure(operations, [&]()
+	{
+		for( int r = 0; r < Repetitions; ++r )
+			for( const BigInteger& balance : balances )
+			{
+				BigInteger a = balance;
+				BigInteger b = std::move(a);
+				copies = std::move(b);
+			}
+	});
+
+	int formatCount = NumAccounts * 10;
+	size_t length = 0;
+	Result format = Measure(formatCount, [&]()
+	{
+		for( int r = 0; r < 10; ++r )
+			for( const BigInteger& balance : balances )
+				length += DecimalConversion(balance, 18).length();
+	});
+
+	BigInteger parsedTotal;
+	Result parse = Measure(formatCount, [&]()
+	{
+		for( int r = 0; r < 10; ++r )
+			for( const String& text : decimals )
+				parsedTotal += DecimalConversion(text, 18);
+	});
+
+	// the scale of tokens with 8 to 18 decimals
+	BigInteger power;
+	Result pow = Measure(operations, [&]()
+	{
+		for( int r = 0; r < Repetitions; ++r )
+			for( int i = 0; i < NumAccounts; ++i )
+				power = BigInteger::Pow(10, 8 + i % 11);
+	});
+
+	int decoded = 0;
+	Result base58 = Measure(formatCount, [&]()
+	{
+		for( int r = 0; r < 10; ++r )
+			for( int i = 0; i < NumAccounts; ++i )
+				decoded += Base58::Decode(addressTexts[i]) == addresses[i] ? 1 : 0;
+	});
+
+	std::cout << NumAccounts << " balances with 18 decimals, " << Repetitions << " repetitions" << std::endl;
+	Print("Sum (+=)              ", sum);
+	Print("Sum (+=) with UInt256 ", sum256);
+	Print("Transfer (-=, +=)     ", transfer);
+	Print("Rescale (=, *=)       ", rescale);
+	Print("Copy and move         ", copy);
+	Print("DecimalConversion out ", format);
+	Print("DecimalConversion in  ", parse);
+	Print("Pow(10, decimals)     ", pow);
+	Print("Base58::Decode        ", base58);
+	if( total.IsZero() || scaled.IsZero() || copies.IsZero() || parsedTotal.IsZero() || length == 0 || power.IsZero() || decoded != formatCount || !converted )
+		std::cout << "Unexpected result" << std::endl;
+
+	std::cout << std::endl;
+	BenchmarkDigits();
+
+	std::cout << std::endl;
+	BenchmarkConversion();
+}
@@ -0,0 +1,228 @@
+//------------------------------------------------------------------------------
+// This sample does NOT actually communicate with the network/chain. It runs the
+//  epoll HTTP client against a stub server on the loopback interface, which
+//  answers each request with a canned response, and checks what the client
+//  makes of each one:
+//  - a body with a Content-Length, and a chunked body,
+//  - responses with only a status line (a bare 200, and a 204),
+//  - responses that arrive one byte at a time, or several in one packet,
+//  - a server that closes the connection after a response.
+// The epoll adaptor is Linux only, so there is no Visual Studio project for it:
+//
+//   g++ -std=c++17 -I../../../Libs main.cpp -o EpollLoopbackSample -lpthread
+//------------------------------------------------------------------------------
+
+#include "../../../Libs/Adapters/PhantasmaAPI_epoll.h"
+#define PHANTASMA_IMPLEMENTATION
+#include "../../../Libs/PhantasmaAPI.h"
+#include <arpa/inet.h>
+#include <iostream>
+#include <thread>
+
+using namespace phantasma;
+
+struct Reply
+{
+	std::string text;
+	bool slow = false;       // written one byte at a time
+	bool joinNext = false;   // held back, and written along with the next reply
+	bool close = false;      // the connection is closed after this reply
+};
+
+// Answers each request that arrives with the next reply, in order, then stops
+class StubServer
+{
+public:
+	StubServer(std::vector<Reply> replies)
+		: m_replies(std::move(replies))
+	{
+		m_listen = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		sockaddr_in address = {};
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		socklen_t length = sizeof(address);
+		bind(m_listen, (const sockaddr*)&address, length);
+		listen(m_listen, 4);
+		getsockname(m_listen, (sockaddr*)&address, &length);
+		m_port = ntohs(address.sin_port);
+		m_thread = std::thread([this]() { Serve(); });
+	}
+	~StubServer()
+	{
+		shutdown(m_listen, SHUT_RDWR);
+		m_thread.join();
+		close(m_listen);
+	}
+	std::string Url() const { return "http://127.0.0.1:" + std::to_string(m_port); }
+private:
+	int m_listen;
+	int m_port = 0;
+	std::vector<Reply> m_replies;
+	std::thread m_thread;
+
+	void Serve()
+	{
+		size_t next = 0;
+		while( next < m_replies.size() )
+		{
+			int fd = accept(m_listen, 0, 0);
+			if( fd < 0 )
+				return;
+			std::string in, held;
+			while( next < m_replies.size() && ReadRequest(fd, in) )
+			{
+				const Reply& reply = m_replies[next++];
+				held += reply.text;
+				if( reply.joinNext && next < m_replies.size() )
+					continue;
+				if( reply.slow )
+					for( char c : held )
+						send(fd, &c, 1, MSG_NOSIGNAL);
+				else
+					send(fd, held.data(), held.size(), MSG_NOSIGNAL);
+				held.clear();
+				if( reply.close )
+					break;
+			}
+			close(fd);
+		}
+	}
+	// Removes one request from the front of `in`, receiving more bytes as needed
+	static bool ReadRequest(int fd, std::string& in)
+	{
+		for(;;)
+		{
+			size_t headerEnd = in.find("\r\n\r\n");
+			if( headerEnd != std::string::npos )
+			{
+				size_t field = in.find("Content-Length: ");
+				size_t length = field < headerEnd ? (size_t)atol(in.c_str() + field + 16) : 0;
+				if( in.size() >= headerEnd + 4 + length )
+				{
+					in.erase(0, headerEnd + 4 + length);
+					return true;
+				}
+			}
+			char buffer[4096];
+			ssize_t received = recv(fd, buffer, sizeof(buffer), 0);
+			if( received <= 0 )
+				return false;
+			in.append(buffer, (size_t)received);
+		}
+	}
+};
+
+static Reply Body(const std::string& body, const char* headers = "")
+{
+	Reply reply;
+	reply.text = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n" + std::string(headers) +
+	             "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+	return reply;
+}
+static Reply Chunked(const std::string& body)
+{
+	Reply reply;
+	reply.text = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n";
+	for( size_t i = 0; i < body.size(); i += 7 )
+	{
+		std::string chunk = body.substr(i, 7);
+		char size[16];
+		snprintf(size, sizeof(size), "%zx\r\n", chunk.size());
+		reply.text += size + chunk + "\r\n";
+	}
+	reply.text += "0\r\n\r\n";
+	return reply;
+}
+static Reply Raw(const char* text)
+{
+	Reply reply;
+	reply.text = text;
+	return reply;
+}
+static Reply Slow(Reply reply)     { reply.slow = true; return reply; }
+static Reply JoinNext(Reply reply) { reply.joinNext = true; return reply; }
+static Reply Close(Reply reply)    { reply.close = true; return reply; }
+
+struct Outcome
+{
+	bool        done = false;
+	std::string error;
+	std::string body;
+};
+
+// Sends one request per reply through a single connection (so that they are pipelined), and compares what the
+//  client reports for each with the expected body, or with an error if `expected` is null
+static bool Check(const char* name, std::vector<Reply> replies, std::vector<const char*> expected)
+{
+	StubServer server(std::move(replies));
+	EpollHttpClient client(server.Url().c_str(), 1, 16);
+	std::vector<Outcome> outcomes(expected.size());
+	const char request[] = R"({"jsonrpc":"2.0","method":"getBlockHeight","params":["main"],"id":"1"})";
+	for( Outcome& outcome : outcomes )
+	{
+		client.PostAsync(request, sizeof(request) - 1, "/rpc", [&outcome](const char* error, char* body, size_t length)
+		{
+			outcome.done = true;
+			if( error )
+				outcome.error = error;
+			else
+				outcome.body.assign(body, length);
+		});
+	}
+	client.Run();
+
+	bool ok = true;
+	for( size_t i = 0; i < outcomes.size(); ++i )
+	{
+		const Outcome& o = outcomes[i];
+		bool match = o.done && (expected[i] ? o.error.empty() && o.body == expected[i] : !o.error.empty());
+		if( !match )
+		{
+			std::cout << "  response " << i << ": " << (o.done ? o.error.empty() ? "\"" + o.body + "\"" : "error: " + o.error : "not completed")
+			          << ", expected " << (expected[i] ? "\"" + std::string(expected[i]) + "\"" : "an error") << std::endl;
+		}
+		ok = ok && match;
+	}
+	std::cout << (ok ? "ok      " : "FAILED  ") << name << std::endl;
+	return ok;
+}
+
+int main()
+{
+	const char* json = R"({"jsonrpc":"2.0","id":"1","result":42})";
+	bool ok = true;
+	ok &= Check("Content-Length",                       { Body(json) }, { json });
+	ok &= Check("Content-Length, one byte at a time",   { Slow(Body(json)) }, { json });
+	ok &= Check("Chunked",                              { Chunked(json) }, { json });
+	ok &= Check("Chunked, one byte at a time",          { Slow(Chunked(json)) }, { json });
+	ok &= Check("Empty body",                           { Body(""), Body(json) }, { "", json });
+	ok &= Check("Bare 200 status line",                 { Raw("HTTP/1.1 200 OK\r\n\r\n") }, { nullptr });
+	ok &= Check("Bare 204 status line",                 { Raw("HTTP/1.1 204 No Content\r\n\r\n"), Body(json) }, { nullptr, json });
+	ok &= Check("204 with headers",                     { Raw("HTTP/1.1 204 No Content\r\nServer: stub\r\n\r\n"), Body(json) }, { nullptr, json });
+	ok &= Check("Status line without headers, slowly",  { Slow(Raw("HTTP/1.1 204 No Content\r\n\r\n")), Body(json) }, { nullptr, json });
+	ok &= Check("Malformed status line",                { Raw("HTTP/1.1\r\n\r\n") }, { nullptr });
+	ok &= Check("Three responses in one packet",        { JoinNext(Body(json)), JoinNext(Chunked(json)), Body("[]") }, { json, json, "[]" });
+	ok &= Check("Connection: close",                    { Close(Body(json, "Connection: close\r\n")), Body("[]") }, { json, "[]" });
+
+	// The same responses through PhantasmaAPI, which parses the JSON of each
+	{
+		StubServer server({ Body(json), Chunked(json), Raw("HTTP/1.1 204 No Content\r\n\r\n") });
+		EpollHttpClient client(server.Url().c_str(), 1, 1);
+		rpc::PhantasmaAPI api(client);
+		for( int expected : { 42, 42, 0 } )
+		{
+			rpc::PhantasmaError error;
+			Int32 height = api.GetBlockHeight("main", &error);
+			bool match = expected ? !error.code && height == expected : error.code == rpc::PhantasmaError::HttpError;
+			std::cout << (match ? "ok      " : "FAILED  ") << "PhantasmaAPI::GetBlockHeight -> ";
+			if( error.code )
+				std::cout << "error " << error.code << " (" << error.message << ")" << std::endl;
+			else
+				std::cout << height << std::endl;
+			ok &= match;
+		}
+	}
+
+	std::cout << (ok ? "All responses were handled as expected" : "Some responses were not handled as expected") << std::endl;
+	return ok ? 0 : 1;
+}
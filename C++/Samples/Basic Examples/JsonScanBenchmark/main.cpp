@@ -0,0 +1,289 @@
+//------------------------------------------------------------------------------
+// This sample does NOT actually communicate with the network/chain. It compares
+//  string scanners for the built-in JSON parser on block payloads: the
+//  byte-at-a-time find_first_of that the parser used before, the SSE2 scanner
+//  that json::ScanFor2 uses, and SSE4.2 (PCMPESTRI) and AVX2 scanners, which
+//  the parser doesn't use because they are not faster on these payloads.
+// It then measures whole responses: a structural pass (json::SkipValue) and
+//  ParseGetBlockByHeightResponse. Build once more with PHANTASMA_SIMD_DISABLE
+//  defined to get the same numbers for the byte-at-a-time parser.
+// Pass the paths of recorded responses (e.g. saved with curl from
+//  GetBlockByHeight or GetAddressTransactions) to measure those instead of the
+//  synthetic blocks.
+// With GCC or Clang:
+//
+//   g++ -std=c++17 -O2 main.cpp -o JsonScanBenchmark
+//   g++ -std=c++17 -O2 -DPHANTASMA_SIMD_DISABLE main.cpp -o JsonScanBenchmarkScalar
+//------------------------------------------------------------------------------
+
+#define PHANTASMA_IMPLEMENTATION
+#include "../../../Libs/PhantasmaAPI.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace phantasma;
+
+const int NumBlocks = 50;
+const int TransactionsPerBlock = 100;
+const int EventsPerTransaction = 4;
+const int Repetitions = 20;
+
+static std::string Hex(UInt32& seed, int bytes)
+{
+	static const char digits[] = "0123456789ABCDEF";
+	std::string text;
+	for( int i = 0; i < bytes; ++i )
+	{
+		seed = seed * 1664525u + 1013904223u;
+		text += digits[(seed >> 24) & 15];
+		text += digits[(seed >> 16) & 15];
+	}
+	return text;
+}
+
+// The JSON that a node returns for a busy block: most of the bytes are the hex strings of scripts and event data
+static std::string MakeBlock(int height)
+{
+	UInt32 seed = height;
+	std::ostringstream json;
+	json << R"({"jsonrpc":"2.0","id":"1","result":{"hash":")" << Hex(seed, 32) << R"(","previousHash":")" << Hex(seed, 32)
+	     << R"(","timestamp":)" << 1600000000 + height << R"(,"height":)" << height << R"(,"chainAddress":"S3dP2jjf1jUG9nethZBWbnu9a6dFqB7KveTWU7znis6jpDy")"
+	     << R"(,"protocol":8,"txs":[)";
+	for( int t = 0; t < TransactionsPerBlock; ++t )
+	{
+		json << (t ? "," : "") << R"({"hash":")" << Hex(seed, 32) << R"(","chainAddress":"S3dP2jjf1jUG9nethZBWbnu9a6dFqB7KveTWU7znis6jpDy")"
+		     << R"(,"timestamp":)" << 1600000000 + height << R"(,"blockHeight":)" << height << R"(,"blockHash":")" << Hex(seed, 32)
+		     << R"(","script":")" << Hex(seed, 300 + t % 7 * 40) << R"(","payload":")" << Hex(seed, 12) << R"(","events":[)";
+		for( int e = 0; e < EventsPerTransaction; ++e )
+		{
+			json << (e ? "," : "") << R"({"address":"P2K)" << Hex(seed, 21) << R"(","contract":"token","kind":")" << (e % 2 ? "TokenReceive" : "TokenSend")
+			     << R"(","data":")" << Hex(seed, 40) << R"("})";
+		}
+		json << R"(],"result":"","fee":"100000","signatures":[{"Kind":"Ed25519","Data":")" << Hex(seed, 64) << R"("}],"expiration":0})";
+	}
+	json << R"(],"validatorAddress":"P2K)" << Hex(seed, 21) << R"(","reward":"0","events":[],"oracles":[]}})";
+	return json.str();
+}
+
+template<class Fn>
+static double Milliseconds(Fn fn)
+{
+	auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void Print(const char* name, double ms, size_t bytes)
+{
+	std::cout << name << ": " << ms << " ms, " << (bytes * (double)Repetitions / ms / 1000) << " MB/s" << std::endl;
+}
+
+// Counts the quotes and backslashes of a document, the way SkipString finds them
+static size_t CountFindFirstOf(const std::string& doc)
+{
+	size_t count = 0;
+	for( size_t i = doc.find_first_of("\"\\"); i != std::string::npos; i = doc.find_first_of("\"\\", i + 1) )
+		++count;
+	return count;
+}
+
+// Counts them with the scanner that the parser uses
+static size_t CountScanFor2(const std::string& doc)
+{
+	const JSONValue& v = doc;
+	size_t count = 0;
+	for( size_t i = json::ScanFor2(v, 0, '"', '\\'); i != JSONValue::npos; i = json::ScanFor2(v, i + 1, '"', '\\') )
+		++count;
+	return count;
+}
+
+#ifdef PHANTASMA_SIMD_X64
+template<size_t (*Scan)(const char*, size_t, size_t, char, char)>
+static size_t CountScanner(const std::string& doc)
+{
+	size_t count = 0;
+	for( size_t i = 0; i < doc.size(); ++i )
+	{
+		i = Scan(doc.data(), i, doc.size(), '"', '\\');
+		while( i < doc.size() && doc[i] != '"' && doc[i] != '\\' )
+			++i;
+		if( i < doc.size() )
+			++count;
+	}
+	return count;
+}
+
+# if defined(_MSC_VER) && !defined(__clang__)
+#  define SSE42_TARGET
+#  define AVX2_TARGET
+static bool HasSSE42() { int r[4]; __cpuid(r, 1); return (r[2] & (1<<20)) != 0; }
+static bool HasAVX2()
+{
+	int r[4];
+	__cpuid(r, 0);
+	if( r[0] < 7 ) { return false; }
+	__cpuid(r, 1);
+	const int osxsave = 1<<27, avx = 1<<28;
+	if( (r[2] & (osxsave|avx)) != (osxsave|avx) || (_xgetbv(0) & 6) != 6 ) { return false; }
+	__cpuidex(r, 7, 0);
+	return (r[1] & (1<<5)) != 0;
+}
+# else
+#  define SSE42_TARGET __attribute__((target("sse4.2")))
+#  define AVX2_TARGET  __attribute__((target("avx2")))
+static bool HasSSE42() { return __builtin_cpu_supports("sse4.2") != 0; }
+static bool HasAVX2()  { return __builtin_cpu_supports("avx2") != 0; }
+# endif
+// The same contract as json::ScanFor2SSE2, using the SSE4.2 string instruction
+SSE42_TARGET static size_t ScanFor2SSE42(const char* s, size_t i, size_t n, char a, char b)
+{
+	const __m128i set = _mm_setr_epi8(a, b, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+	for(; i+16 <= n; i += 16)
+	{
+		int index = _mm_cmpestri(set, 2, _mm_loadu_si128((const __m128i*)(s+i)), 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY);
+		if( index < 16 ) { return i + index; }
+	}
+	return i;
+}
+// The same contract as json::ScanFor2SSE2, 32 bytes at a time
+AVX2_TARGET static size_t ScanFor2AVX2(const char* s, size_t i, size_t n, char a, char b)
+{
+	const __m256i va = _mm256_set1_epi8(a), vb = _mm256_set1_epi8(b);
+	for(; i+32 <= n; i += 32)
+	{
+		__m256i x = _mm256_loadu_si256((const __m256i*)(s+i));
+		unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(x, va), _mm256_cmpeq_epi8(x, vb)));
+		if( mask ) { return i + json::SimdLowestBit(mask); }
+	}
+	return i;
+}
+// The AVX2 loop only for strings that don't end within their first 16 bytes, which keeps the short ones inline
+static size_t ScanFor2Hybrid(const char* s, size_t i, size_t n, char a, char b)
+{
+	if( i+16 > n )
+		return i;
+	size_t first = i+16;
+	i = json::ScanFor2SSE2(s, i, first, a, b);
+	return i == first ? ScanFor2AVX2(s, i, n, a, b) : i;
+}
+#endif
+
+int main(int argc, char** argv)
+{
+	PHANTASMA_VECTOR<std::string> payloads;
+	for( int i = 1; i < argc; ++i )
+	{
+		std::ifstream file(argv[i], std::ios::binary);
+		std::stringstream text;
+		text << file.rdbuf();
+		if( !file || text.str().empty() )
+		{
+			std::cout << "Could not read " << argv[i] << std::endl;
+			return 1;
+		}
+		payloads.push_back(text.str());
+	}
+	if( payloads.empty() )
+		for( int i = 1; i <= NumBlocks; ++i )
+			payloads.push_back(MakeBlock(i));
+
+	size_t bytes = 0;
+	for( const std::string& payload : payloads )
+		bytes += payload.size();
+	std::cout << payloads.size() << " payloads, " << bytes / payloads.size() << " bytes each, " << Repetitions << " repetitions" << std::endl;
+
+	size_t expected = 0;
+	for( const std::string& payload : payloads )
+		expected += CountFindFirstOf(payload);
+
+	size_t found = 0;
+	Print("find_first_of        ", Milliseconds([&]()
+	{
+		for( int r = 0; r < Repetitions; ++r )
+			for( const std::string& payload : payloads )
+				found += CountFindFirstOf(payload);
+	}), bytes);
+	bool agree = found == expected * Repetitions;
+#ifdef PHANTASMA_SIMD_X64
+	found = 0;
+	Print("SSE2                 ", Milliseconds([&]()
+	{
+		for( int r = 0; r < Repetitions; ++r )
+			for( const std::string& payload : payloads )
+				found += CountScanner<json::ScanFor2SSE2>(payload);
+	}), bytes);
+	agree = agree && found == expected * Repetitions;
+	if( HasSSE42() )
+	{
+		found = 0;
+		Print("SSE4.2 (PCMPESTRI)   ", Milliseconds([&]()
+		{
+			for( int r = 0; r < Repetitions; ++r )
+				for( const std::string& payload : payloads )
+					found += CountScanner<ScanFor2SSE42>(payload);
+		}), bytes);
+		agree = agree && found == expected * Repetitions;
+	}
+	if( HasAVX2() )
+	{
+		found = 0;
+		Print("AVX2                 ", Milliseconds([&]()
+		{
+			for( int r = 0; r < Repetitions; ++r )
+				for( const std::string& payload : payloads )
+					found += CountScanner<ScanFor2AVX2>(payload);
+		}), bytes);
+		agree = agree && found == expected * Repetitions;
+		found = 0;
+		Print("SSE2 + AVX2          ", Milliseconds([&]()
+		{
+			for( int r = 0; r < Repetitions; ++r )
+				for( const std::string& payload : payloads )
+					found += CountScanner<ScanFor2Hybrid>(payload);
+		}), bytes);
+		agree = agree && found == expected * Repetitions;
+	}
+#endif
+	found = 0;
+	Print("json::ScanFor2       ", Milliseconds([&]()
+	{
+		for( int r = 0; r < Repetitions; ++r )
+			for( const std::string& payload : payloads )
+				found += CountScanFor2(payload);
+	}), bytes);
+	agree = agree && found == expected * Repetitions;
+#ifndef PHANTASMA_SIMD_X64
+	std::cout << "json::ScanFor2 uses the byte-at-a-time loop" << std::endl;
+#endif
+	if( !agree )
+		std::cout << "The scanners disagree on the number of quotes and backslashes" << std::endl;
+
+	std::cout << std::endl;
+	bool error = false;
+	Print("json::SkipValue      ", Milliseconds([&]()
+	{
+		for( int r = 0; r < Repetitions; ++r )
+			for( const std::string& payload : payloads )
+				json::SkipValue(payload, 0, error);
+	}), bytes);
+
+	int blocks = 0, transactions = 0;
+	Print("ParseGetBlockByHeight", Milliseconds([&]()
+	{
+		for( int r = 0; r < Repetitions; ++r )
+			for( const std::string& payload : payloads )
+			{
+				rpc::Block block;
+				if( rpc::PhantasmaJsonAPI::ParseGetBlockByHeightResponse(json::Parse(payload), block) )
+				{
+					++blocks;
+					transactions += (int)block.txs.size();
+				}
+			}
+	}), bytes);
+	if( error )
+		std::cout << "A payload is not valid JSON" << std::endl;
+	std::cout << blocks / Repetitions << " of the payloads are blocks, with " << transactions / Repetitions << " transactions" << std::endl;
+}
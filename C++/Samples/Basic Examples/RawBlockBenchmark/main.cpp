@@ -0,0 +1,168 @@
+//------------------------------------------------------------------------------
+// This sample does NOT actually communicate with the network/chain. It compares
+//  the cost of decoding the same blocks from the JSON of GetBlockByHeight
+//  (PhantasmaJsonAPI::ParseGetBlockByHeightResponse) and from the Base16 binary of
+//  GetRawBlockByHeight (Block::FromRawBlock).
+// The blocks are synthetic: each has a number of transactions with a few token
+//  events, which is typical of a busy chain.
+//------------------------------------------------------------------------------
+
+#define PHANTASMA_IMPLEMENTATION
+#define SODIUM_STATIC
+#include "../../../Libs/PhantasmaAPI.h"
+#include "../../../Libs/Adapters/PhantasmaAPI_sodium.h"
+#include "../../../Libs/Blockchain/Block.h"
+#include "../../../Libs/Utils/BinaryWriter.h"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+//Sorry, I haven't actually bundled a compiled version of libSodium with the project.
+//You have to download/build libSodium yourself!
+#pragma comment(lib, "libsodium.lib")
+
+using namespace phantasma;
+
+const int NumBlocks = 200;
+const int TransactionsPerBlock = 20;
+const int EventsPerTransaction = 4;
+const int Repetitions = 10;
+
+struct TestBlock
+{
+	std::string json;
+	String      raw;
+};
+
+static Hash MakeHash(int seed)
+{
+	Byte bytes[Hash::Length];
+	for( int i = 0; i < Hash::Length; ++i )
+		bytes[i] = (Byte)(seed * 31 + i);
+	return Hash(bytes, Hash::Length);
+}
+
+static Address MakeAddress(int seed)
+{
+	Byte bytes[Address::LengthInBytes] = { (Byte)AddressKind::User, 0 };
+	for( int i = 2; i < Address::LengthInBytes; ++i )
+		bytes[i] = (Byte)(seed * 17 + i);
+	return Address(bytes, Address::LengthInBytes);
+}
+
+static ByteArray MakeTokenEventData(int amount)
+{
+	BinaryWriter writer;
+	writer.WriteVarString(PHANTASMA_LITERAL("SOUL"));
+	writer.WriteBigInteger(BigInteger(amount));
+	writer.WriteVarString(PHANTASMA_LITERAL("main"));
+	return writer.ToArray();
+}
+
+// Writes a block the way a node does, and the JSON that the node returns for the same block
+static TestBlock MakeBlock(int height)
+{
+	BinaryWriter writer;
+	std::ostringstream json;
+	Hash previous = MakeHash(height - 1);
+	Address chain = MakeAddress(1);
+	Address validator = MakeAddress(2);
+	Timestamp time(1600000000 + height);
+
+	writer.WriteBigInteger(BigInteger(height));
+	writer.Write(time.Value);
+	writer.WriteHash(previous);
+	writer.WriteAddress(chain);
+	writer.WriteVarInt(8);
+	writer.WriteVarInt(TransactionsPerBlock);
+
+	json << R"({"jsonrpc":"2.0","id":"1","result":{"hash":")" << MakeHash(height).ToString() << R"(","previousHash":")" << previous.ToString()
+	     << R"(","timestamp":)" << time.Value << R"(,"height":)" << height << R"(,"chainAddress":")" << chain.Text()
+	     << R"(","protocol":8,"txs":[)";
+	for( int t = 0; t < TransactionsPerBlock; ++t )
+	{
+		Hash txHash = MakeHash(height * 1000 + t);
+		writer.WriteHash(txHash);
+		writer.WriteVarInt(EventsPerTransaction);
+		json << (t ? "," : "") << R"({"hash":")" << txHash.ToString() << R"(","chainAddress":")" << chain.Text()
+		     << R"(","timestamp":)" << time.Value << R"(,"blockHeight":)" << height << R"(,"blockHash":"","script":"","payload":"","events":[)";
+		for( int e = 0; e < EventsPerTransaction; ++e )
+		{
+			EventKind kind = e % 2 ? EventKind::TokenReceive : EventKind::TokenSend;
+			Address address = MakeAddress(100 + t * 10 + e);
+			ByteArray data = MakeTokenEventData(1000 * t + e);
+			writer.Write((Byte)kind);
+			writer.WriteAddress(address);
+			writer.WriteVarString(PHANTASMA_LITERAL("token"));
+			writer.WriteByteArray(data);
+			json << (e ? "," : "") << R"({"address":")" << address.Text() << R"(","contract":"token","kind":")" << EventKindToString(kind)
+			     << R"(","data":")" << Base16::Encode(data) << R"("})";
+		}
+		writer.Write((int16_t)-1); // no result
+		json << R"(],"result":"","fee":"0","signatures":[],"expiration":0})";
+	}
+	writer.WriteVarInt(0); // oracles
+	writer.WriteAddress(validator);
+	writer.WriteByteArray(ByteArray());
+	json << R"(],"validatorAddress":")" << validator.Text() << R"(","reward":"0","events":[],"oracles":[]}})";
+
+	return TestBlock{ json.str(), Base16::Encode(writer.ToArray()) };
+}
+
+template<class Fn>
+static double Milliseconds(Fn fn)
+{
+	auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+	if( sodium_init() < 0 )
+		return 1;
+
+	PHANTASMA_VECTOR<TestBlock> blocks;
+	size_t jsonBytes = 0, rawBytes = 0;
+	for( int i = 1; i <= NumBlocks; ++i )
+	{
+		blocks.push_back(MakeBlock(i));
+		jsonBytes += blocks.back().json.size();
+		rawBytes += blocks.back().raw.size();
+	}
+
+	int events = 0;
+	double jsonMs = Milliseconds([&]()
+	{
+		for( int r = 0; r < Repetitions; ++r )
+			for( const TestBlock& block : blocks )
+			{
+				rpc::Block output;
+				rpc::PhantasmaJsonAPI::ParseGetBlockByHeightResponse(json::Parse(block.json), output);
+				for( const rpc::Transaction& tx : output.txs )
+					events += (int)tx.events.size();
+			}
+	});
+	double rawMs = Milliseconds([&]()
+	{
+		for( int r = 0; r < Repetitions; ++r )
+			for( const TestBlock& block : blocks )
+			{
+				Block output;
+				if( !Block::FromRawBlock(block.raw, output) )
+				{
+					std::cout << "Failed to decode a raw block" << std::endl;
+					return;
+				}
+				for( const Block::TransactionEntry& tx : output.Transactions() )
+					events -= (int)tx.events.size();
+			}
+	});
+
+	int decoded = NumBlocks * Repetitions;
+	std::cout << decoded << " blocks of " << TransactionsPerBlock << " transactions, " << EventsPerTransaction << " events each" << std::endl;
+	std::cout << "JSON: " << jsonMs << " ms, " << (decoded / jsonMs * 1000) << " blocks/s, " << jsonBytes / NumBlocks << " bytes per block" << std::endl;
+	std::cout << "Raw:  " << rawMs  << " ms, " << (decoded / rawMs  * 1000) << " blocks/s, " << rawBytes  / NumBlocks << " bytes per block" << std::endl;
+	if( events != 0 )
+		std::cout << "The two decoders disagree on the number of events" << std::endl;
+}
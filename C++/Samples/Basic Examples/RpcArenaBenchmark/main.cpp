@@ -0,0 +1,158 @@
+//------------------------------------------------------------------------------
+// This sample does NOT actually communicate with the network/chain. It measures
+//  the number of heap allocations, and the time, of deserializing a block of
+//  5000 transactions with ParseGetBlockByHeightResponse and destroying it again:
+//  - onto the global heap, which is what a build without PHANTASMA_PMR does,
+//  - into a std::pmr::monotonic_buffer_resource selected by a RpcMemoryScope,
+//  - into a monotonic_buffer_resource on a buffer that is reused for every block.
+// Allocations are counted by replacing the global operator new, and the default
+//  resource of std::pmr.
+//------------------------------------------------------------------------------
+
+#define PHANTASMA_PMR
+#define PHANTASMA_IMPLEMENTATION
+#include "../../../Libs/PhantasmaAPI.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+using namespace phantasma;
+using namespace phantasma::rpc;
+
+static size_t g_allocations = 0;
+
+void* operator new(size_t size)
+{
+	++g_allocations;
+	if( void* p = malloc(size ? size : 1) )
+		return p;
+	throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+// std::pmr allocates from the heap through its default resource, which doesn't call the operator new above
+class CountingResource : public std::pmr::memory_resource
+{
+	void* do_allocate(size_t bytes, size_t alignment) override
+	{
+		++g_allocations;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+	void do_deallocate(void* p, size_t bytes, size_t alignment) override
+	{
+		std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+const int TransactionsPerBlock = 5000;
+const int EventsPerTransaction = 4;
+const int Repetitions = 20;
+
+struct Result
+{
+	double parseMs;
+	double destroyMs;
+	size_t allocations;
+};
+
+static String Hex(int seed, int bytes)
+{
+	static const char digits[] = "0123456789ABCDEF";
+	String text;
+	for( int i = 0; i < bytes * 2; ++i )
+		text += digits[(seed * 7 + i * 13) & 15];
+	return text;
+}
+
+static std::string MakeBlock()
+{
+	std::ostringstream json;
+	json << R"({"jsonrpc":"2.0","id":"1","result":{"hash":")" << Hex(1, 32) << R"(","previousHash":")" << Hex(2, 32)
+	     << R"(","timestamp":1600000000,"height":1000,"chainAddress":"S3dP2jjf1jUG9nethZBWbnu9a6dFqB7KveTWU7znis6jpDy","protocol":8,"txs":[)";
+	for( int t = 0; t < TransactionsPerBlock; ++t )
+	{
+		json << (t ? "," : "") << R"({"hash":")" << Hex(t, 32) << R"(","chainAddress":"S3dP2jjf1jUG9nethZBWbnu9a6dFqB7KveTWU7znis6jpDy")"
+		     << R"(,"timestamp":1600000000,"blockHeight":1000,"blockHash":")" << Hex(1, 32) << R"(","script":")" << Hex(t, 200)
+		     << R"(","payload":"","events":[)";
+		for( int e = 0; e < EventsPerTransaction; ++e )
+		{
+			json << (e ? "," : "") << R"({"address":"P2K)" << Hex(t + e, 21) << R"(","contract":"token","kind":")" << (e % 2 ? "TokenReceive" : "TokenSend")
+			     << R"(","data":")" << Hex(e, 40) << R"("})";
+		}
+		json << R"(],"result":"","fee":"100000","signatures":[{"Kind":"Ed25519","Data":")" << Hex(t, 64) << R"("}],"expiration":0})";
+	}
+	json << R"(],"validatorAddress":"P2K)" << Hex(3, 21) << R"(","reward":"0","events":[],"oracles":[]}})";
+	return json.str();
+}
+
+static double Now()
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Parses and destroys the block Repetitions times. `makeArena` returns the memory resource for each block, or
+//  null for the global heap, and `dropArena` is called after the block has been destroyed.
+template<class MakeArena, class DropArena>
+static Result Measure(const std::string& doc, MakeArena makeArena, DropArena dropArena, int& transactions)
+{
+	Result result{ 0, 0, 0 };
+	size_t allocations = g_allocations;
+	for( int r = 0; r < Repetitions; ++r )
+	{
+		double start = Now();
+		std::pmr::memory_resource* arena = makeArena();
+		Block* block = new Block;
+		{
+			RpcMemoryScope scope(arena ? arena : std::pmr::get_default_resource());
+			PhantasmaJsonAPI::ParseGetBlockByHeightResponse(json::Parse(doc), *block);
+		}
+		double parsed = Now();
+		transactions += (int)block->txs.size();
+		delete block;
+		dropArena();
+		double destroyed = Now();
+		result.parseMs += parsed - start;
+		result.destroyMs += destroyed - parsed;
+	}
+	result.allocations = g_allocations - allocations;
+	return result;
+}
+
+static void Print(const char* name, const Result& r)
+{
+	std::cout << name << ": parse " << r.parseMs / Repetitions << " ms, destroy " << r.destroyMs / Repetitions << " ms, "
+	          << ((double)r.allocations / Repetitions) << " heap allocations per block" << std::endl;
+}
+
+int main()
+{
+	CountingResource heapResource;
+	std::pmr::set_default_resource(&heapResource);
+
+	std::string doc = MakeBlock();
+	std::cout << "A block of " << TransactionsPerBlock << " transactions with " << EventsPerTransaction << " events each, "
+	          << doc.size() / 1024 << " KB of JSON, " << Repetitions << " repetitions" << std::endl;
+
+	int transactions = 0;
+	Result heap = Measure(doc, [](){ return (std::pmr::memory_resource*)nullptr; }, [](){}, transactions);
+
+	// A new arena for each block, which frees all of it at once when it is destroyed
+	std::pmr::monotonic_buffer_resource* resource = nullptr;
+	Result arena = Measure(doc, [&](){ return resource = new std::pmr::monotonic_buffer_resource(); },
+	                            [&](){ delete resource; }, transactions);
+
+	// One arena on a buffer that is allocated once, and released after each block
+	PHANTASMA_VECTOR<Byte> buffer(doc.size() * 2);
+	std::pmr::monotonic_buffer_resource reused(&buffer.front(), buffer.size());
+	Result reuse = Measure(doc, [&](){ return &reused; }, [&](){ reused.release(); }, transactions);
+
+	Print("Global heap          ", heap);
+	Print("Monotonic arena      ", arena);
+	Print("Reused arena buffer  ", reuse);
+	if( transactions != 3 * Repetitions * TransactionsPerBlock )
+		std::cout << "Unexpected result" << std::endl;
+}